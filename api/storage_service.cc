@@ -1844,6 +1844,27 @@ rest_tablet_balancing_enable(sharded<service::storage_service>& ss, std::unique_
         co_return json_void();
 }
 
+static
+future<json::json_return_type>
+rest_get_tablet_balancer_snapshot(sharded<service::storage_service>& ss, std::unique_ptr<http::request> req) {
+    auto snapshot = co_await ss.local().get_tablet_balancer_snapshot();
+    auto result = co_await service::tablet_balancer_snapshot_to_json(snapshot);
+    co_return noncopyable_function<future<> (output_stream<char>&&)>([res = std::move(result)] (output_stream<char>&& o) -> future<> {
+        std::exception_ptr ex;
+        output_stream<char> out = std::move(o);
+        try {
+            co_await rjson::print(res, out);
+            co_await out.flush();
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        co_await out.close();
+        if (ex) {
+            co_await coroutine::return_exception_ptr(std::move(ex));
+        }
+    });
+}
+
 static
 future<json::json_return_type>
 rest_create_vnode_tablet_migration(http_context& ctx, sharded<service::storage_service>& ss, std::unique_ptr<http::request> req) {
@@ -2107,6 +2128,7 @@ void set_storage_service(http_context& ctx, routes& r, sharded<service::storage_
     ss::del_tablet_replica.set(r, gated(ss, rest_bind(rest_del_tablet_replica, ctx, ss)));
     ss::repair_tablet.set(r, gated(ss, rest_bind(rest_repair_tablet, ctx, ss)));
     ss::tablet_balancing_enable.set(r, gated(ss, rest_bind(rest_tablet_balancing_enable, ss)));
+    ss::get_tablet_balancer_snapshot.set(r, gated(ss, rest_bind(rest_get_tablet_balancer_snapshot, ss)));
     ss::create_vnode_tablet_migration.set(r, gated(ss, rest_bind(rest_create_vnode_tablet_migration, ctx, ss)));
     ss::get_vnode_tablet_migration.set(r, gated(ss, rest_bind(rest_get_vnode_tablet_migration, ctx, ss)));
     ss::set_vnode_tablet_migration_node_storage_mode.set(r, gated(ss, rest_bind(rest_set_vnode_tablet_migration_node_storage_mode, ctx, ss)));
@@ -2191,6 +2213,7 @@ void unset_storage_service(http_context& ctx, routes& r) {
     ss::del_tablet_replica.unset(r);
     ss::repair_tablet.unset(r);
     ss::tablet_balancing_enable.unset(r);
+    ss::get_tablet_balancer_snapshot.unset(r);
     ss::create_vnode_tablet_migration.unset(r);
     ss::get_vnode_tablet_migration.unset(r);
     ss::set_vnode_tablet_migration_node_storage_mode.unset(r);
@@ -13,6 +13,8 @@
 #include <seastar/core/file.hh>
 #include <chrono>
 #include <cmath>
+#include <functional>
+#include <optional>
 
 #include "seastarx.hh"
 #include "backlog_controller_fwd.hh"
@@ -124,6 +126,73 @@ class flush_controller : public backlog_controller {
     {}
 };
 
+// Online tuning of the compaction controller's output.
+//
+// The compaction controller maps the backlog to shares with the same static curve on every
+// kind of disk, so on slow disks it may either hurt foreground latency or let the backlog
+// grow, and it oscillates when the latency impact of compaction changes with the load.
+//
+// When a foreground latency target is configured, the autotuner scales the output of the
+// curve by a gain it learns from samples taken at every controller tick:
+//
+// - if the p99 foreground latency exceeds the target, the gain is decreased in proportion to
+//   the overshoot, by at most half per sample;
+// - if there is latency headroom and the backlog is growing, the gain is increased a little,
+//   to consume the backlog while it is cheap to.
+//
+// To keep the backlog bounded even when the latency target can't be met, the shares are never
+// lower than those needed to consume the backlog within max_backlog_drain_time, according to
+// the measured compaction throughput per share.
+class compaction_shares_autotuner {
+public:
+    struct sample {
+        // Foreground latency target.
+        std::chrono::microseconds target;
+        // Compaction backlog, in bytes.
+        double backlog;
+        // Bytes compacted since the previous sample.
+        uint64_t compacted_bytes;
+        std::chrono::duration<double> interval;
+        // Foreground requests completed since the previous sample, and their p99 latency.
+        uint64_t foreground_requests;
+        std::chrono::microseconds foreground_p99;
+    };
+
+    struct stats {
+        float gain = 1.0f;
+        float shares = 0;
+        // Smoothed compaction throughput, in bytes per second per share.
+        double throughput_per_share = 0;
+        std::chrono::microseconds foreground_p99{0};
+        // Samples which decreased the gain because of the latency target.
+        uint64_t latency_throttles = 0;
+        // Samples which increased the gain because of latency headroom.
+        uint64_t backlog_boosts = 0;
+    };
+
+    static constexpr float min_gain = 0.1f;
+    static constexpr float max_gain = 4.0f;
+    static constexpr float gain_increase = 1.1f;
+    // Fraction of the target under which the latency has headroom.
+    static constexpr float latency_headroom = 0.8f;
+    // Samples with fewer foreground requests don't say much about their latency.
+    static constexpr uint64_t min_foreground_requests = 20;
+    static constexpr float throughput_smoothing = 0.2f;
+    static constexpr std::chrono::seconds max_backlog_drain_time{1800};
+
+private:
+    double _last_backlog = 0;
+    stats _stats;
+
+public:
+    // Returns the shares to use given the output of the static curve, within [min_shares, max_shares].
+    float adjust(float curve_shares, const sample& s, float min_shares, float max_shares);
+
+    const stats& get_stats() const noexcept {
+        return _stats;
+    }
+};
+
 class compaction_controller : public backlog_controller {
 public:
     static constexpr unsigned normalization_factor = 30;
@@ -131,13 +200,24 @@ class compaction_controller : public backlog_controller {
     static constexpr float backlog_disabled(float backlog) { return std::isinf(backlog); }
     static inline const std::vector<backlog_controller::control_point> default_control_points = {
             backlog_controller::control_point{0.0, 50}, {1.5, 100}, {normalization_factor, default_compaction_maximum_shares}};
+    // Lower bound of the shares when the autotuner throttles compaction.
+    static constexpr float min_autotuned_shares = 10;
+    // Returns a disengaged optional when autotuning is disabled.
+    using autotune_sampler = std::function<std::optional<compaction_shares_autotuner::sample>()>;
+private:
+    autotune_sampler _autotune_sampler;
+    compaction_shares_autotuner _autotuner;
+protected:
+    virtual void update_controller(float shares) override;
+public:
     compaction_controller(backlog_controller::scheduling_group sg, float static_shares, std::optional<float> max_shares,
-        std::chrono::milliseconds interval, std::function<float()> current_backlog)
+        std::chrono::milliseconds interval, std::function<float()> current_backlog, autotune_sampler sampler = {})
         : backlog_controller(std::move(sg), std::move(interval),
           default_control_points,
           std::move(current_backlog),
           static_shares
         )
+        , _autotune_sampler(std::move(sampler))
     {
         if (max_shares) {
             set_max_shares(*max_shares);
@@ -146,4 +226,8 @@ class compaction_controller : public backlog_controller {
 
     // Updates the maximum output value for control points.
     void set_max_shares(float max_shares);
+
+    const compaction_shares_autotuner::stats& autotuner_stats() const noexcept {
+        return _autotuner.get_stats();
+    }
 };
@@ -251,10 +251,10 @@ static max_purgeable get_max_purgeable_timestamp(const compaction_group_view& ta
         }
         api::timestamp_type min_timestamp = sst->get_stats_metadata().min_timestamp;
         auto ts_stats = sst->get_ext_timestamp_stats();
+        auto stat = is_shadowable ?
+                sstables::ext_timestamp_stats_type::min_live_row_marker_timestamp :
+                sstables::ext_timestamp_stats_type::min_live_timestamp;
         if (!ts_stats.empty()) {
-            auto stat = is_shadowable ?
-                    sstables::ext_timestamp_stats_type::min_live_row_marker_timestamp :
-                    sstables::ext_timestamp_stats_type::min_live_timestamp;
             auto it = ts_stats.find(stat);
             if (it != ts_stats.end()) {
                 min_timestamp = it->second;
@@ -263,6 +263,12 @@ static max_purgeable get_max_purgeable_timestamp(const compaction_group_view& ta
                 on_internal_error_noexcept(clogger, format("Missing extended timestamp statstics: stat={} is_shadowable={}", int(stat), bool(is_shadowable)));
             }
         }
+        // An old sstable shouldn't prevent purging tombstones of keys whose
+        // neighbourhood in the sstable only holds newer data, or which it
+        // doesn't hold at all.
+        if (auto key_min_timestamp = sst->get_min_timestamp_for_token(dk.token(), stat)) {
+            min_timestamp = std::max(min_timestamp, *key_min_timestamp);
+        }
         if (clogger.is_enabled(log_level::trace)) {
             if (!hk) {
                 hk = sstables::sstable::make_hashed_key(*table_s.schema(), dk.key());
@@ -552,6 +558,10 @@ uint64_t compaction_progress_monitor::get_progress() const {
 
 class compaction {
 protected:
+    // Compactions of at least this much data may compress their output on helper shards,
+    // see sstables_manager::config::compaction_compression_helper_shards.
+    static constexpr uint64_t min_size_for_compression_offload = 1024 * 1024 * 1024;
+
     compaction_data& _cdata;
     compaction_group_view& _table_s;
     const compaction_sstable_creator_fn _sstable_creator;
@@ -603,6 +613,11 @@ class compaction {
     utils::observable<> _stop_request_observable;
     tombstone_gc_state _tombstone_gc_state;
     int64_t _output_repaired_at = 0;
+    const bool _copy_disjoint_sstables = false;
+    // Input sstables which will be linked into the output run instead of being rewritten,
+    // paired with the new sstable each of them will be linked to.
+    std::vector<std::pair<sstables::shared_sstable, sstables::shared_sstable>> _copied_through_sstables;
+    uint64_t _copied_through_size = 0;
 private:
     // Keeps track of monitors for input sstable.
     // If _update_backlog_tracker is set to true, monitors are responsible for adjusting backlog as compaction progresses.
@@ -652,6 +667,7 @@ class compaction {
         , _sharder(descriptor.sharder)
         , _owned_ranges_checker(_owned_ranges ? std::optional<dht::incremental_owned_ranges_checker>(*_owned_ranges) : std::nullopt)
         , _tombstone_gc_state(_table_s.get_tombstone_gc_state())
+        , _copy_disjoint_sstables(descriptor.copy_disjoint_sstables && _type == compaction_type::Compaction)
         , _progress_monitor(progress_monitor)
     {
         if (descriptor.gc_check_only_compacting_sstables) {
@@ -707,6 +723,9 @@ class compaction {
         cfg.run_identifier = _run_identifier;
         cfg.replay_position = _rp;
         cfg.sstable_level = _sstable_level;
+        if (_compacting_data_file_size >= min_size_for_compression_offload) {
+            cfg.compression_helper_shards = _table_s.get_sstables_manager().get_config().compaction_compression_helper_shards();
+        }
         return cfg;
     }
 
@@ -858,9 +877,104 @@ class compaction {
         return _tombstone_gc_state;
     }
 
+    // Returns true if compaction would write the content of the sstable back as is,
+    // provided that it doesn't overlap with any other input sstable.
+    bool can_copy_through(const sstables::shared_sstable& sst) const {
+        if (sst->is_shared() || !sst->has_scylla_component() || sst->ondisk_data_size() > _max_sstable_size) {
+            return false;
+        }
+        const auto& stats = sst->get_stats_metadata();
+        // Every tombstone and expiring cell lowers the minimum local deletion time, so
+        // the sstable has nothing which could be purged or expired.
+        if (stats.min_local_deletion_time != std::numeric_limits<int32_t>::max()) {
+            return false;
+        }
+        // Data of dropped columns would be dropped when rewriting the sstable.
+        for (const auto& [name, dropped] : _schema->dropped_columns()) {
+            if (dropped.timestamp >= stats.min_timestamp) {
+                return false;
+            }
+        }
+        // Rewriting the sstable would also apply the current compression settings.
+        const auto& params = _schema->get_compressor_params();
+        const auto& compression = sst->get_compression();
+        if (!params.compression_enabled()) {
+            return !compression;
+        }
+        return compression && !params.uses_dictionary_compressor()
+                && compression.get_compressor().get_algorithm() == params.get_algorithm()
+                && compression.uncompressed_chunk_length() == unsigned(params.chunk_length());
+    }
+
+    // Selects the input sstables which will be linked into the output run instead of
+    // being rewritten. The output sstables are created here, to make sure they're in the
+    // same version and format as the input ones.
+    future<> select_sstables_to_copy_through(const std::unordered_set<sstables::shared_sstable>& fully_expired) {
+        if (!_copy_disjoint_sstables || _sstables.size() < 2 || use_interposer_consumer()) {
+            co_return;
+        }
+        auto sorted = _sstables;
+        std::ranges::sort(sorted, [] (const sstables::shared_sstable& a, const sstables::shared_sstable& b) {
+            return a->compare_by_first_key(*b) < 0;
+        });
+        std::unordered_set<sstables::shared_sstable> candidates;
+        // Last key of all sstables preceding the current one, in the order of first keys.
+        const dht::decorated_key* max_last_key = nullptr;
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            co_await coroutine::maybe_yield();
+            const auto& sst = sorted[i];
+            bool disjoint = (!max_last_key || sst->get_first_decorated_key().tri_compare(*_schema, *max_last_key) > 0)
+                    && (i + 1 == sorted.size() || sst->get_last_decorated_key().tri_compare(*_schema, sorted[i + 1]->get_first_decorated_key()) < 0);
+            if (!max_last_key || sst->get_last_decorated_key().tri_compare(*_schema, *max_last_key) > 0) {
+                max_last_key = &sst->get_last_decorated_key();
+            }
+            if (disjoint && !fully_expired.contains(sst) && can_copy_through(sst)) {
+                candidates.insert(sst);
+            }
+        }
+        if (candidates.empty()) {
+            co_return;
+        }
+
+        // The sstables written by the compaction span the key range of all the
+        // rewritten input sstables, so a linked sstable within that span could
+        // overlap them, breaking the disjointness of the output run.
+        const dht::decorated_key* rewritten_first = nullptr;
+        const dht::decorated_key* rewritten_last = nullptr;
+        for (const auto& sst : sorted) {
+            if (candidates.contains(sst)) {
+                continue;
+            }
+            if (!rewritten_first) {
+                rewritten_first = &sst->get_first_decorated_key();
+            }
+            if (!rewritten_last || sst->get_last_decorated_key().tri_compare(*_schema, *rewritten_last) > 0) {
+                rewritten_last = &sst->get_last_decorated_key();
+            }
+        }
+
+        for (const auto& sst : sorted) {
+            if (!candidates.contains(sst)) {
+                continue;
+            }
+            if (rewritten_first && sst->get_last_decorated_key().tri_compare(*_schema, *rewritten_first) >= 0
+                    && sst->get_first_decorated_key().tri_compare(*_schema, *rewritten_last) <= 0) {
+                log_debug("Disjoint sstable {} is within the key range of the rewritten sstables, it will be rewritten too", sst->get_filename());
+                continue;
+            }
+            auto target = _sstable_creator(this_shard_id());
+            if (target->get_version() != sst->get_version() || target->get_format() != sst->get_format()) {
+                continue;
+            }
+            _copied_through_sstables.emplace_back(sst, std::move(target));
+        }
+    }
+
     future<> setup() {
         auto ssts = make_lw_shared<sstables::sstable_set>(make_sstable_set_for_input());
         auto fully_expired = _table_s.fully_expired_sstables(_sstables, gc_clock::now());
+        co_await select_sstables_to_copy_through(fully_expired);
+        auto copied_through = _copied_through_sstables | std::views::keys | std::ranges::to<std::unordered_set>();
         min_max_tracker<api::timestamp_type> timestamp_tracker;
 
         double sum_of_estimated_droppable_tombstone_ratio = 0;
@@ -890,6 +1004,11 @@ class compaction {
                 log_debug("Fully expired sstable {} will be dropped on compaction completion", sst->get_filename());
                 continue;
             }
+            if (copied_through.contains(sst)) {
+                log_debug("Disjoint sstable {} will be linked into the output run", sst->get_filename());
+                _copied_through_size += sst->bytes_on_disk();
+                continue;
+            }
             _stats_collector.update(sst->get_encoding_stats_for_compaction());
 
             compaction_size += sst->data_size();
@@ -912,9 +1031,9 @@ class compaction {
             _output_repaired_at = repaired_at;
         }
         log_debug("repaired_at_vec={} output_repaired_at={}", repaired_at_for_compacted_sstables, _output_repaired_at);
-        if (ssts->size() < _sstables.size()) {
+        if (ssts->size() + copied_through.size() < _sstables.size()) {
             log_debug("{} out of {} input sstables are fully expired sstables that will not be actually compacted",
-                      _sstables.size() - ssts->size(), _sstables.size());
+                      _sstables.size() - ssts->size() - copied_through.size(), _sstables.size());
         }
         // _estimated_droppable_tombstone_ratio could exceed 1.0 in certain cases, so limit it to 1.0.
         _estimated_droppable_tombstone_ratio = std::min(1.0, sum_of_estimated_droppable_tombstone_ratio / ssts->size());
@@ -925,6 +1044,31 @@ class compaction {
         _ms_metadata.max_timestamp = timestamp_tracker.max();
     }
 
+    // Links the sstables selected by select_sstables_to_copy_through() into the output run.
+    // Only the statistics are rewritten, to update the level and the repair status.
+    // Must be called in a seastar thread.
+    void link_copied_through_sstables() {
+        for (auto& [sst, target] : _copied_through_sstables) {
+            setup_new_sstable(target);
+            auto creator = [target] (sstables::shared_sstable) {
+                return target;
+            };
+            auto modifier = [this] (sstables::sstable& new_sst) {
+                new_sst.mutate_sstable_level(_sstable_level);
+                new_sst.update_repaired_at(_output_repaired_at);
+            };
+            auto linked = sst->link_with_rewritten_component(std::move(creator), component_type::Statistics, std::move(modifier),
+                    sstables::update_sstable_id::yes, _run_identifier).get();
+            _end_size += linked->bytes_on_disk();
+            _new_unused_sstables.push_back(linked);
+            _new_partial_sstables.erase(linked);
+        }
+        if (!_copied_through_sstables.empty()) {
+            log_debug("Linked {} disjoint sstable(s) into the output run, without rewriting {}",
+                    _copied_through_sstables.size(), utils::pretty_printed_data_size(_copied_through_size));
+        }
+    }
+
     // This consumer will perform mutation compaction on producer side using
     // compacting_reader. It's useful for allowing data from different buckets
     // to be compacted together.
@@ -1018,6 +1162,7 @@ class compaction {
                 .bloom_filter_checks = _bloom_filter_checks,
                 .reader_statistics = std::move(_reader_statistics),
                 .tombstone_purge_stats = std::move(_tombstone_purge_stats),
+                .copied_through_size = _copied_through_size,
             },
         };
 
@@ -2078,11 +2223,11 @@ class resharding_compaction final : public compaction {
 future<compaction_result> compaction::run(std::unique_ptr<compaction> c) {
     return seastar::async([c = std::move(c)] () mutable {
         c->setup().get();
-        auto consumer = c->consume();
 
         auto start_time = db_clock::now();
         try {
-           consumer.get();
+           c->link_copied_through_sstables();
+           c->consume().get();
         } catch (...) {
             c->on_interrupt(std::current_exception());
             c = nullptr; // make sure writers are stopped while running in thread context. This is because of calls to file.close().get();
@@ -82,6 +82,8 @@ struct compaction_stats {
     uint64_t bloom_filter_checks = 0;
     combined_reader_statistics reader_statistics;
     tombstone_purge_stats tombstone_purge_stats;
+    // Size of input sstables linked into the output without being rewritten
+    uint64_t copied_through_size = 0;
 
     compaction_stats& operator+=(const compaction_stats& r) {
         started_at = std::max(started_at, r.started_at);
@@ -91,6 +93,7 @@ struct compaction_stats {
         validation_errors += r.validation_errors;
         bloom_filter_checks += r.bloom_filter_checks;
         tombstone_purge_stats += r.tombstone_purge_stats;
+        copied_through_size += r.copied_through_size;
         return *this;
     }
     friend compaction_stats operator+(const compaction_stats& l, const compaction_stats& r) {
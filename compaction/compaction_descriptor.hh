@@ -16,6 +16,7 @@
 #include "sstables/types_fwd.hh"
 #include "sstables/sstable_set.hh"
 #include "compaction_fwd.hh"
+#include "data_dictionary/storage_options.hh"
 #include "mutation_writer/token_group_based_splitting_writer.hh"
 #include "utils/chunked_vector.hh"
 
@@ -208,6 +209,17 @@ struct compaction_descriptor {
     // timestamp comparison, similar to memtables, is performed.
     bool gc_check_only_compacting_sstables = false;
 
+    // If set to true, input sstables which don't overlap with any other input sstable,
+    // and hold no tombstones nor expiring data, are linked into the output run as they
+    // are, instead of being read and rewritten. Only regular compaction honors it, and
+    // it's meant for run-based strategies, which pick their input by runs rather than
+    // by the size of individual sstables.
+    bool copy_disjoint_sstables = false;
+
+    // If engaged, output sstables are created on this storage instead of the
+    // table's own storage. Used by TWCS to offload cold windows to object storage.
+    lw_shared_ptr<const data_dictionary::storage_options> output_storage;
+
     compaction_descriptor() = default;
 
     static constexpr int default_level = 0;
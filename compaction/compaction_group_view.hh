@@ -50,6 +50,8 @@ class compaction_group_view {
     virtual sstables::sstables_manager& get_sstables_manager() noexcept = 0;
     virtual sstables::shared_sstable make_sstable(sstables::sstable_state) const = 0;
     virtual sstables::shared_sstable make_sstable(sstables::sstable_state, sstables::sstable_version_types) const = 0;
+    // Makes a sstable on the given storage, rather than on the table's own storage.
+    virtual sstables::shared_sstable make_sstable(sstables::sstable_state, const data_dictionary::storage_options&) const = 0;
     virtual sstables::sstable_writer_config configure_writer(sstring origin) const = 0;
     virtual api::timestamp_type min_memtable_timestamp() const = 0;
     virtual api::timestamp_type min_memtable_live_timestamp() const = 0;
@@ -18,10 +18,12 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/metrics.hh>
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/coroutine/switch_to.hh>
 #include <seastar/coroutine/parallel_for_each.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 #include "sstables/sstable_directory.hh"
+#include "sstables/sstable_slicer.hh"
 #include "utils/assert.hh"
 #include "utils/error_injection.hh"
 #include "utils/UUID_gen.hh"
@@ -117,6 +119,40 @@ class compacting_sstable_registration {
     }
 };
 
+// Holds bytes of the node-wide compaction I/O budget, see compaction_manager::try_reserve_io_budget().
+class compaction_io_budget_registration {
+    compaction_manager* _cm = nullptr;
+    uint64_t _bytes = 0;
+public:
+    compaction_io_budget_registration() = default;
+    compaction_io_budget_registration(compaction_manager& cm, uint64_t bytes) noexcept
+        : _cm(&cm)
+        , _bytes(bytes)
+    { }
+
+    compaction_io_budget_registration(const compaction_io_budget_registration&) = delete;
+    compaction_io_budget_registration& operator=(const compaction_io_budget_registration&) = delete;
+
+    compaction_io_budget_registration(compaction_io_budget_registration&& other) noexcept
+        : _cm(std::exchange(other._cm, nullptr))
+        , _bytes(std::exchange(other._bytes, 0))
+    { }
+
+    compaction_io_budget_registration& operator=(compaction_io_budget_registration&& other) noexcept {
+        if (this != &other) {
+            this->~compaction_io_budget_registration();
+            new (this) compaction_io_budget_registration(std::move(other));
+        }
+        return *this;
+    }
+
+    ~compaction_io_budget_registration() {
+        if (_cm) {
+            _cm->release_io_budget(_bytes);
+        }
+    }
+};
+
 compaction_data compaction_manager::create_compaction_data() {
     compaction_data cdata = {};
     cdata.compaction_uuid = utils::UUID_gen::get_time_UUID();
@@ -236,6 +272,59 @@ void compaction_manager::deregister_weight(int weight) {
     reevaluate_postponed_compactions();
 }
 
+uint64_t compaction_manager::io_budget() const noexcept {
+    return uint64_t(_cfg.disk_bandwidth_mb_per_sec()) * 1024 * 1024 * io_budget_period.count();
+}
+
+future<std::optional<compaction_io_budget_registration>> compaction_manager::try_reserve_io_budget(uint64_t bytes) {
+    const auto budget = io_budget();
+    if (!budget) {
+        co_return compaction_io_budget_registration(*this, 0);
+    }
+    if (!co_await container().invoke_on(0, [bytes, budget] (compaction_manager& cm) {
+        return cm._io_budget.try_reserve(bytes, budget);
+    })) {
+        co_return std::nullopt;
+    }
+    co_return compaction_io_budget_registration(*this, bytes);
+}
+
+void compaction_manager::release_io_budget(uint64_t bytes) noexcept {
+    if (!bytes) {
+        return;
+    }
+    try {
+        // Jobs postponed for lack of budget may be on any shard.
+        (void)with_gate(_io_budget_gate, [this, bytes] {
+            return container().invoke_on(0, [bytes] (compaction_manager& cm) {
+                cm._io_budget.release(bytes);
+            }).then([this] {
+                return container().invoke_on_all([] (compaction_manager& cm) {
+                    cm.reevaluate_postponed_compactions();
+                });
+            });
+        }).handle_exception([bytes] (std::exception_ptr ep) {
+            cmlog.warn("Failed to release {} bytes of the compaction I/O budget: {}", bytes, ep);
+        });
+    } catch (...) {
+        // The gate is closed on shutdown, when the budget doesn't matter anymore.
+    }
+}
+
+// Estimates the benefit of a compaction job, to rank it against other pending jobs.
+static compaction_job_estimate estimate_compaction_job(const compaction_descriptor& descriptor, compaction_group_view& t) {
+    compaction_job_estimate estimate{
+        .input_bytes = descriptor.sstables_size(),
+        .fan_in = descriptor.fan_in(),
+    };
+    const auto now = gc_clock::now();
+    const auto gc_state = t.get_tombstone_gc_state();
+    for (const auto& sst : descriptor.sstables) {
+        estimate.reclaimable_bytes += sst->data_size() * sst->estimate_droppable_tombstone_ratio(now, gc_state, t.schema());
+    }
+    return estimate;
+}
+
 future<std::vector<sstables::shared_sstable>> in_strategy_sstables(compaction_group_view& table_s) {
     auto set = co_await table_s.main_sstable_set();
     auto sstables = set->all();
@@ -414,12 +503,28 @@ future<sstables::sstable_set> compaction_task_executor::sstable_set_for_tombston
 future<compaction_result> compaction_task_executor::compact_sstables(compaction_descriptor descriptor, ::compaction::compaction_data& cdata, on_replacement& on_replace, compaction_manager::can_purge_tombstones can_purge,
                                                                                sstables::offstrategy offstrategy) {
     compaction_group_view& t = *_compacting_table;
+    // The input sstables are deleted atomically, which is only possible
+    // within a storage, see sstables_manager::delete_atomically(). So the
+    // windows TWCS offloaded to object storage are left out of compactions
+    // which also take local sstables. They remain in the table's sstable set,
+    // for the purpose of tombstone garbage collection.
+    auto is_offloaded = [] (const sstables::shared_sstable& sst) { return sst->get_storage().is_object_storage(); };
+    if (std::ranges::any_of(descriptor.sstables, is_offloaded) && !std::ranges::all_of(descriptor.sstables, is_offloaded)) {
+        auto offloaded = descriptor.sstables | std::views::filter(is_offloaded)
+                | std::views::transform([] (const sstables::shared_sstable& sst) { return sst->get_filename(); })
+                | std::ranges::to<std::vector>();
+        cmlog.info("{} of {}: leaving offloaded sstables {} out of compaction of local sstables", _type, t, offloaded);
+        std::erase_if(descriptor.sstables, is_offloaded);
+    }
     if (can_purge) {
         descriptor.enable_garbage_collection(co_await sstable_set_for_tombstone_gc(t));
     }
-    descriptor.creator = [&t] (shard_id) {
+    descriptor.creator = [&t, output_storage = descriptor.output_storage] (shard_id) {
         // All compaction types going through this path will work on normal input sstables only.
         // Off-strategy, for example, waits until the sstables move out of staging state.
+        if (output_storage) {
+            return t.make_sstable(sstables::sstable_state::normal, *output_storage);
+        }
         return t.make_sstable(sstables::sstable_state::normal);
     };
     descriptor.replacer = [this, &t, &on_replace, offstrategy] (compaction_completion_desc desc) {
@@ -618,6 +723,21 @@ class major_compaction_task_executor : public compaction_task_executor, public m
         sstable_set_units.return_all();
         lock_holder.return_all();
 
+        // Majors of several shards, or of several tables, take turns in
+        // reading the disk they share.
+        const auto input_bytes = descriptor.sstables_size();
+        auto io_budget_r = co_await _cm.try_reserve_io_budget(input_bytes);
+        while (!io_budget_r) {
+            switch_state(state::pending);
+            try {
+                co_await sleep_abortable(std::chrono::seconds(1), _compaction_data.abort);
+            } catch (const sleep_aborted&) {
+                throw make_compaction_stopped_exception();
+            }
+            io_budget_r = co_await _cm.try_reserve_io_budget(input_bytes);
+        }
+        switch_state(state::active);
+
         co_await utils::get_local_injector().inject("major_compaction_wait", [this] (auto& handler) -> future<> {
             cmlog.info("major_compaction_wait: waiting");
             while (!handler.poll_for_message() && !_compaction_data.is_stop_requested()) {
@@ -899,8 +1019,9 @@ auto fmt::formatter<compaction::compaction_task_executor>::format(const compacti
 
 namespace compaction {
 
-inline compaction_controller make_compaction_controller(const compaction_manager::scheduling_group& csg, uint64_t static_shares, std::optional<float> max_shares, std::function<double()> fn) {
-    return compaction_controller(csg, static_shares, max_shares, 250ms, std::move(fn));
+inline compaction_controller make_compaction_controller(const compaction_manager::scheduling_group& csg, uint64_t static_shares, std::optional<float> max_shares, std::function<double()> fn,
+        compaction_controller::autotune_sampler sampler = {}) {
+    return compaction_controller(csg, static_shares, max_shares, 250ms, std::move(fn), std::move(sampler));
 }
 
 compaction::compaction_state::~compaction_state() {
@@ -1019,8 +1140,13 @@ compaction_stopped_exception compaction_task_executor::make_compaction_stopped_e
 
 class compaction_manager::strategy_control : public compaction::strategy_control {
     compaction_manager& _cm;
+    // Taking a hot range forgets about it, so only controls used to pick
+    // compactions which are actually run may take them.
+    bool _take_hot_read_ranges;
 public:
-    explicit strategy_control(compaction_manager& cm) noexcept : _cm(cm) {}
+    explicit strategy_control(compaction_manager& cm, bool take_hot_read_ranges = true) noexcept
+        : _cm(cm)
+        , _take_hot_read_ranges(take_hot_read_ranges) {}
 
     bool has_ongoing_compaction(compaction_group_view& table_s) const noexcept override {
         return std::any_of(_cm._tasks.begin(), _cm._tasks.end(), [&s = table_s.schema()] (const compaction_task_executor& task) {
@@ -1035,6 +1161,13 @@ class compaction_manager::strategy_control : public compaction::strategy_control
         co_return _cm.get_candidates(t, *main_set->all());
     }
 
+    std::optional<dht::token_range> take_hot_read_range(compaction_group_view& t) const override {
+        if (!_take_hot_read_ranges) {
+            return std::nullopt;
+        }
+        return _cm.take_hot_read_range(t);
+    }
+
     future<std::vector<sstables::frozen_sstable_run>> candidates_as_runs(compaction_group_view& t) const override {
         auto main_set = co_await t.main_sstable_set();
         co_await utils::get_local_injector().inject("regular_compaction_pause_after_snapshot",
@@ -1072,7 +1205,7 @@ compaction_manager::compaction_manager(config cfg, abort_source& as, tasks::task
             return compaction_controller::normalization_factor;
         }
         return b;
-    }))
+    }, [this] { return sample_for_autotune(); }))
     , _backlog_manager(_compaction_controller)
     , _early_abort_subscription(as.subscribe([this] () noexcept {
         do_stop();
@@ -1126,15 +1259,61 @@ void compaction_manager::register_metrics() {
                        sm::description("Holds the number of failed compaction tasks.")),
         sm::make_gauge("postponed_compactions", [this] { return _postponed.size(); },
                        sm::description("Holds the number of tables with postponed compaction.")),
+        sm::make_gauge("io_budget_in_flight_bytes", [this] { return _io_budget.in_flight(); },
+                       sm::description("Holds the input bytes of the compactions in flight on all shards, counted against the compaction I/O budget. Only tracked by shard 0.")),
         sm::make_gauge("backlog", [this] { return _last_backlog; },
                        sm::description("Holds the sum of compaction backlog for all tables in the system.")),
         sm::make_gauge("normalized_backlog", [this] { return _last_backlog / available_memory(); },
                        sm::description("Holds the sum of normalized compaction backlog for all tables in the system. Backlog is normalized by dividing backlog by shard's available memory.")),
         sm::make_counter("validation_errors", [this] { return _validation_errors; },
                        sm::description("Holds the number of encountered validation errors.")).set_skip_when_empty(),
+        sm::make_gauge("controller_shares", [this] { return _compaction_controller.autotuner_stats().shares; },
+                       sm::description("Holds the shares set by the compaction controller when tuning for a foreground latency target.")),
+        sm::make_gauge("controller_gain", [this] { return _compaction_controller.autotuner_stats().gain; },
+                       sm::description("Holds the factor applied by the compaction controller to the shares derived from the backlog.")),
+        sm::make_gauge("controller_throughput_per_share", [this] { return _compaction_controller.autotuner_stats().throughput_per_share; },
+                       sm::description("Holds the compaction throughput measured by the compaction controller, in bytes per second per share.")),
+        sm::make_gauge("controller_foreground_p99_latency", [this] { return _compaction_controller.autotuner_stats().foreground_p99.count(); },
+                       sm::description("Holds the p99 foreground latency, in microseconds, last seen by the compaction controller.")),
+        sm::make_counter("controller_latency_throttles", [this] { return _compaction_controller.autotuner_stats().latency_throttles; },
+                       sm::description("Holds the number of times the compaction controller decreased the shares to meet the foreground latency target.")),
+        sm::make_counter("controller_backlog_boosts", [this] { return _compaction_controller.autotuner_stats().backlog_boosts; },
+                       sm::description("Holds the number of times the compaction controller increased the shares, due to a growing backlog and foreground latency headroom.")),
     });
 }
 
+uint64_t compaction_manager::sample_compacted_bytes() {
+    uint64_t bytes = 0;
+    for (auto& task : _tasks) {
+        // Only regular compaction runs in the compaction scheduling group,
+        // whose shares are tuned. The other tasks run in the maintenance group.
+        if (task.compaction_type() == compaction_type::Compaction) {
+            bytes += task.sample_progress();
+        }
+    }
+    return bytes;
+}
+
+std::optional<compaction_shares_autotuner::sample> compaction_manager::sample_for_autotune() {
+    auto now = lowres_clock::now();
+    auto interval = now - std::exchange(_last_autotune_sample, now);
+    // Sample even when disabled, so the first sample after enabling covers a single interval.
+    auto compacted_bytes = sample_compacted_bytes();
+    auto foreground = _foreground_latency_source ? _foreground_latency_source() : foreground_latency_sample{};
+    auto target = _cfg.foreground_latency_target_us.get();
+    if (!target) {
+        return std::nullopt;
+    }
+    return compaction_shares_autotuner::sample{
+        .target = std::chrono::microseconds(target),
+        .backlog = _last_backlog,
+        .compacted_bytes = compacted_bytes,
+        .interval = interval,
+        .foreground_requests = foreground.requests,
+        .foreground_p99 = foreground.p99,
+    };
+}
+
 void compaction_manager::enable() {
     SCYLLA_ASSERT(_state == state::none || _state == state::running);
     cmlog.info("Asked to enable");
@@ -1176,10 +1355,16 @@ future<> compaction_manager::postponed_compactions_reevaluation() {
         // A task_state being reevaluated can re-insert itself into postponed list, which is the reason
         // for moving the list to be processed into a local.
         auto postponed = std::exchange(_postponed, {});
+        // Resubmit the tables whose postponed jobs are the most beneficial
+        // first, so they are the first to be admitted again.
+        auto ranked = postponed | std::ranges::to<std::vector>();
+        std::ranges::sort(ranked, std::greater<>(), [this] (compaction_group_view* t) {
+            auto it = _compaction_state.find(t);
+            return it != _compaction_state.end() ? it->second.postponed_benefit_per_byte : 0.0;
+        });
         try {
-            for (auto it = postponed.begin(); it != postponed.end();) {
-                compaction_group_view* t = *it;
-                it = postponed.erase(it);
+            for (auto* t : ranked) {
+                postponed.erase(t);
                 // skip reevaluation of a compaction_group_view that became invalid post its removal
                 if (!_compaction_state.contains(t)) {
                     continue;
@@ -1336,6 +1521,7 @@ future<> compaction_manager::really_do_stop() noexcept {
         on_fatal_internal_error(cmlog, format("{} tasks still exist after being stopped", _tasks.size()));
     }
     co_await stop_postponed_compactions();
+    co_await _io_budget_gate.close();
     co_await _sys_ks.close();
     _weight_tracker.clear();
     _compaction_submission_timer.cancel();
@@ -1480,11 +1666,26 @@ class regular_compaction_task_executor : public compaction_task_executor, public
                 cmlog.debug("{}: sstables={} can_proceed={} auto_compaction={}", *this, descriptor.sstables.size(), can_proceed(), t.is_auto_compaction_disabled_by_user());
                 co_return std::nullopt;
             }
+            const auto estimate = estimate_compaction_job(descriptor, t);
+            auto postpone = [&] {
+                switch_state(state::postponed);
+                _compaction_state.postponed_benefit_per_byte = estimate.benefit_per_byte();
+                _cm.postpone_compaction_for_table(&t);
+            };
             if (!_cm.can_register_compaction(t, weight, descriptor.fan_in())) {
                 cmlog.debug("Refused compaction job ({} sstable(s)) of weight {} for {}, postponing it...",
                     descriptor.sstables.size(), weight, t);
-                switch_state(state::postponed);
-                _cm.postpone_compaction_for_table(&t);
+                postpone();
+                co_return std::nullopt;
+            }
+            auto io_budget_r = co_await _cm.try_reserve_io_budget(estimate.input_bytes);
+            if (!io_budget_r) {
+                cmlog.debug("Refused compaction job ({} sstable(s), {} bytes) for {}, exceeding the I/O budget, postponing it...",
+                    descriptor.sstables.size(), estimate.input_bytes, t);
+                postpone();
+                co_return std::nullopt;
+            }
+            if (!can_proceed()) {
                 co_return std::nullopt;
             }
             auto compacting = compacting_sstable_registration(_cm, _cm.get_compaction_state(&t), descriptor.sstables);
@@ -1522,6 +1723,7 @@ class regular_compaction_task_executor : public compaction_task_executor, public
                     // the weight earlier to remove unnecessary
                     // serialization.
                     weight_r.deregister();
+                    io_budget_r = {};
                     co_await update_history(*_compacting_table, std::move(res), _compaction_data);
                 }
                 _cm.reevaluate_postponed_compactions();
@@ -1555,6 +1757,36 @@ void compaction_manager::submit(compaction_group_view& t) {
     (void)perform_compaction<regular_compaction_task_executor>(throw_if_stopping::no, tasks::task_info{}, t).then_wrapped([gh = std::move(gh)] (auto f) { f.ignore_ready_future(); });
 }
 
+void compaction_manager::note_read_fanout(compaction_group_view& t, dht::token token, unsigned sstables) noexcept {
+    const auto min_sstables = _cfg.hot_range_sstables_per_read();
+    if (!min_sstables || sstables < min_sstables) {
+        return;
+    }
+    auto it = _compaction_state.find(&t);
+    if (it == _compaction_state.end()) {
+        return;
+    }
+    if (it->second.read_fanout.record(t.token_range(), token, _cfg.hot_range_reads())) {
+        cmlog.debug("Reads of token {} in {} became hot, touching at least {} sstables", token, t, min_sstables);
+        try {
+            submit(t);
+        } catch (...) {
+            cmlog.warn("Failed to submit {} for compaction of a range hot with reads: {}", t, std::current_exception());
+        }
+    }
+}
+
+std::optional<dht::token_range> compaction_manager::take_hot_read_range(compaction_group_view& t) {
+    if (!_cfg.hot_range_sstables_per_read()) {
+        return std::nullopt;
+    }
+    auto it = _compaction_state.find(&t);
+    if (it == _compaction_state.end()) {
+        return std::nullopt;
+    }
+    return it->second.read_fanout.take_hottest_range(_cfg.hot_range_reads());
+}
+
 bool compaction_manager::can_perform_regular_compaction(compaction_group_view& t) {
     return can_proceed(&t) && !t.is_auto_compaction_disabled_by_user();
 }
@@ -1565,9 +1797,11 @@ future<> compaction_manager::maybe_wait_for_sstable_count_reduction(compaction_g
         cmlog.trace("maybe_wait_for_sstable_count_reduction in {}: cannot perform regular compaction", t);
         co_return;
     }
-    auto num_runs_for_compaction = [&, this] -> future<size_t> {
+    // Only estimates the pending work, so it must not take the hot read ranges.
+    strategy_control control(*this, false);
+    auto num_runs_for_compaction = [&] -> future<size_t> {
         auto cs = t.get_compaction_strategy();
-        auto desc = co_await cs.get_sstables_for_compaction(t, get_strategy_control());
+        auto desc = co_await cs.get_sstables_for_compaction(t, control);
         co_return std::ranges::size(desc.sstables
             | std::views::transform(std::mem_fn(&sstables::sstable::run_identifier))
             | std::ranges::to<std::unordered_set>());
@@ -1912,8 +2146,56 @@ class split_compaction_task_executor final : public rewrite_sstables_compaction_
         return make_descriptor(sst, _opt);
     }
 
+    // Splits the sstable by copying its partitions into a new sstable per
+    // token group, instead of compacting it, see sstables::slice_sstable().
+    // Returns std::nullopt if the sstable has to be compacted instead.
+    future<std::optional<compaction_result>> maybe_slice_sstable(const sstables::shared_sstable& sst) {
+        auto cfg = _compacting_table->configure_writer("split");
+        if (!_cm.slice_sstables_for_split() || !sstables::can_slice_sstable(*sst, cfg, sst->get_version())) {
+            co_return std::nullopt;
+        }
+        co_await coroutine::switch_to(_cm.maintenance_sg());
+
+        compaction_result res;
+        res.shard_id = this_shard_id();
+        res.type = compaction_type::Split;
+        res.stats.started_at = db_clock::now();
+        res.stats.start_size = sst->bytes_on_disk();
+        sstables::sstable_slices slices;
+        try {
+            slices = co_await sstables::slice_sstable(sst, _compacting_table->make_compaction_reader_permit(),
+                    [classifier = _opt.classifier] (dht::token t) -> std::optional<size_t> { return classifier(t); },
+                    [this, version = sst->get_version()] { return _compacting_table->make_sstable(sstables::sstable_state::normal, version); },
+                    cfg, _compaction_data.abort);
+        } catch (...) {
+            if (_compaction_data.is_stop_requested()) {
+                throw make_compaction_stopped_exception();
+            }
+            cmlog.warn("Failed to slice {} for split, compacting it instead: {}", sst->get_filename(), std::current_exception());
+            co_return std::nullopt;
+        }
+
+        compaction_completion_desc desc { .old_sstables = {sst}, .new_sstables = slices.sstables };
+        // See the bypass in do_rewrite_sstable() for why the lock is needed.
+        auto& cs = _cm.get_compaction_state(_compacting_table);
+        auto units = co_await get_units(cs.sstable_set_lock, 1);
+        co_await _compacting_table->on_compaction_completion(std::move(desc), sstables::offstrategy::no);
+
+        res.stats.ended_at = db_clock::now();
+        for (const auto& new_sst : slices.sstables) {
+            res.stats.end_size += new_sst->bytes_on_disk();
+        }
+        cmlog.info("Split {} into {} sstables by slicing: copied {} partitions, rewrote {}", sst->get_filename(), slices.sstables.size(),
+                slices.stats.copied_partitions, slices.stats.rewritten_partitions);
+        res.new_sstables = std::move(slices.sstables);
+        co_return res;
+    }
+
     future<compaction_result> do_rewrite_sstable(const sstables::shared_sstable sst) {
         if (sstable_needs_split(sst)) {
+            if (auto res = co_await maybe_slice_sstable(sst)) {
+                co_return std::move(*res);
+            }
             co_return co_await rewrite_sstables_compaction_task_executor::rewrite_sstable(std::move(sst));
         }
         // SSTable that doesn't require split can bypass compaction and the table will be able to place
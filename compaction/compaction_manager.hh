@@ -28,6 +28,7 @@
 #include "compaction/compaction_descriptor.hh"
 #include "compaction/task_manager_module.hh"
 #include "compaction_state.hh"
+#include "compaction_planner.hh"
 #include "strategy_control.hh"
 #include "backlog_controller.hh"
 #include "seastarx.hh"
@@ -59,6 +60,7 @@ class rewrite_sstables_component_compaction_task_executor;
 class split_compaction_task_executor;
 class cleanup_sstables_compaction_task_executor;
 class validate_sstables_compaction_task_executor;
+class compaction_io_budget_registration;
 
 inline owned_ranges_ptr make_owned_ranges_ptr(dht::token_range_vector&& ranges) {
     return make_lw_shared<const dht::token_range_vector>(std::move(ranges));
@@ -83,9 +85,26 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
         utils::updateable_value<float> static_shares = utils::updateable_value<float>(0);
         utils::updateable_value<float> max_shares = utils::updateable_value<float>(0);
         utils::updateable_value<uint32_t> throughput_mb_per_sec = utils::updateable_value<uint32_t>(0);
+        // p99 foreground latency the compaction controller tunes the shares for, 0 to use the static curve only.
+        utils::updateable_value<uint32_t> foreground_latency_target_us = utils::updateable_value<uint32_t>(0);
+        // Single-partition reads touching at least this many sstables count towards a hot range, 0 to disable.
+        utils::updateable_value<uint32_t> hot_range_sstables_per_read = utils::updateable_value<uint32_t>(0);
+        // The number of such reads, within a decay period, making a range hot.
+        utils::updateable_value<uint32_t> hot_range_reads = utils::updateable_value<uint32_t>(100);
+        // Split sstables by copying their partitions into the new sstables rather than by compacting them.
+        utils::updateable_value<bool> slice_sstables_for_split = utils::updateable_value<bool>(true);
+        // Disk bandwidth allotted to compaction on the whole node, 0 to not budget compaction I/O.
+        utils::updateable_value<uint32_t> disk_bandwidth_mb_per_sec = utils::updateable_value<uint32_t>(0);
         std::chrono::seconds flush_all_tables_before_major = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::days(1));
     };
 
+    // Foreground requests completed since the previous sample, and their p99 latency.
+    struct foreground_latency_sample {
+        uint64_t requests = 0;
+        std::chrono::microseconds p99{0};
+    };
+    using foreground_latency_source = std::function<foreground_latency_sample()>;
+
 public:
     class can_purge_tombstones_tag;
     using can_purge_tombstones = bool_class<can_purge_tombstones_tag>;
@@ -123,6 +142,9 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
     stats _stats;
     seastar::metrics::metric_groups _metrics;
     double _last_backlog = 0.0f;
+    // Used by the compaction controller to tune the shares, see compaction_shares_autotuner.
+    foreground_latency_source _foreground_latency_source;
+    lowres_clock::time_point _last_autotune_sample = lowres_clock::now();
 
     // Store sstables that are being compacted at the moment. That's needed to prevent
     // a sstable from being compacted twice.
@@ -136,6 +158,15 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
     // weight is value assigned to a compaction job that is log base N of total size of all input sstables.
     std::unordered_set<int> _weight_tracker;
 
+    // The compaction jobs running concurrently on all shards, so they compete
+    // for the same disk, are admitted within a budget of bytes they can read
+    // in io_budget_period at the configured bandwidth. Only the budget of
+    // shard 0 is used, see try_reserve_io_budget().
+    static constexpr std::chrono::seconds io_budget_period = std::chrono::minutes(5);
+    compaction_io_budget _io_budget;
+    // Held by the releases of the budget sent to shard 0.
+    seastar::gate _io_budget_gate;
+
     std::unordered_map<compaction::compaction_group_view*, compaction_state> _compaction_state;
 
     // Purpose is to serialize all maintenance (non regular) compaction activity to reduce aggressiveness and space requirement.
@@ -200,6 +231,16 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
     // Deregister weight for a table.
     void deregister_weight(int weight);
 
+    // The node-wide budget of compaction input bytes in flight, 0 if unlimited.
+    uint64_t io_budget() const noexcept;
+    // Reserves `bytes` of the node-wide budget. Returns a disengaged optional
+    // if the budget is used up by jobs in flight on any shard. Otherwise, the
+    // registration holds the bytes actually reserved, none if the budget is
+    // unlimited, until it is destroyed.
+    future<std::optional<compaction_io_budget_registration>> try_reserve_io_budget(uint64_t bytes);
+    // Returns bytes reserved by try_reserve_io_budget() to the budget.
+    void release_io_budget(uint64_t bytes) noexcept;
+
     // Get candidates for compaction strategy, which are all sstables but the ones being compacted.
     future<std::vector<sstables::shared_sstable>> get_candidates(compaction::compaction_group_view& t) const;
 
@@ -311,6 +352,10 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
 
     void register_metrics();
 
+    std::optional<compaction_shares_autotuner::sample> sample_for_autotune();
+    // Returns the bytes compacted by the running regular compactions since the previous call.
+    uint64_t sample_compacted_bytes();
+
     // enable the compaction manager.
     void enable();
 
@@ -335,6 +380,24 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
     // Submit a table to be compacted.
     void submit(compaction::compaction_group_view& t);
 
+    // Notifies about a single-partition read of the given token, which had to
+    // read from `sstables` sstables of the table. Submits the table for compaction
+    // when the reads touching many sstables make a token range hot.
+    void note_read_fanout(compaction::compaction_group_view& t, dht::token token, unsigned sstables) noexcept;
+
+    bool slice_sstables_for_split() const noexcept {
+        return _cfg.slice_sstables_for_split.get();
+    }
+
+    uint32_t hot_range_sstables_per_read() const noexcept {
+        return _cfg.hot_range_sstables_per_read.get();
+    }
+
+    // Returns the hottest token range of the table with respect to read fan-out,
+    // if any, such that the strategy can compact the sstables overlapping it.
+    // The range is forgotten until reads make it hot again.
+    std::optional<dht::token_range> take_hot_read_range(compaction::compaction_group_view& t);
+
     // Can regular compaction be performed in the given table
     bool can_perform_regular_compaction(compaction::compaction_group_view& t);
 
@@ -472,6 +535,11 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
         return _backlog_manager.backlog();
     }
 
+    // Set by the database to provide the latency of foreground requests to the compaction controller.
+    void set_foreground_latency_source(foreground_latency_source source) {
+        _foreground_latency_source = std::move(source);
+    }
+
     void register_backlog_tracker(compaction_backlog_tracker& backlog_tracker) {
         _backlog_manager.register_backlog_tracker(backlog_tracker);
     }
@@ -500,6 +568,7 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
 
     friend class compacting_sstable_registration;
     friend class compaction_weight_registration;
+    friend class compaction_io_budget_registration;
     friend class sstables::test_env_compaction_manager;
 
     friend class compaction::compaction_task_impl;
@@ -551,6 +620,8 @@ class compaction_task_executor
     sstables::run_id _output_run_identifier;
     sstring _description;
     compaction_manager::compaction_stats_opt _stats = std::nullopt;
+    // Progress at the last call to sample_compacted_bytes().
+    uint64_t _sampled_progress = 0;
 
 public:
     explicit compaction_task_executor(compaction_manager& mgr, throw_if_stopping do_throw_if_stopping, ::compaction::compaction_group_view* t, compaction_type type, sstring desc);
@@ -638,6 +709,15 @@ class compaction_task_executor
     const sstring& description() const noexcept {
         return _description;
     }
+
+    // Returns the bytes compacted since the previous call.
+    uint64_t sample_progress() noexcept {
+        auto progress = _progress_monitor.get_progress();
+        // The progress starts over with every compaction the task runs.
+        auto delta = progress >= _sampled_progress ? progress - _sampled_progress : progress;
+        _sampled_progress = progress;
+        return delta;
+    }
 private:
     // Before _compaction_done is set in compaction_task_executor::run_compaction(), compaction_done() returns ready future.
     future<compaction_manager::compaction_stats_opt> compaction_done() noexcept {
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace compaction {
+
+/// The estimated cost and benefit of a compaction job, used to rank the
+/// pending jobs of all the tables of a shard against each other.
+struct compaction_job_estimate {
+    // The cost: bytes read, and about as many written.
+    uint64_t input_bytes = 0;
+    // The number of input sstables (or runs), all but one of which are
+    // removed from the read path of the compacted range.
+    unsigned fan_in = 0;
+    // Bytes expected to be purged, e.g. droppable tombstones and the data they shadow.
+    uint64_t reclaimable_bytes = 0;
+
+    /// The sstables removed from the read path, plus the reclaimed space
+    /// expressed in input sstables of average size, per input byte.
+    double benefit_per_byte() const noexcept {
+        if (!input_bytes || !fan_in) {
+            return 0;
+        }
+        const double average_sstable_size = double(input_bytes) / fan_in;
+        const double benefit = double(fan_in - 1) + double(reclaimable_bytes) / average_sstable_size;
+        return benefit / double(input_bytes);
+    }
+};
+
+/// Node-wide budget of compaction input bytes in flight on a disk.
+///
+/// Kept by shard 0 on behalf of all shards, which share the disk. The budget
+/// is the number of bytes the disk can read in a given period at the bandwidth
+/// allotted to compaction, so the jobs running concurrently can complete in
+/// that period. A job larger than the whole budget is only admitted if no other
+/// job is in flight, so it can still make progress.
+class compaction_io_budget {
+    uint64_t _in_flight = 0;
+public:
+    bool try_reserve(uint64_t bytes, uint64_t budget) noexcept {
+        if (_in_flight && _in_flight + bytes > budget) {
+            return false;
+        }
+        _in_flight += bytes;
+        return true;
+    }
+
+    void release(uint64_t bytes) noexcept {
+        _in_flight -= std::min(bytes, _in_flight);
+    }
+
+    uint64_t in_flight() const noexcept {
+        return _in_flight;
+    }
+};
+
+} // namespace compaction
@@ -16,6 +16,7 @@
 
 #include "compaction/compaction_fwd.hh"
 #include "compaction/compaction_backlog_manager.hh"
+#include "compaction/read_fanout_tracker.hh"
 #include "gc_clock.hh"
 
 namespace compaction {
@@ -94,6 +95,13 @@ struct compaction_state {
 
     gc_clock::time_point last_regular_compaction;
 
+    // Benefit per byte of the last regular compaction job that was postponed,
+    // used to resubmit the postponed tables with the most beneficial jobs first.
+    double postponed_benefit_per_byte = 0;
+
+    // Where the single-partition reads touching many sstables are concentrated.
+    read_fanout_tracker read_fanout;
+
     explicit compaction_state(compaction_group_view& t);
     compaction_state(compaction_state&&) = delete;
     ~compaction_state();
@@ -31,6 +31,7 @@
 #include "utils/to_string.hh"
 #include "incremental_compaction_strategy.hh"
 #include "sstables/sstable_set_impl.hh"
+#include "strategy_control.hh"
 
 namespace compaction {
 
@@ -76,6 +77,98 @@ bool compaction_strategy_impl::worth_dropping_tombstones(const sstables::shared_
     return droppable_ratio >= _tombstone_threshold;
 }
 
+std::vector<sstables::shared_sstable>
+compaction_strategy_impl::get_sstables_for_tombstone_dense_range(const std::vector<sstables::shared_sstable>& candidates,
+        gc_clock::time_point compaction_time, const compaction_group_view& t, size_t max_sstables) {
+    if (_disable_tombstone_compaction || max_sstables == 0) {
+        return {};
+    }
+    const auto gc_state = t.get_tombstone_gc_state();
+    const auto now = db_clock::now();
+    sstables::shared_sstable densest_sst;
+    std::optional<dht::token_range> densest_range;
+    uint64_t densest_tombstones = 0;
+    for (const auto& sst : candidates) {
+        // See worth_dropping_tombstones() for why recently created sstables are ignored.
+        if (now - _tombstone_compaction_interval < sst->data_file_write_time()) {
+            continue;
+        }
+        const auto* sm = sst->get_scylla_metadata();
+        const auto* density = sm ? sm->get_tombstone_density() : nullptr;
+        if (!density) {
+            continue;
+        }
+        for (const auto& segment : density->elements) {
+            if (segment.tombstones <= densest_tombstones || segment.tombstones < _tombstone_threshold * segment.cells) {
+                continue;
+            }
+            auto range = dht::token_range(dht::token_range::bound(dht::token::from_int64(segment.first_token), true),
+                    dht::token_range::bound(dht::token::from_int64(segment.last_token), true));
+            auto gc_before = gc_state.get_gc_before_for_range(t.schema(), range, compaction_time).min_gc_before;
+            if (segment.max_local_deletion_time >= gc_before.time_since_epoch().count()) {
+                continue;
+            }
+            densest_sst = sst;
+            densest_range = std::move(range);
+            densest_tombstones = segment.tombstones;
+        }
+    }
+    if (!densest_range) {
+        return {};
+    }
+
+    std::vector<sstables::shared_sstable> overlapping;
+    for (const auto& sst : candidates) {
+        auto sst_range = dht::token_range(dht::token_range::bound(sst->get_first_decorated_key().token(), true),
+                dht::token_range::bound(sst->get_last_decorated_key().token(), true));
+        if (sst != densest_sst && sst_range.overlaps(*densest_range, dht::token_comparator())) {
+            overlapping.push_back(sst);
+        }
+    }
+    // Tombstones can only be purged if the data they may shadow is compacted
+    // with them, and older sstables are more likely to contain such data.
+    std::ranges::sort(overlapping, std::less<>(), [] (const sstables::shared_sstable& sst) {
+        return sst->get_stats_metadata().min_timestamp;
+    });
+    overlapping.resize(std::min(overlapping.size(), max_sstables - 1));
+    overlapping.push_back(std::move(densest_sst));
+    compaction_strategy_logger.debug("Compacting {} sstables overlapping token range {} with {} purgeable tombstones",
+            overlapping.size(), *densest_range, densest_tombstones);
+    return overlapping;
+}
+
+std::vector<sstables::shared_sstable>
+compaction_strategy_impl::get_sstables_for_hot_range(const std::vector<sstables::shared_sstable>& candidates,
+        compaction_group_view& t, strategy_control& control, size_t max_sstables) {
+    if (max_sstables < 2) {
+        return {};
+    }
+    auto hot_range = control.take_hot_read_range(t);
+    if (!hot_range) {
+        return {};
+    }
+    std::vector<sstables::shared_sstable> overlapping;
+    for (const auto& sst : candidates) {
+        auto sst_range = dht::token_range(dht::token_range::bound(sst->get_first_decorated_key().token(), true),
+                dht::token_range::bound(sst->get_last_decorated_key().token(), true));
+        if (sst_range.overlaps(*hot_range, dht::token_comparator())) {
+            overlapping.push_back(sst);
+        }
+    }
+    if (overlapping.size() < 2) {
+        return {};
+    }
+    // Every sstable merged away reduces the fan-out equally, so prefer the
+    // ones which are cheapest to rewrite.
+    std::ranges::sort(overlapping, std::less<>(), [] (const sstables::shared_sstable& sst) {
+        return sst->data_size();
+    });
+    overlapping.resize(std::min(overlapping.size(), max_sstables));
+    compaction_strategy_logger.debug("Compacting {} sstables overlapping token range {} hot with reads touching many sstables",
+            overlapping.size(), *hot_range);
+    return overlapping;
+}
+
 uint64_t compaction_strategy_impl::adjust_partition_estimate(const mutation_source_metadata& ms_meta, uint64_t partition_estimate, schema_ptr schema) const {
     return partition_estimate;
 }
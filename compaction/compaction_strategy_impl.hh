@@ -68,6 +68,25 @@ class compaction_strategy_impl {
     // droppable tombstone histogram and gc_before.
     bool worth_dropping_tombstones(const sstables::shared_sstable& sst, gc_clock::time_point compaction_time, const compaction_group_view& t);
 
+    // Looks, in the tombstone density metadata of the candidates, for the token
+    // range with the most tombstones among those whose tombstone ratio reaches the
+    // threshold and whose tombstones are all purgeable. Returns the candidates
+    // overlapping that range, such that the tombstones can be purged with the data
+    // they shadow, keeping the oldest ones if there are more than max_sstables.
+    // Returns an empty vector if there is no such range.
+    //
+    // Unlike worth_dropping_tombstones(), this finds tombstones concentrated in a
+    // small part of the token range of sstables with few tombstones overall.
+    std::vector<sstables::shared_sstable> get_sstables_for_tombstone_dense_range(const std::vector<sstables::shared_sstable>& candidates,
+            gc_clock::time_point compaction_time, const compaction_group_view& t, size_t max_sstables);
+
+    // Returns the candidates overlapping the token range whose single-partition reads
+    // repeatedly touch many sstables, if any, such that compacting them reduces the
+    // read fan-out in that range. The smallest ones are kept if there are more than
+    // max_sstables. Returns an empty vector if fewer than two candidates overlap it.
+    std::vector<sstables::shared_sstable> get_sstables_for_hot_range(const std::vector<sstables::shared_sstable>& candidates,
+            compaction_group_view& t, strategy_control& control, size_t max_sstables);
+
     virtual std::unique_ptr<compaction_backlog_tracker::impl> make_backlog_tracker() const = 0;
 
     virtual uint64_t adjust_partition_estimate(const mutation_source_metadata& ms_meta, uint64_t partition_estimate, schema_ptr schema) const;
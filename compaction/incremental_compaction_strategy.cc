@@ -318,6 +318,13 @@ incremental_compaction_strategy::find_garbage_collection_job(const compaction::c
     return compaction_descriptor(runs_to_sstables(std::move(input)), 0, _fragment_size);
 }
 
+compaction_descriptor
+incremental_compaction_strategy::make_merge_job(std::vector<sstables::frozen_sstable_run> runs) const {
+    auto desc = compaction_descriptor(runs_to_sstables(std::move(runs)), 0, _fragment_size);
+    desc.copy_disjoint_sstables = true;
+    return desc;
+}
+
 future<compaction_descriptor>
 incremental_compaction_strategy::get_sstables_for_compaction(compaction_group_view& t, strategy_control& control) {
     auto candidates = co_await control.candidates_as_runs(t);
@@ -330,12 +337,12 @@ incremental_compaction_strategy::get_sstables_for_compaction(compaction_group_vi
 
     if (is_any_bucket_interesting(buckets, min_threshold)) {
         std::vector<sstables::frozen_sstable_run> most_interesting = most_interesting_bucket(std::move(buckets), min_threshold, max_threshold);
-        co_return compaction_descriptor(runs_to_sstables(std::move(most_interesting)), 0, _fragment_size);
+        co_return make_merge_job(std::move(most_interesting));
     }
     // If we are not enforcing min_threshold explicitly, try any pair of sstable runs in the same tier.
     if (!t.compaction_enforce_min_threshold() && is_any_bucket_interesting(buckets, 2)) {
         std::vector<sstables::frozen_sstable_run> most_interesting = most_interesting_bucket(std::move(buckets), 2, max_threshold);
-        co_return compaction_descriptor(runs_to_sstables(std::move(most_interesting)), 0, _fragment_size);
+        co_return make_merge_job(std::move(most_interesting));
     }
 
     // The cross-tier behavior is only triggered once we're done with all the pending same-tier compaction to
@@ -383,8 +390,7 @@ incremental_compaction_strategy::get_sstables_for_compaction(compaction_group_vi
             cross_tier_input.reserve(cross_tier_input.size() + s1.size());
             std::move(s1.begin(), s1.end(), std::back_inserter(cross_tier_input));
 
-            co_return compaction_descriptor(runs_to_sstables(std::move(cross_tier_input)),
-                                                   0, _fragment_size);
+            co_return make_merge_job(std::move(cross_tier_input));
         }
     }
 
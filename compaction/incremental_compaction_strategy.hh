@@ -72,6 +72,10 @@ class incremental_compaction_strategy : public compaction_strategy_impl {
 
     compaction_descriptor find_garbage_collection_job(const compaction_group_view& t, std::vector<size_bucket_t>& buckets);
 
+    // Creates a job merging the given runs into a single one. Disjoint input sstables
+    // are linked into the output run rather than rewritten.
+    compaction_descriptor make_merge_job(std::vector<sstables::frozen_sstable_run> runs) const;
+
     static std::vector<sstables::shared_sstable> runs_to_sstables(std::vector<sstables::frozen_sstable_run> runs);
     static std::vector<sstables::frozen_sstable_run> sstables_to_runs(std::vector<sstables::shared_sstable> sstables);
     static void sort_run_bucket_by_first_key(size_bucket_t& bucket, size_t max_elements, const schema_ptr& schema);
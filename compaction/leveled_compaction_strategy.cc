@@ -47,8 +47,18 @@ future<compaction_descriptor> leveled_compaction_strategy::get_sstables_for_comp
     // a sstable which droppable data shadow data in older sstable, by starting from highest levels which
     // theoretically contain oldest non-overlapping data.
     auto compaction_time = gc_clock::now();
+    // sstable of the highest level with a token range dense with purgeable tombstones, compacted
+    // if no sstable has enough droppable tombstones as a whole. Sstables of a level don't overlap,
+    // so the range is compacted alone.
+    std::optional<compaction_descriptor> dense_range_job;
     for (auto level = int(manifest.get_level_count()); level >= 0; level--) {
         auto& sstables = manifest.get_level(level);
+        if (!dense_range_job) {
+            auto dense = get_sstables_for_tombstone_dense_range(sstables, compaction_time, table_s, 1);
+            if (!dense.empty()) {
+                dense_range_job.emplace(std::move(dense), level);
+            }
+        }
         // filter out sstables which droppable tombstone ratio isn't greater than the defined threshold.
         std::erase_if(sstables, [this, compaction_time, &table_s] (const sstables::shared_sstable& sst) -> bool {
             return !worth_dropping_tombstones(sst, compaction_time, table_s);
@@ -63,6 +73,9 @@ future<compaction_descriptor> leveled_compaction_strategy::get_sstables_for_comp
         });
         co_return compaction_descriptor({ sst }, sst->get_sstable_level());
     }
+    if (dense_range_job) {
+        co_return std::move(*dense_range_job);
+    }
     co_return compaction_descriptor();
 }
 
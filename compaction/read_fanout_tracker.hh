@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <optional>
+
+#include <seastar/core/lowres_clock.hh>
+#include "seastarx.hh"
+
+#include "dht/i_partitioner_fwd.hh"
+#include "dht/token.hh"
+
+namespace compaction {
+
+/// Tracks where in the token range of a compaction group the single-partition
+/// reads which had to touch many sstables (high read fan-out) are concentrated.
+///
+/// The token range of the group is divided into a fixed number of equally sized
+/// segments, each counting the high fan-out reads of partitions it contains.
+/// The counts are halved every decay period, so only ranges which are read
+/// repeatedly become hot. When a segment becomes hot, the compaction manager
+/// submits the group for compaction, and the strategy takes the hottest range
+/// to compact the sstables overlapping it.
+class read_fanout_tracker {
+public:
+    static constexpr size_t segments = 64;
+    static constexpr lowres_clock::duration decay_period = std::chrono::minutes(1);
+
+private:
+    dht::token_range _range = dht::token_range::make_open_ended_both_sides();
+    std::array<uint32_t, segments> _hot_reads{};
+    lowres_clock::time_point _last_decay = lowres_clock::now();
+
+    static int64_t first_token(const dht::token_range& r) noexcept {
+        if (r.start() && r.start()->value()._kind == dht::token::kind::key) {
+            return r.start()->value().raw();
+        }
+        return std::numeric_limits<int64_t>::min() + 1;
+    }
+
+    static int64_t last_token(const dht::token_range& r) noexcept {
+        if (r.end() && r.end()->value()._kind == dht::token::kind::key) {
+            return r.end()->value().raw();
+        }
+        return std::numeric_limits<int64_t>::max();
+    }
+
+    uint64_t segment_width() const noexcept {
+        return (uint64_t(last_token(_range)) - uint64_t(first_token(_range))) / segments + 1;
+    }
+
+    size_t segment_of(dht::token t) const noexcept {
+        auto offset = uint64_t(t.raw()) - uint64_t(first_token(_range));
+        return std::min<size_t>(offset / segment_width(), segments - 1);
+    }
+
+    dht::token_range segment_range(size_t i) const {
+        auto first = uint64_t(first_token(_range)) + i * segment_width();
+        auto last = i == segments - 1 ? uint64_t(last_token(_range)) : first + segment_width() - 1;
+        return dht::token_range(dht::token_range::bound(dht::token::from_int64(int64_t(first)), true),
+                dht::token_range::bound(dht::token::from_int64(int64_t(last)), true));
+    }
+
+    void decay(lowres_clock::time_point now) noexcept {
+        auto periods = (now - _last_decay) / decay_period;
+        if (periods <= 0) {
+            return;
+        }
+        for (auto& n : _hot_reads) {
+            n = periods < 32 ? n >> periods : 0;
+        }
+        _last_decay += periods * decay_period;
+    }
+
+public:
+    /// Records a high fan-out read of a partition with token `t`, in a group
+    /// owning `range`. The counts are reset if the range of the group changed
+    /// since, e.g. because its tablet was split.
+    ///
+    /// Returns true if this read made the segment of `t` reach `min_reads`.
+    bool record(const dht::token_range& range, dht::token t, uint32_t min_reads, lowres_clock::time_point now = lowres_clock::now()) {
+        if (!range.equal(_range, dht::token_comparator())) {
+            _range = range;
+            _hot_reads.fill(0);
+            _last_decay = now;
+        }
+        decay(now);
+        auto& n = _hot_reads[segment_of(t)];
+        if (n == std::numeric_limits<uint32_t>::max()) {
+            return false;
+        }
+        return ++n == min_reads;
+    }
+
+    /// Returns the token range of the segment with the most high fan-out reads,
+    /// if it has at least `min_reads` of them, and forgets about them, so the
+    /// range has to become hot again before it is returned anew.
+    std::optional<dht::token_range> take_hottest_range(uint32_t min_reads, lowres_clock::time_point now = lowres_clock::now()) {
+        decay(now);
+        auto it = std::ranges::max_element(_hot_reads);
+        if (*it == 0 || *it < min_reads) {
+            return std::nullopt;
+        }
+        *it = 0;
+        return segment_range(std::distance(_hot_reads.begin(), it));
+    }
+};
+
+} // namespace compaction
@@ -230,6 +230,13 @@ size_tiered_compaction_strategy::get_sstables_for_compaction(compaction_group_vi
         co_return compaction_descriptor(std::move(most_interesting));
     }
 
+    // No tier is worth compacting, but reads of some token range may still
+    // have to touch many sstables. Merge the ones overlapping that range.
+    auto hot_range_sstables = get_sstables_for_hot_range(candidates, table_s, control, max_threshold);
+    if (!hot_range_sstables.empty()) {
+        co_return compaction_descriptor(std::move(hot_range_sstables));
+    }
+
     if (!table_s.tombstone_gc_enabled()) {
         co_return compaction_descriptor();
     }
@@ -252,6 +259,13 @@ size_tiered_compaction_strategy::get_sstables_for_compaction(compaction_group_vi
         });
         co_return compaction_descriptor({ *it });
     }
+
+    // No sstable has enough droppable tombstones as a whole, try compacting the sstables
+    // overlapping a token range dense with purgeable tombstones.
+    auto sstables = get_sstables_for_tombstone_dense_range(candidates, compaction_time, table_s, max_threshold);
+    if (!sstables.empty()) {
+        co_return compaction_descriptor(std::move(sstables));
+    }
     co_return compaction_descriptor();
 }
 
@@ -21,6 +21,9 @@ class strategy_control {
     virtual bool has_ongoing_compaction(compaction_group_view& table_s) const noexcept = 0;
     virtual future<std::vector<sstables::shared_sstable>> candidates(compaction_group_view&) const = 0;
     virtual future<std::vector<sstables::frozen_sstable_run>> candidates_as_runs(compaction_group_view&) const = 0;
+    // The token range whose single-partition reads repeatedly touch many sstables, if any.
+    // Taking it resets its state, so it's returned again only after becoming hot again.
+    virtual std::optional<dht::token_range> take_hot_read_range(compaction_group_view&) const = 0;
 };
 
 }
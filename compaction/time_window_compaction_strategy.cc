@@ -116,6 +116,50 @@ static time_window_compaction_strategy_options::timestamp_resolutions validate_t
     return timestamp_resolution;
 }
 
+static int validate_offload_after_windows(const std::map<sstring, sstring>& options) {
+    auto tmp_value = compaction_strategy_impl::get_value(options, time_window_compaction_strategy_options::OFFLOAD_AFTER_WINDOWS_KEY);
+    int offload_after_windows = cql3::statements::property_definitions::to_long(time_window_compaction_strategy_options::OFFLOAD_AFTER_WINDOWS_KEY, tmp_value, 0);
+
+    if (offload_after_windows < 0) {
+        throw exceptions::configuration_exception(fmt::format("{} value ({}) must be non-negative", time_window_compaction_strategy_options::OFFLOAD_AFTER_WINDOWS_KEY, offload_after_windows));
+    }
+
+    return offload_after_windows;
+}
+
+static int validate_offload_after_windows(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options) {
+    int offload_after_windows = validate_offload_after_windows(options);
+    unchecked_options.erase(time_window_compaction_strategy_options::OFFLOAD_AFTER_WINDOWS_KEY);
+    return offload_after_windows;
+}
+
+static std::optional<data_dictionary::storage_options> validate_offload_storage(const std::map<sstring, sstring>& options, int offload_after_windows) {
+    auto endpoint = compaction_strategy_impl::get_value(options, time_window_compaction_strategy_options::OFFLOAD_STORAGE_ENDPOINT_KEY);
+    auto bucket = compaction_strategy_impl::get_value(options, time_window_compaction_strategy_options::OFFLOAD_STORAGE_BUCKET_KEY);
+
+    if (!endpoint && !bucket) {
+        if (offload_after_windows) {
+            throw exceptions::configuration_exception(fmt::format("{} requires {} and {}", time_window_compaction_strategy_options::OFFLOAD_AFTER_WINDOWS_KEY,
+                    time_window_compaction_strategy_options::OFFLOAD_STORAGE_ENDPOINT_KEY, time_window_compaction_strategy_options::OFFLOAD_STORAGE_BUCKET_KEY));
+        }
+        return std::nullopt;
+    }
+    if (!endpoint || !bucket) {
+        throw exceptions::configuration_exception(fmt::format("{} and {} must be set together",
+                time_window_compaction_strategy_options::OFFLOAD_STORAGE_ENDPOINT_KEY, time_window_compaction_strategy_options::OFFLOAD_STORAGE_BUCKET_KEY));
+    }
+    data_dictionary::storage_options so;
+    so.value = data_dictionary::storage_options::from_map(data_dictionary::storage_options::S3_NAME, {{"endpoint", *endpoint}, {"bucket", *bucket}});
+    return so;
+}
+
+static std::optional<data_dictionary::storage_options> validate_offload_storage(const std::map<sstring, sstring>& options, int offload_after_windows, std::map<sstring, sstring>& unchecked_options) {
+    auto offload_storage = validate_offload_storage(options, offload_after_windows);
+    unchecked_options.erase(time_window_compaction_strategy_options::OFFLOAD_STORAGE_ENDPOINT_KEY);
+    unchecked_options.erase(time_window_compaction_strategy_options::OFFLOAD_STORAGE_BUCKET_KEY);
+    return offload_storage;
+}
+
 time_window_compaction_strategy_options::time_window_compaction_strategy_options(const std::map<sstring, sstring>& options) {
     auto window_unit = validate_compaction_window_unit(options);
     int window_size = validate_compaction_window_size(options);
@@ -123,6 +167,8 @@ time_window_compaction_strategy_options::time_window_compaction_strategy_options
     sstable_window_size = window_size * window_unit;
     expired_sstable_check_frequency = validate_expired_sstable_check_frequency_seconds(options);
     timestamp_resolution = validate_timestamp_resolution(options);
+    offload_after_windows = validate_offload_after_windows(options);
+    offload_storage = validate_offload_storage(options, offload_after_windows);
 
     auto it = options.find("enable_optimized_twcs_queries");
     if (it != options.end() && it->second == "false") {
@@ -142,6 +188,8 @@ void time_window_compaction_strategy_options::validate(const std::map<sstring, s
     validate_compaction_window_size(options, unchecked_options);
     validate_expired_sstable_check_frequency_seconds(options, unchecked_options);
     validate_timestamp_resolution(options, unchecked_options);
+    auto offload_after_windows = validate_offload_after_windows(options, unchecked_options);
+    validate_offload_storage(options, offload_after_windows, unchecked_options);
     compaction_strategy_impl::validate_min_max_threshold(options, unchecked_options);
 
     auto it = options.find("enable_optimized_twcs_queries");
@@ -364,9 +412,56 @@ time_window_compaction_strategy::get_sstables_for_compaction(compaction_group_vi
 
     co_await utils::get_local_injector().inject("twcs_get_sstables_for_compaction", utils::wait_for_message(30s));
 
-    auto compaction_candidates = get_next_non_expired_sstables(table_s, control, std::move(candidates), compaction_time, *state);
+    auto compaction_candidates = get_next_non_expired_sstables(table_s, control, candidates, compaction_time, *state);
+    if (compaction_candidates.empty()) {
+        compaction_candidates = get_offload_candidates(table_s, std::move(candidates), *state);
+    }
     clogger.debug("[{}] Going to compact {} non-expired sstables", fmt::ptr(this), compaction_candidates.size());
-    co_return compaction_descriptor(std::move(compaction_candidates));
+    compaction_descriptor desc(std::move(compaction_candidates));
+    // Compactions of a cold window write to the offload storage, not to
+    // bring the window back to local storage.
+    if (!desc.sstables.empty() && _options.offload_after_windows) {
+        auto window = get_window_for(_options, desc.sstables.front()->get_stats_metadata().max_timestamp);
+        if (is_cold_bucket(window, *state)) {
+            desc.output_storage = make_lw_shared<const data_dictionary::storage_options>(*_options.offload_storage);
+        }
+    }
+    co_return desc;
+}
+
+bool time_window_compaction_strategy::is_cold_bucket(timestamp_type bucket_key, const time_window_compaction_strategy_state& state) const {
+    return _options.offload_after_windows
+            && bucket_key <= state.highest_window_seen - _options.offload_after_windows * get_window_size(_options);
+}
+
+std::vector<sstables::shared_sstable>
+time_window_compaction_strategy::get_offload_candidates(compaction_group_view& table_s,
+        std::vector<sstables::shared_sstable> candidate_sstables, const time_window_compaction_strategy_state& state) const {
+    if (!_options.offload_after_windows) {
+        return {};
+    }
+    // Windows which were already offloaded, or tables living on object
+    // storage in the first place, have nothing to offload.
+    std::erase_if(candidate_sstables, [] (const sstables::shared_sstable& sst) {
+        return sst->get_storage().is_object_storage();
+    });
+    auto [buckets, _] = get_buckets(std::move(candidate_sstables), _options);
+    // The oldest windows are the least likely to be written to again.
+    for (auto& [key, bucket] : buckets) {
+        if (!is_cold_bucket(key, state)) {
+            break;
+        }
+        clogger.debug("Offloading {} sstables of window {} to {}", bucket.size(), key, *_options.offload_storage);
+        return trim_to_threshold(std::move(bucket), table_s.schema()->max_compaction_threshold());
+    }
+    return {};
+}
+
+std::optional<data_dictionary::storage_options> time_window_compaction_strategy::offload_storage_options(const schema& s) {
+    if (s.compaction_strategy() != compaction_strategy_type::time_window) {
+        return std::nullopt;
+    }
+    return time_window_compaction_strategy_options(s.compaction_strategy_options()).get_offload_storage();
 }
 
 time_window_compaction_strategy::bucket_compaction_mode
@@ -14,6 +14,7 @@
 #include "size_tiered_compaction_strategy.hh"
 #include "mutation/timestamp.hh"
 #include "sstables/shared_sstable.hh"
+#include "data_dictionary/storage_options.hh"
 
 namespace compaction {
 
@@ -33,6 +34,9 @@ class time_window_compaction_strategy_options {
     static constexpr auto COMPACTION_WINDOW_UNIT_KEY = "compaction_window_unit";
     static constexpr auto COMPACTION_WINDOW_SIZE_KEY = "compaction_window_size";
     static constexpr auto EXPIRED_SSTABLE_CHECK_FREQUENCY_SECONDS_KEY = "expired_sstable_check_frequency_seconds";
+    static constexpr auto OFFLOAD_AFTER_WINDOWS_KEY = "offload_after_windows";
+    static constexpr auto OFFLOAD_STORAGE_ENDPOINT_KEY = "offload_storage_endpoint";
+    static constexpr auto OFFLOAD_STORAGE_BUCKET_KEY = "offload_storage_bucket";
 
     static const std::unordered_map<sstring, std::chrono::seconds> valid_window_units;
 
@@ -46,6 +50,12 @@ class time_window_compaction_strategy_options {
     db_clock::duration expired_sstable_check_frequency = DEFAULT_EXPIRED_SSTABLE_CHECK_FREQUENCY_SECONDS();
     timestamp_resolutions timestamp_resolution = timestamp_resolutions::microsecond;
     bool enable_optimized_twcs_queries{true};
+    // Windows older than the offload_after_windows most recent ones are moved
+    // to offload_storage. 0 disables offloading.
+    int offload_after_windows = 0;
+    // Object storage holding offloaded windows. Can be configured with offloading
+    // disabled, so windows which were already offloaded remain part of the table.
+    std::optional<data_dictionary::storage_options> offload_storage;
 public:
     time_window_compaction_strategy_options(const time_window_compaction_strategy_options&);
     time_window_compaction_strategy_options(time_window_compaction_strategy_options&&);
@@ -54,6 +64,7 @@ class time_window_compaction_strategy_options {
     static void validate(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options);
 public:
     std::chrono::seconds get_sstable_window_size() const { return sstable_window_size; }
+    const std::optional<data_dictionary::storage_options>& get_offload_storage() const { return offload_storage; }
 
     friend class time_window_compaction_strategy;
     friend class time_window_backlog_tracker;
@@ -88,6 +99,10 @@ class time_window_compaction_strategy : public compaction_strategy_impl {
     virtual std::vector<compaction_descriptor> get_cleanup_compaction_jobs(compaction_group_view& table_s, std::vector<sstables::shared_sstable> candidates) const override;
 
     static void validate_options(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options);
+
+    // The storage windows of the table are offloaded to, if the table uses TWCS
+    // and has offloading configured. Sstables found there belong to the table.
+    static std::optional<data_dictionary::storage_options> offload_storage_options(const schema& s);
 private:
     time_window_compaction_strategy_state_ptr get_state(compaction_group_view& table_s) const;
 
@@ -117,6 +132,13 @@ class time_window_compaction_strategy : public compaction_strategy_impl {
 
     std::vector<sstables::shared_sstable> get_compaction_candidates(compaction_group_view& table_s, strategy_control& control,
         std::vector<sstables::shared_sstable> candidate_sstables, time_window_compaction_strategy_state& state);
+
+    // Returns true if the window starting at bucket_key is to be offloaded.
+    bool is_cold_bucket(api::timestamp_type bucket_key, const time_window_compaction_strategy_state& state) const;
+
+    // Picks the local sstables of the oldest cold window, if any.
+    std::vector<sstables::shared_sstable> get_offload_candidates(compaction_group_view& table_s,
+        std::vector<sstables::shared_sstable> candidate_sstables, const time_window_compaction_strategy_state& state) const;
 public:
     // Find the lowest timestamp for window of given size
     static api::timestamp_type
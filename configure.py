@@ -560,6 +560,7 @@ scylla_tests = set([
     'test/boost/config_test',
     'test/boost/continuous_data_consumer_test',
     'test/boost/counter_test',
+    'test/boost/cow_chunked_vector_test',
     'test/boost/cql_auth_syntax_test',
     'test/boost/crc_test',
     'test/boost/dict_trainer_test',
@@ -908,6 +909,7 @@ scylla_core = (['message/messaging_service.cc',
                 'replica/multishard_query.cc',
                 'replica/mutation_dump.cc',
                 'replica/querier.cc',
+                'replica/query_result_cache.cc',
                 'replica/logstor/segment_io.cc',
                 'replica/logstor/segment_manager.cc',
                 'replica/logstor/logstor.cc',
@@ -993,6 +995,8 @@ scylla_core = (['message/messaging_service.cc',
                 'sstables/prepended_input_stream.cc',
                 'sstables/m_format_read_helpers.cc',
                 'sstables/sstable_directory.cc',
+                'sstables/sstable_slicer.cc',
+                'sstables/repair_hash_summary.cc',
                 'sstables/random_access_reader.cc',
                 'sstables/metadata_collector.cc',
                 'sstables/writer.cc',
@@ -1115,6 +1119,7 @@ scylla_core = (['message/messaging_service.cc',
                 'validation.cc',
                 'service/migration_manager.cc',
                 'service/tablet_allocator.cc',
+                'service/tablet_balancer_snapshot.cc',
                 'service/storage_proxy.cc',
                 'query_ranges_to_vnodes.cc',
                 'service/mapreduce_service.cc',
@@ -1580,6 +1585,7 @@ scylla_perfs = ['test/perf/perf_alternator.cc',
                 'test/perf/perf_simple_query.cc',
                 'test/perf/perf_cql_raw.cc',
                 'test/perf/perf_compaction_efficiency.cc',
+                'test/perf/perf_compaction_simulator.cc',
                 'test/perf/perf_sstable.cc',
                 'test/perf/perf_tablets.cc',
                 'test/perf/tablet_load_balancing.cc',
@@ -1609,6 +1615,7 @@ pure_boost_tests = set([
     'test/boost/checksum_utils_test',
     'test/boost/chunked_vector_test',
     'test/boost/compress_test',
+    'test/boost/cow_chunked_vector_test',
     'test/boost/cql_auth_syntax_test',
     'test/boost/crc_test',
     'test/boost/duration_test',
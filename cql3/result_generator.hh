@@ -118,11 +118,20 @@ class result_generator {
         , _stats(&stats)
     { }
 
+    // Visits the rows of the result. When the result is visited more than
+    // once, only one of the passes should account the rows as read.
     template<typename Visitor>
-    void visit(Visitor&& visitor) const {
+    void visit(Visitor&& visitor, bool account_rows_read = true) const {
         query_result_visitor<Visitor> v(*_schema, visitor, *_selection);
         query::result_view::consume(*_result, _command->slice, v);
-        _stats->rows_read += v.rows_read();
+        if (account_rows_read) {
+            _stats->rows_read += v.rows_read();
+        }
+    }
+
+    // The size of the serialized query result the rows are generated from.
+    size_t result_size() const {
+        return _result->buf().size();
     }
 };
 
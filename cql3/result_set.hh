@@ -264,13 +264,22 @@ class result {
         return *_result_set;
     }
 
+    // Returns the size of the query result the rows are generated from, or
+    // std::nullopt if the rows are materialized in a result set.
+    std::optional<size_t> generated_result_size() const {
+        if (_result_set) {
+            return std::nullopt;
+        }
+        return _result_generator.result_size();
+    }
+
     template<typename Visitor>
     requires ResultVisitor<Visitor>
-    void visit(Visitor&& visitor) const {
+    void visit(Visitor&& visitor, bool account_rows_read = true) const {
         if (_result_set) {
             _result_set->visit(std::forward<Visitor>(visitor));
         } else {
-            _result_generator.visit(std::forward<Visitor>(visitor));
+            _result_generator.visit(std::forward<Visitor>(visitor), account_rows_read);
         }
     }
 };
@@ -9,6 +9,7 @@
  */
 
 #include "cdc/log.hh"
+#include "compaction/time_window_compaction_strategy.hh"
 #include "index/external_index.hh"
 #include "types/types.hh"
 #include "utils/assert.hh"
@@ -452,6 +453,17 @@ std::pair<schema_ptr, std::vector<view_ptr>> alter_table_statement::prepare_sche
             }
 
             _properties->apply_to_builder(cfm, std::move(schema_extensions), db, keyspace(), !is_cdc_log_table);
+
+            // Windows of a TWCS table offloaded to object storage are found on boot
+            // through the offload storage options, so they must outlive the offloading.
+            if (auto offload_storage = compaction::time_window_compaction_strategy::offload_storage_options(*s)) {
+                auto new_offload_storage = compaction::time_window_compaction_strategy::offload_storage_options(*cfm.build());
+                if (!new_offload_storage || new_offload_storage->value != offload_storage->value) {
+                    throw exceptions::invalid_request_exception(format("Cannot change the compaction strategy or the offload storage of table {}.{}, "
+                            "since it may have windows offloaded to {}. Set {} to 0 to stop offloading",
+                            keyspace(), column_family(), *offload_storage, compaction::time_window_compaction_strategy_options::OFFLOAD_AFTER_WINDOWS_KEY));
+                }
+            }
         }
         break;
 
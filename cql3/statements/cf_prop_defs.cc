@@ -158,6 +158,13 @@ void cf_prop_defs::validate(const data_dictionary::database db, sstring ks_name,
         throw exceptions::configuration_exception("Per-partition rate limit is not supported yet by the whole cluster");
     }
 
+    // Nodes which don't know the query_results caching option fail to load
+    // a schema which has it.
+    auto caching = get_caching_options();
+    if (caching && caching->to_map().contains("query_results") && !db.features().query_result_cache) {
+        throw exceptions::configuration_exception("The query_results caching option cannot be used until all nodes in the cluster enable this feature");
+    }
+
     auto tombstone_gc_options = get_tombstone_gc_options(schema_extensions);
     validate_tombstone_gc_options(tombstone_gc_options, db, ks_name);
 
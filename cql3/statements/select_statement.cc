@@ -185,6 +185,11 @@ select_timeout(const restrictions::statement_restrictions& restrictions) {
     }
 }
 
+static uint64_t next_query_result_cache_id() {
+    static thread_local uint64_t id = 0;
+    return ++id;
+}
+
 select_statement::select_statement(schema_ptr schema,
                                    uint32_t bound_terms,
                                    lw_shared_ptr<const parameters> parameters,
@@ -215,6 +220,7 @@ select_statement::select_statement(schema_ptr schema,
     , _stats(stats)
     , _ks_sel(::is_internal_keyspace(schema->ks_name()) ? ks_selector::SYSTEM : ks_selector::NONSYSTEM)
     , _attrs(std::move(attrs))
+    , _query_result_cache_id(next_query_result_cache_id())
 {
     _opts = _selection->get_query_options();
     _opts.set_if<query::partition_slice::option::bypass_cache>(_parameters->bypass_cache());
@@ -937,6 +943,22 @@ select_statement::execute_without_checking_exception_message_non_aggregate_unpag
             return this->process_results(std::move(result), cmd, options, now);
         }));
     } else {
+        auto cache_key = make_query_result_cache_key(qp, partition_ranges, options);
+        if (cache_key) {
+            auto& cache = qp.proxy().get_db().local().get_query_result_cache();
+            if (auto cached = cache.lookup(*cache_key)) {
+                tracing::trace(state.get_trace_state(), "Serving result from the query result cache");
+                return process_results(make_foreign(std::move(cached)), cmd, options, now);
+            }
+            auto snapshot = cache.get_snapshot(cache_key->table, cache_key->token);
+            return qp.proxy().query_result(_query_schema, cmd, std::move(partition_ranges), options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state(), {}, {}, options.get_specific_options().node_local_only}, std::move(cas_shard))
+                .then(wrap_result_to_error_message([this, &qp, &options, now, cmd, cache_key = std::move(*cache_key), snapshot] (service::storage_proxy::coordinator_query_result qr) mutable {
+                    if (!qr.query_result->is_short_read()) {
+                        qp.proxy().get_db().local().get_query_result_cache().insert(std::move(cache_key), *qr.query_result, snapshot);
+                    }
+                    return this->process_results(std::move(qr.query_result), cmd, options, now);
+                }));
+        }
         return qp.proxy().query_result(_query_schema, cmd, std::move(partition_ranges), options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state(), {}, {}, options.get_specific_options().node_local_only}, std::move(cas_shard))
             .then(wrap_result_to_error_message([this, &options, now, cmd] (service::storage_proxy::coordinator_query_result qr) {
                 return this->process_results(std::move(qr.query_result), cmd, options, now);
@@ -944,6 +966,50 @@ select_statement::execute_without_checking_exception_message_non_aggregate_unpag
     }
 }
 
+// Results of a prepared, single-partition read are cached only if the read
+// is served by the local replica on this shard: the cache is invalidated by
+// the writes applied there, see replica::query_result_cache.
+std::optional<replica::query_result_cache::key>
+select_statement::make_query_result_cache_key(query_processor& qp, const dht::partition_range_vector& partition_ranges, const query_options& options) const {
+    if (!_schema->caching_options().query_results() || _parameters->bypass_cache() || _bound_terms == 0) {
+        return std::nullopt;
+    }
+    const auto cl = options.get_consistency();
+    if (cl != db::consistency_level::ONE && cl != db::consistency_level::LOCAL_ONE) {
+        return std::nullopt;
+    }
+    if (partition_ranges.size() != 1 || !query::is_single_partition(partition_ranges.front())) {
+        return std::nullopt;
+    }
+    if (!qp.proxy().get_db().local().get_query_result_cache().enabled()) {
+        return std::nullopt;
+    }
+    const auto token = partition_ranges.front().start()->value().token();
+    auto&& table = _schema->table();
+    if (table.shard_for_reads(token) != this_shard_id()) {
+        return std::nullopt;
+    }
+    auto erm = table.get_effective_replication_map();
+    if (!std::ranges::contains(erm->get_replicas_for_reading(token), erm->get_topology().my_host_id())) {
+        return std::nullopt;
+    }
+    std::vector<bytes_opt> values;
+    values.reserve(options.get_values_count());
+    for (size_t i = 0; i < options.get_values_count(); ++i) {
+        if (options.is_unset(i)) {
+            return std::nullopt;
+        }
+        values.push_back(to_bytes_opt(options.get_values()[i]));
+    }
+    return replica::query_result_cache::key{
+        .table = _schema->id(),
+        .schema_version = _query_schema->version(),
+        .statement_id = _query_result_cache_id,
+        .token = token,
+        .values = std::move(values),
+    };
+}
+
 future<shared_ptr<cql_transport::messages::result_message>>
 view_indexed_table_select_statement::process_base_query_results(
         foreign_ptr<lw_shared_ptr<query::result>> results,
@@ -21,6 +21,7 @@
 #include "exceptions/coordinator_result.hh"
 #include "locator/host_id.hh"
 #include "service/cas_shard.hh"
+#include "replica/query_result_cache.hh"
 
 namespace service {
     class client_state;
@@ -98,7 +99,11 @@ class select_statement : public cql_statement {
     bool _range_scan = false;
     bool _range_scan_no_bypass_cache = false;
     std::unique_ptr<cql3::attributes> _attrs;
+    // Identifies this statement in replica::query_result_cache.
+    const uint64_t _query_result_cache_id;
 private:
+    std::optional<replica::query_result_cache::key> make_query_result_cache_key(query_processor& qp,
+        const dht::partition_range_vector& partition_ranges, const query_options& options) const;
     future<shared_ptr<cql_transport::messages::result_message>> process_results_complex(foreign_ptr<lw_shared_ptr<query::result>> results,
         lw_shared_ptr<query::read_command> cmd, const query_options& options, gc_clock::time_point now) const;
     void detect_range_scan();
@@ -160,6 +165,8 @@ protected :
 
     bool has_group_by() const { return _group_by_cell_indices && !_group_by_cell_indices->empty(); }
 
+    bool has_limit() const { return _limit.has_value(); }
+
     db::timeout_clock::duration get_timeout(const service::client_state& state, const query_options& options) const;
 
 protected:
@@ -866,6 +866,12 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Log a warning when writing a collection containing more elements than this value.")
     , compaction_large_data_records_per_sstable(this, "compaction_large_data_records_per_sstable", liveness::LiveUpdate, value_status::Used, 10,
         "Maximum number of large data records per type to store in each SSTable's scylla metadata.")
+    , compaction_compression_helper_shards(this, "compaction_compression_helper_shards", liveness::LiveUpdate, value_status::Used, 0,
+        "Number of other shards which compress the data written by large compactions (1GB of input or more), in parallel with the shard running the compaction. "
+        "Set to 0 to compress on the compacting shard only.")
+    , enable_sstable_repair_hash_summary(this, "enable_sstable_repair_hash_summary", liveness::LiveUpdate, value_status::Used, false,
+        "Store a summary of the hashes of the data of each written SSTable, per token range, in its scylla metadata. "
+        "Tablet repair compares these summaries and skips the ranges whose data is already in sync on all replicas, without reading them.")
     /**
     * @Group Common memtable settings
     */
@@ -1016,6 +1022,13 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , stream_plan_ranges_fraction(this, "stream_plan_ranges_fraction", liveness::LiveUpdate, value_status::Used, 0.1,
         "Specify the fraction of ranges to stream in a single stream plan. Value is between 0 and 1.")
     , enable_file_stream(this, "enable_file_stream", liveness::LiveUpdate, value_status::Used, true, "Set true to use file based stream for tablet instead of mutation based stream")
+    , file_stream_trim_sstables(this, "file_stream_trim_sstables", liveness::LiveUpdate, value_status::Used, true,
+        "If set to true, file based streaming of a tablet sends only the partitions of the tablet of sstables which also hold partitions outside of it, by copying them into a new sstable without decoding them, instead of sending the whole sstable.")
+    , stream_transfer_concurrency_per_peer(this, "stream_transfer_concurrency_per_peer", liveness::LiveUpdate, value_status::Used, 1,
+        "The number of mutation fragment streams every shard opens in parallel to a peer when streaming a table. The ranges to stream are split into this many groups of contiguous ranges. The peer writes separate sstables for every stream, so more streams mean more sstables for the peer to compact."
+        " The sstables of different streams cover disjoint token ranges, but they are still compacted afterwards, like the sstables of a single stream.")
+    , stream_receive_shard_buffer_size_in_kb(this, "stream_receive_shard_buffer_size_in_kb", liveness::LiveUpdate, value_status::Used, 64,
+        "The amount of streamed data (in KiB) buffered for every shard of the receiving node, per incoming stream. A larger buffer lets the node keep writing sstables on all shards while one of them is slow. The buffers of all shards are allocated on the shard receiving the stream, and their memory is taken from the memory of streaming reads. Streams for which not enough of it is available use the default buffer size.")
     , trickle_fsync(this, "trickle_fsync", value_status::Unused, false,
         "When doing sequential writing, enabling this option tells fsync to force the operating system to flush the dirty buffers at a set interval trickle_fsync_interval_in_kb. Enable this parameter to avoid sudden dirty buffer flushing from impacting read latencies. Recommended to use on SSDs, but not on HDDs.")
     , trickle_fsync_interval_in_kb(this, "trickle_fsync_interval_in_kb", value_status::Unused, 10240,
@@ -1435,6 +1448,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , repair_multishard_reader_enable_read_ahead(this, "repair_multishard_reader_enable_read_ahead", liveness::LiveUpdate, value_status::Used, false,
         "The multishard reader has a read-ahead feature to improve latencies of range-scans. This feature can be detrimental when the multishard reader is used under repair, as is the case with repair in mixed-shard clusters."
         " This configuration option is disabled by default and it serves as a fall-back, to re-enable read-ahead in case it turns out that some mixed-shard repair suffer from disabling it.")
+    , repair_peer_bandwidth_mb_per_sec(this, "repair_peer_bandwidth_mb_per_sec", liveness::LiveUpdate, value_status::Used, 0,
+        "The bandwidth (in MiB/s) of the data a repair master lets every follower read from disk for it, split evenly among the shards of the master. The bandwidth is scaled by the headroom the follower reports, which is split among the masters repairing with it. Set to 0 to not limit the bandwidth; the number of ranges repaired in parallel and the size of the row buffers are scaled by the headroom of the followers regardless.")
     , enable_small_table_optimization_for_rbno(this, "enable_small_table_optimization_for_rbno", liveness::LiveUpdate, value_status::Used, true, "Set true to enable small table optimization for repair based node operations")
     , small_table_optimization_for_rbno_max_table_size(this, "small_table_optimization_for_rbno_max_table_size", liveness::LiveUpdate, value_status::Used, 1073741824, "Maximum on-disk size (in bytes) of a user table for it to be automatically eligible for the small table optimization for repair based node operations. The size is probed on the replicas the operation syncs from. Defaults to 1 GiB. Only takes effect when enable_small_table_optimization_for_rbno is true.")
     , ring_delay_ms(this, "ring_delay_ms", value_status::Used, 30 * 1000, "Time a node waits to hear from other nodes before joining the ring in milliseconds. Same as -Dcassandra.ring_delay_ms in cassandra.")
@@ -1528,6 +1543,17 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , max_clustering_key_restrictions_per_query(this, "max_clustering_key_restrictions_per_query", liveness::LiveUpdate, value_status::Used, 100,
             "Maximum number of distinct clustering key restrictions per query. This limit places a bound on the size of IN tuples, "
             "especially when multiple clustering key columns have IN restrictions. Increasing this value can result in server instability.")
+    , multi_partition_read_batching_threshold(this, "multi_partition_read_batching_threshold", liveness::LiveUpdate, value_status::Used, 16,
+            "Minimum number of partitions a single-partition-per-key read (e.g. SELECT ... WHERE pk IN (...)) must touch for the coordinator "
+            "to group the partitions by replica and send a single batched read to each replica, instead of one read per partition. "
+            "Only reads at consistency level ONE or LOCAL_ONE without read repair are batched. Set to 0 to disable batching.")
+    , query_result_cache_size_in_bytes(this, "query_result_cache_size_in_bytes", liveness::LiveUpdate, value_status::Used, uint64_t(8) << 20,
+            "Maximum amount of memory, per shard, used to cache the results of prepared single-partition SELECT statements on tables "
+            "which opted in with caching = {'query_results': 'true'}. Cached results are invalidated by writes to the partition. "
+            "Only reads at consistency level ONE or LOCAL_ONE served by the local replica are cached. Set to 0 to disable the cache.")
+    , query_result_cache_entry_ttl_in_ms(this, "query_result_cache_entry_ttl_in_ms", liveness::LiveUpdate, value_status::Used, 1000,
+            "Maximum time a result stays in the query result cache. Bounds the staleness of results which depend on the current time, "
+            "e.g. of partitions with expiring cells.")
     , max_memory_for_unlimited_query_soft_limit(this, "max_memory_for_unlimited_query_soft_limit", liveness::LiveUpdate, value_status::Used, uint64_t(1) << 20,
             "Maximum amount of memory a query, whose memory consumption is not naturally limited, is allowed to consume, e.g. non-paged and reverse queries. "
             "This is the soft limit, there will be a warning logged for queries violating this limit.")
@@ -1572,6 +1598,10 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Maximum number of concurrent requests a single shard can handle before it starts shedding extra load. By default, no requests will be shed.")
     , uninitialized_connections_semaphore_cpu_concurrency(this, "uninitialized_connections_semaphore_cpu_concurrency", liveness::LiveUpdate, value_status::Used, 8,
         "Maximum number of new concurrent connections from drivers that a single shard can be processing before it starts throttling incoming connections. This limit applies only to new connections excluding the ones blocked on network IO; connections that are ready to serve requests are not affected. By default the limit is 8.")
+    , native_transport_fast_lane_max_request_size(this, "native_transport_fast_lane_max_request_size", liveness::LiveUpdate, value_status::Used, 4096,
+        "EXECUTE requests of at most this many bytes, which execute a prepared single-partition SELECT restricting the clustering key or with a LIMIT, are admitted through a separate fast lane of the CQL transport,"
+        " with its own memory budget, so they don't queue behind large requests waiting for memory. Set to 0 to disable the fast lane."
+        " The memory budget of the fast lane is reserved out of the CQL transport's memory only if the fast lane is enabled when the CQL server starts.")
     , cdc_dont_rewrite_streams(this, "cdc_dont_rewrite_streams", value_status::Used, false,
             "Disable rewriting streams from cdc_streams_descriptions to cdc_streams_descriptions_v2. Should not be necessary, but the procedure is expensive and prone to failures; this config option is left as a backdoor in case some user requires manual intervention.")
     , strict_allow_filtering(this, "strict_allow_filtering", liveness::LiveUpdate, value_status::Used, strict_allow_filtering_default(), "Match Cassandra in requiring ALLOW FILTERING on slow queries. Can be true, false, or warn. When false, Scylla accepts some slow queries even without ALLOW FILTERING that Cassandra rejects. Warn is same as false, but with warning.")
@@ -1782,6 +1812,12 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Sets the maximum difference in percentages between the most loaded and least loaded nodes, below which the load balancer considers nodes balanced.")
     , minimal_tablet_size_for_balancing(this, "minimal_tablet_size_for_balancing", liveness::LiveUpdate, value_status::Used, service::default_target_tablet_size / 100,
         "Sets the minimal tablet size for the load balancer. For any tablet smaller than this, the balancer will use this size instead of the actual tablet size.")
+    , tablet_load_balancing_request_rate_weight(this, "tablet_load_balancing_request_rate_weight", liveness::LiveUpdate, value_status::Used, 0.5,
+        "Sets the weight, between 0 and 1, of the read and write request rates of tablets in the load equalized by the load balancer. The weight of tablet sizes is the rest. Set to 0 to balance storage utilization only.")
+    , tablet_load_balancing_hysteresis_percentage(this, "tablet_load_balancing_hysteresis_percentage", liveness::LiveUpdate, value_status::Used, 10.0,
+        "When request rates are part of the load, sets the minimal difference in percentages between the load of the source of a tablet migration and the load of its destination after the migration. Keeps tablets from moving back and forth as request rates fluctuate.")
+    , tablet_split_request_rate_threshold(this, "tablet_split_request_rate_threshold", liveness::LiveUpdate, value_status::Used, 0,
+        "Sets the rate of read and write requests per second, served by a replica of a tablet, above which the tablets of its table are split, regardless of their size. The hot tablets are split at the token which splits their requests in half. Merges of the tablets of a table are held off until the rates of all of them fall below a quarter of the threshold. Set to 0 to resize tablets based on their sizes only.")
     /**
     * @Group Ungrouped properties
     */
@@ -1795,6 +1831,16 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "If set to higher than 0, ignore the controller's output and set the compaction shares statically. Do not set this unless you know what you are doing and suspect a problem in the controller. This option will be retired when the controller reaches more maturity.")
     , compaction_max_shares(this, "compaction_max_shares", liveness::LiveUpdate, value_status::Used, default_compaction_maximum_shares,
         "Set the maximum shares of regular compaction to the specific value. Do not set this unless you know what you are doing and suspect a problem in the controller. This option will be retired when the controller reaches more maturity.")
+    , compaction_controller_foreground_latency_target_us(this, "compaction_controller_foreground_latency_target_us", liveness::LiveUpdate, value_status::Used, 0,
+        "If set to higher than 0, the compaction controller measures the compaction throughput and the p99 latency of replica reads, and tunes the compaction shares derived from the backlog to keep that latency below this target, in microseconds, while keeping the backlog bounded. Ignored if compaction_static_shares is set.")
+    , compaction_hot_range_sstables_per_read(this, "compaction_hot_range_sstables_per_read", liveness::LiveUpdate, value_status::Used, 0,
+        "If set to higher than 0, single-partition reads which have to read from at least this many sstables are tracked per token range. When such reads of a token range become frequent, see compaction_hot_range_reads, the sstables overlapping it are compacted together to reduce the number of sstables its reads touch. Only the size-tiered compaction strategy acts on such ranges.")
+    , compaction_hot_range_reads(this, "compaction_hot_range_reads", liveness::LiveUpdate, value_status::Used, 100,
+        "The number of reads touching at least compaction_hot_range_sstables_per_read sstables which make a token range hot, and its overlapping sstables eligible for compaction. The count of each range is halved every minute.")
+    , compaction_slice_sstables_for_split(this, "compaction_slice_sstables_for_split", liveness::LiveUpdate, value_status::Used, true,
+        "If set to true, sstables are split for tablet splits by copying their partitions as they are into the new sstables, generating only the index, filter and statistics of the latter, instead of compacting them. Sstables written in an older format or for an older schema are still compacted.")
+    , compaction_disk_bandwidth_mb_per_sec(this, "compaction_disk_bandwidth_mb_per_sec", liveness::LiveUpdate, value_status::Used, 0,
+        "If set to higher than 0, the disk bandwidth in MB/s that compaction can use on the whole node. Compactions of all shards and tables are then only started while the input of those running together can be read within 5 minutes at this bandwidth, preferring the jobs which reduce the number of sstables or reclaim space the most per byte compacted. A larger compaction is started only when no other one runs. Unlike compaction_throughput_mb_per_sec, this doesn't throttle compactions, it limits how many run concurrently.")
     , compaction_enforce_min_threshold(this, "compaction_enforce_min_threshold", liveness::LiveUpdate, value_status::Used, false,
         "If set to true, enforce the min_threshold option for compactions strictly. If false (default), Scylla may decide to compact even if below min_threshold.")
     , compaction_flush_all_tables_before_major_seconds(this, "compaction_flush_all_tables_before_major_seconds", value_status::Used, 86400,
@@ -242,6 +242,8 @@ class config final : public utils::config_file {
     named_value<uint32_t> compaction_rows_count_warning_threshold;
     named_value<uint32_t> compaction_collection_elements_count_warning_threshold;
     named_value<uint32_t> compaction_large_data_records_per_sstable;
+    named_value<uint32_t> compaction_compression_helper_shards;
+    named_value<bool> enable_sstable_repair_hash_summary;
     named_value<uint32_t> memtable_total_space_in_mb;
     named_value<uint32_t> concurrent_reads;
     named_value<uint32_t> concurrent_writes;
@@ -291,6 +293,9 @@ class config final : public utils::config_file {
     named_value<uint32_t> stream_io_throughput_mb_per_sec;
     named_value<double> stream_plan_ranges_fraction;
     named_value<bool> enable_file_stream;
+    named_value<bool> file_stream_trim_sstables;
+    named_value<uint32_t> stream_transfer_concurrency_per_peer;
+    named_value<uint32_t> stream_receive_shard_buffer_size_in_kb;
     named_value<bool> trickle_fsync;
     named_value<uint32_t> trickle_fsync_interval_in_kb;
     named_value<bool> auto_bootstrap;
@@ -420,6 +425,7 @@ class config final : public utils::config_file {
     named_value<uint32_t> repair_hints_batchlog_flush_cache_time_in_ms;
     named_value<uint64_t> repair_multishard_reader_buffer_hint_size;
     named_value<uint64_t> repair_multishard_reader_enable_read_ahead;
+    named_value<uint32_t> repair_peer_bandwidth_mb_per_sec;
     named_value<bool> enable_small_table_optimization_for_rbno;
     named_value<uint64_t> small_table_optimization_for_rbno_max_table_size;
     named_value<uint32_t> ring_delay_ms;
@@ -477,6 +483,9 @@ class config final : public utils::config_file {
     named_value<bool> abort_on_malformed_sstable_error;
     named_value<uint32_t> max_partition_key_restrictions_per_query;
     named_value<uint32_t> max_clustering_key_restrictions_per_query;
+    named_value<uint32_t> multi_partition_read_batching_threshold;
+    named_value<uint64_t> query_result_cache_size_in_bytes;
+    named_value<uint32_t> query_result_cache_entry_ttl_in_ms;
     named_value<uint64_t> max_memory_for_unlimited_query_soft_limit;
     named_value<uint64_t> max_memory_for_unlimited_query_hard_limit;
     named_value<uint32_t> reader_concurrency_semaphore_serialize_limit_multiplier;
@@ -498,6 +507,7 @@ class config final : public utils::config_file {
     named_value<uint32_t> schema_registry_grace_period;
     named_value<uint32_t> max_concurrent_requests_per_shard;
     named_value<uint32_t> uninitialized_connections_semaphore_cpu_concurrency;
+    named_value<uint32_t> native_transport_fast_lane_max_request_size;
     named_value<bool> cdc_dont_rewrite_streams;
     named_value<tri_mode_restriction> strict_allow_filtering;
     named_value<tri_mode_restriction> strict_is_not_null_in_views;
@@ -659,12 +669,20 @@ class config final : public utils::config_file {
     named_value<bool> force_capacity_based_balancing;
     named_value<float> size_based_balance_threshold_percentage;
     named_value<uint64_t> minimal_tablet_size_for_balancing;
+    named_value<float> tablet_load_balancing_request_rate_weight;
+    named_value<float> tablet_load_balancing_hysteresis_percentage;
+    named_value<float> tablet_split_request_rate_threshold;
 
     named_value<double> background_writer_scheduling_quota;
     named_value<bool> auto_adjust_flush_quota;
     named_value<float> memtable_flush_static_shares;
     named_value<float> compaction_static_shares;
     named_value<float> compaction_max_shares;
+    named_value<uint32_t> compaction_controller_foreground_latency_target_us;
+    named_value<uint32_t> compaction_hot_range_sstables_per_read;
+    named_value<uint32_t> compaction_hot_range_reads;
+    named_value<bool> compaction_slice_sstables_for_split;
+    named_value<uint32_t> compaction_disk_bandwidth_mb_per_sec;
     named_value<bool> compaction_enforce_min_threshold;
     named_value<uint32_t> compaction_flush_all_tables_before_major_seconds;
 
@@ -140,6 +140,9 @@ class feature_service final : public peering_sharded_service<feature_service> {
 
     gms::feature tablet_migration_virtual_task { *this, "TABLET_MIGRATION_VIRTUAL_TASK"sv };
     gms::feature tablet_resize_virtual_task { *this, "TABLET_RESIZE_VIRTUAL_TASK"sv };
+    // Tablets can be split at other tokens than their midpoints, persisted
+    // in the split_tokens column of system.tablets.
+    gms::feature tablet_split_tokens { *this, "TABLET_SPLIT_TOKENS"sv };
 
     // A feature just for use in tests. It must not be advertised unless
     // the "features_enable_test_feature" injection is enabled.
@@ -195,6 +198,20 @@ class feature_service final : public peering_sharded_service<feature_service> {
     // RPCs (and their warnings) to nodes that do not register the verb during a
     // rolling upgrade.
     gms::feature small_table_optimization_size_probe { *this, "SMALL_TABLE_OPTIMIZATION_SIZE_PROBE"sv };
+    // Gates the read_data_batch RPC verb, which carries all the partitions of
+    // a multi-partition read that are served by the same replica.
+    gms::feature batched_singular_reads { *this, "BATCHED_SINGULAR_READS"sv };
+    // Gates the query_results caching option of tables. Nodes which don't
+    // support it reject it as an invalid caching option.
+    gms::feature query_result_cache { *this, "QUERY_RESULT_CACHE"sv };
+    // Gates the repair_get_row_hash_tree RPC verb, which the repair master
+    // uses to find the rows that differ between its working row buf and the
+    // one of a follower without transferring all their row hashes.
+    gms::feature repair_row_hash_tree { *this, "REPAIR_ROW_HASH_TREE"sv };
+    // Gates the repair_get_range_hash_digest RPC verb, which the repair master
+    // uses to skip the ranges whose data is already in sync on all the nodes,
+    // according to the RepairHashSummary of their sstables.
+    gms::feature repair_hash_summaries { *this, "REPAIR_HASH_SUMMARIES"sv };
 public:
 
     const std::unordered_map<sstring, std::reference_wrapper<feature>>& registered_features() const;
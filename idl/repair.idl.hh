@@ -37,6 +37,7 @@ struct get_sync_boundary_response {
     uint64_t row_buf_size;
     uint64_t new_rows_size;
     uint64_t new_rows_nr;
+    std::optional<double> headroom [[version 2026.3]];
 };
 
 enum class row_level_diff_detect_algorithm : uint8_t {
@@ -55,6 +56,27 @@ enum class repair_stream_cmd : uint8_t {
     put_rows_done,
 };
 
+struct repair_row_hash_tree_request {
+    uint32_t level;
+    std::vector<uint64_t> expand;
+    std::vector<uint64_t> fetch;
+};
+
+struct repair_row_hash_tree_bucket {
+    repair_hash combined_hash;
+    uint64_t rows;
+};
+
+struct repair_row_hash_tree_response {
+    std::vector<repair_row_hash_tree_bucket> children;
+    repair_hash_set hashes;
+};
+
+struct repair_range_hash_digest {
+    uint64_t hash;
+    uint64_t fragments;
+};
+
 struct repair_hash_with_cmd {
     repair_stream_cmd cmd;
     repair_hash hash;
@@ -120,3 +142,5 @@ verb [[with_client_info]] repair_get_diff_algorithms () -> std::vector<row_level
 verb [[with_client_info]] repair_update_compaction_ctrl (locator::global_tablet_id gid, service::frozen_topology_guard topo_guard);
 verb [[with_client_info]] repair_update_repaired_at_for_merge(table_id);
 verb [[with_client_info]] repair_get_table_size(table_id table) -> uint64_t;
+verb [[with_client_info]] repair_get_row_hash_tree (uint32_t repair_meta_id, repair_row_hash_tree_request req [[ref]], shard_id dst_shard_id) -> repair_row_hash_tree_response;
+verb [[with_client_info]] repair_get_range_hash_digest (uint32_t repair_meta_id, shard_id dst_shard_id) -> std::optional<repair_range_hash_digest>;
@@ -42,11 +42,24 @@ struct tablet_load_stats final {
     std::unordered_map<::table_id, std::unordered_map<dht::token_range, uint64_t>> tablet_sizes;
 };
 
+struct tablet_request_rate final {
+    double reads;
+    double writes;
+    std::optional<dht::token> median_token;
+};
+
+struct tablet_request_stats final {
+    // Contains tablet request rates per table. The token ranges must be in
+    // the form (a, b] and only such ranges are allowed
+    std::unordered_map<::table_id, std::unordered_map<dht::token_range, locator::tablet_request_rate>> tablet_rates;
+};
+
 struct load_stats {
     std::unordered_map<::table_id, locator::table_load_stats> tables;
     std::unordered_map<locator::host_id, uint64_t> capacity;
     std::unordered_map<locator::host_id, bool> critical_disk_utilization [[version 2025.3]];
     std::unordered_map<locator::host_id, locator::tablet_load_stats> tablet_stats [[version 2026.1]];
+    std::unordered_map<locator::host_id, locator::tablet_request_stats> request_stats [[version 2026.3]];
 };
 
 }
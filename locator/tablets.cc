@@ -464,8 +464,32 @@ future<> tablet_metadata::mutate_tablet_map_async(table_id id, noncopyable_funct
 
 future<tablet_metadata> tablet_metadata::copy() const {
     tablet_metadata copy;
+
+    // The tablet maps are shared, only the pointers to them are copied, on the shard
+    // which owns them. That's shard 0, so when token metadata is replicated, every shard
+    // would send a message to shard 0 for every table. Send a single message per owner instead.
+    std::vector<std::vector<const table_to_tablet_map::value_type*>> tables_per_shard(this_smp_shard_count());
     for (const auto& e : _tablets) {
-        copy._tablets.emplace(e.first, co_await e.second.copy());
+        tables_per_shard[e.second.get_owner_shard()].push_back(&e);
+    }
+    for (shard_id shard = 0; shard < tables_per_shard.size(); ++shard) {
+        const auto& tables = tables_per_shard[shard];
+        if (tables.empty()) {
+            continue;
+        }
+        auto maps = co_await smp::submit_to(shard, coroutine::lambda([&tables] () -> future<std::vector<tablet_map_ptr>> {
+            std::vector<tablet_map_ptr> maps;
+            maps.reserve(tables.size());
+            for (auto e : tables) {
+                // Doesn't cross shards, we are on the owner.
+                maps.push_back(co_await e->second.copy());
+            }
+            co_return maps;
+        }));
+        for (size_t i = 0; i < tables.size(); ++i) {
+            copy._tablets.emplace(tables[i]->first, std::move(maps[i]));
+        }
+        co_await coroutine::maybe_yield();
     }
 
     copy._table_groups = _table_groups;
@@ -634,12 +658,8 @@ tablet_map tablet_map::clone() const {
 future<tablet_map> tablet_map::clone_gently() const {
     auto ids = co_await _tablet_ids.clone_gently();
 
-    tablet_container tablets;
-    tablets.reserve(_tablets.size());
-    for (const auto& t : _tablets) {
-        tablets.emplace_back(t);
-        co_await coroutine::maybe_yield();
-    }
+    // Shares the tablets with this map, they are copied when modified.
+    tablet_container tablets = _tablets;
 
     transitions_map transitions;
     transitions.reserve(_transitions.size());
@@ -676,6 +696,12 @@ tablet_id tablet_map::get_tablet_id(token t) const {
 }
 
 dht::token tablet_map::get_split_token(tablet_id id) const {
+    if (auto* split = std::get_if<resize_decision::split>(&_resize_decision.way); split && !split->split_tokens.empty()) {
+        auto it = std::ranges::lower_bound(split->split_tokens, id, std::less<>(), [] (const auto& e) { return e.first; });
+        if (it != split->split_tokens.end() && it->first == id) {
+            return it->second;
+        }
+    }
     auto last = get_last_token(id);
     auto prev_last = id == first_tablet() ? dht::minimum_token() : get_last_token(tablet_id(size_t(id) - 1));
     return token::midpoint(prev_last, last);
@@ -802,13 +828,13 @@ const utils::chunked_vector<dht::raw_token>& tablet_map::get_sorted_raw_tokens()
 
 void tablet_map::set_tablet(tablet_id id, tablet_info info) {
     check_tablet_id(id);
-    _tablets[size_t(id)] = std::move(info);
+    _tablets.mutable_at(size_t(id)) = std::move(info);
 }
 
 void tablet_map::emplace_tablet(tablet_id id, dht::token last_token, tablet_info info) {
     check_tablet_id(id);
     _tablet_ids.push_back(last_token, id);
-    _tablets[size_t(id)] = std::move(info);
+    _tablets.mutable_at(size_t(id)) = std::move(info);
 }
 
 void tablet_map::set_tablet_transition_info(tablet_id id, tablet_transition_info info) {
@@ -1146,6 +1172,14 @@ uint64_t tablet_load_stats::add_tablet_sizes(const tablet_load_stats& tls) {
     return table_sizes_sum;
 }
 
+void tablet_request_stats::add_tablet_rates(const tablet_request_stats& trs) {
+    for (auto& [table, rates] : trs.tablet_rates) {
+        for (auto& [range, rate] : rates) {
+            tablet_rates[table][range] = rate;
+        }
+    }
+}
+
 load_stats load_stats::from_v1(load_stats_v1&& stats) {
     return { .tables = std::move(stats.tables) };
 }
@@ -1192,6 +1226,9 @@ load_stats& load_stats::operator+=(const load_stats& s) {
         tablet_stats[host].effective_capacity = tablet_ls.effective_capacity;
         tablet_stats[host].add_tablet_sizes(tablet_ls);
     }
+    for (auto& [host, request_ls] : s.request_stats) {
+        request_stats[host].add_tablet_rates(request_ls);
+    }
     return *this;
 }
 
@@ -1209,6 +1246,33 @@ std::optional<uint64_t> load_stats::get_tablet_size(host_id host, const range_ba
     return std::nullopt;
 }
 
+std::optional<tablet_request_rate> load_stats::get_tablet_request_rate(host_id host, const range_based_tablet_id& rb_tid) const {
+    if (auto host_i = request_stats.find(host); host_i != request_stats.end()) {
+        auto& rates_per_table = host_i->second.tablet_rates;
+        if (auto table_i = rates_per_table.find(rb_tid.table); table_i != rates_per_table.end()) {
+            auto& tablet_rates = table_i->second;
+            if (auto rate_i = tablet_rates.find(rb_tid.range); rate_i != tablet_rates.end()) {
+                return rate_i->second;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<tablet_request_rate> load_stats::get_tablet_request_rate_in_transition(host_id host, const range_based_tablet_id& rb_tid, const tablet_info& ti, const tablet_transition_info* trinfo) const {
+    if (auto rate = get_tablet_request_rate(host, rb_tid)) {
+        return rate;
+    }
+    // The pending replica of a migration takes over the requests of the leaving replica.
+    if (trinfo && trinfo->transition == tablet_transition_kind::migration
+            && trinfo->pending_replica && trinfo->pending_replica->host == host) {
+        if (auto leaving_replica = get_leaving_replica(ti, *trinfo)) {
+            return get_tablet_request_rate(leaving_replica->host, rb_tid);
+        }
+    }
+    return std::nullopt;
+}
+
 std::optional<uint64_t> load_stats::get_avg_tablet_size(const tablet_map& tmap, global_tablet_id tablet) const {
     auto [table, tid] = tablet;
     auto rbid = range_based_tablet_id{table, tmap.get_token_range(tid)};
@@ -1289,6 +1353,9 @@ lw_shared_ptr<load_stats> load_stats::reconcile_tablets_resize(const std::unorde
             for (auto& [host, tls] : new_stats.tablet_stats) {
                 tls.tablet_sizes.erase(table);
             }
+            for (auto& [host, trs] : new_stats.request_stats) {
+                trs.tablet_rates.erase(table);
+            }
             continue;
         }
         const auto& old_tmap = old_tm.tablets().get_tablet_map(table);
@@ -1314,6 +1381,11 @@ lw_shared_ptr<load_stats> load_stats::reconcile_tablets_resize(const std::unorde
                     sizes_for_table[new_range] += *tablet_size_opt;
                     tablet_logger.debug("reconcile merge: host {}, old tablet {}, old range {}, new tablet {}, new range {}, size {}",
                                         replica.host, old_tablet_id, rb_tid.range, new_tablet_id, new_range, *tablet_size_opt);
+                    if (auto rate = new_stats.get_tablet_request_rate(replica.host, rb_tid)) {
+                        auto& rates_for_table = new_stats.request_stats.at(replica.host).tablet_rates.at(table);
+                        rates_for_table.erase(rb_tid.range);
+                        rates_for_table[new_range] += *rate;
+                    }
                 }
             }
         } else if (old_tablet_count * 2 == new_tablet_count) {
@@ -1334,6 +1406,14 @@ lw_shared_ptr<load_stats> load_stats::reconcile_tablets_resize(const std::unorde
                     sizes_for_table[new_range1] = split_tablet_size;
                     sizes_for_table[new_range2] = split_tablet_size;
                     sizes_for_table.erase(rb_tid.range);
+                    if (auto rate = new_stats.get_tablet_request_rate(replica.host, rb_tid)) {
+                        auto& rates_for_table = new_stats.request_stats.at(replica.host).tablet_rates.at(table);
+                        // Hot tablets are split at their median token, so their halves get half of the requests each.
+                        const auto split_rate = tablet_request_rate{rate->reads / 2, rate->writes / 2};
+                        rates_for_table[new_range1] = split_rate;
+                        rates_for_table[new_range2] = split_rate;
+                        rates_for_table.erase(rb_tid.range);
+                    }
                 }
             }
         }
@@ -1358,6 +1438,14 @@ lw_shared_ptr<load_stats> load_stats::migrate_tablet_size(locator::host_id leavi
             if (new_leaving_ts.tablet_sizes.at(gid.table).empty()) {
                 new_leaving_ts.tablet_sizes.erase(gid.table);
             }
+            if (get_tablet_request_rate(leaving, rb_tid)) {
+                auto& new_leaving_rs = result->request_stats.at(leaving);
+                auto rate_node = new_leaving_rs.tablet_rates.at(gid.table).extract(trange);
+                result->request_stats[pending].tablet_rates[gid.table].insert(std::move(rate_node));
+                if (new_leaving_rs.tablet_rates.at(gid.table).empty()) {
+                    new_leaving_rs.tablet_rates.erase(gid.table);
+                }
+            }
         }
     }
 
@@ -2106,8 +2194,12 @@ auto fmt::formatter<locator::resize_decision_way>::format(const locator::resize_
         [&] (const locator::resize_decision::none&) {
             fmt::format_to(ctx.out(), "none");
         },
-        [&] (const locator::resize_decision::split&) {
-            fmt::format_to(ctx.out(), "split");
+        [&] (const locator::resize_decision::split& split) {
+            if (!split.split_tokens.empty()) {
+                fmt::format_to(ctx.out(), "split(tokens={})", split.split_tokens);
+            } else {
+                fmt::format_to(ctx.out(), "split");
+            }
         },
         [&] (const locator::resize_decision::merge& merge) {
             if (!merge.selected_left_tablets.empty()) {
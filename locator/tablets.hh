@@ -19,6 +19,7 @@
 #include "locator/topology.hh"
 #include "schema/schema_fwd.hh"
 #include "utils/chunked_vector.hh"
+#include "utils/cow_chunked_vector.hh"
 #include "utils/hash.hh"
 #include "utils/UUID.hh"
 #include "raft/raft.hh"
@@ -484,6 +485,11 @@ struct resize_decision {
         auto operator<=>(const none&) const = default;
     };
     struct split {
+        // Tokens at which specific tablets are split, sorted by tablet id.
+        // A tablet which is not listed is split at the midpoint of its range,
+        // see tablet_map::get_split_token().
+        // Each token must be inside the range of its tablet, and not equal to its last token.
+        std::vector<std::pair<tablet_id, dht::token>> split_tokens;
         auto operator<=>(const split&) const = default;
     };
     struct merge {
@@ -578,10 +584,40 @@ struct tablet_load_stats {
     uint64_t add_tablet_sizes(const tablet_load_stats& tls);
 };
 
+// Rates of the requests served by a tablet replica, in requests per second.
+struct tablet_request_rate {
+    double reads = 0;
+    double writes = 0;
+    // The token which splits the requests of the tablet in half, if known.
+    std::optional<dht::token> median_token;
+
+    double total() const noexcept {
+        return reads + writes;
+    }
+
+    tablet_request_rate& operator+=(const tablet_request_rate& r) noexcept {
+        reads += r.reads;
+        writes += r.writes;
+        // The rates of another range do not tell where the median of the sum is.
+        median_token.reset();
+        return *this;
+    }
+};
+
+// This is defined as final in the idl layer to limit the amount of encoded data sent via the RPC
+struct tablet_request_stats {
+    // Contains tablet request rates per table.
+    // The token ranges must be in the form (a, b] and only such ranges are allowed
+    std::unordered_map<table_id, std::unordered_map<dht::token_range, tablet_request_rate>> tablet_rates;
+
+    void add_tablet_rates(const tablet_request_stats& trs);
+};
+
 // Used as a return value for functions returning both table and tablet stats
 struct combined_load_stats {
     locator::table_load_stats table_ls;
     locator::tablet_load_stats tablet_ls;
+    locator::tablet_request_stats tablet_rs;
 };
 
 using tablet_load_stats_map = std::unordered_map<host_id, tablet_load_stats>;
@@ -598,6 +634,9 @@ struct load_stats {
     // Size-based load balancing data
     tablet_load_stats_map tablet_stats;
 
+    // Request rate based load balancing data
+    std::unordered_map<host_id, tablet_request_stats> request_stats;
+
     // Distinguishes a default-constructed (null) load_stats from one that has
     // been aggregated via operator+=.  A null element contributes nothing when
     // merged, while an aggregated-but-empty stats (e.g. from a node that
@@ -614,6 +653,12 @@ struct load_stats {
 
     std::optional<uint64_t> get_tablet_size(host_id host, const range_based_tablet_id& rb_tid) const;
 
+    std::optional<tablet_request_rate> get_tablet_request_rate(host_id host, const range_based_tablet_id& rb_tid) const;
+
+    // Returns the request rate of the tablet on the given host. Like get_tablet_size_in_transition(),
+    // the rate of a tablet in migration is searched on the leaving replica if the given host is pending.
+    std::optional<tablet_request_rate> get_tablet_request_rate_in_transition(host_id host, const range_based_tablet_id& rb_tid, const tablet_info& ti, const tablet_transition_info* trinfo) const;
+
     // Returns average size of tablet replica of a given tablet, or nullopt if information is incomplete.
     std::optional<uint64_t> get_avg_tablet_size(const tablet_map&, global_tablet_id) const;
 
@@ -623,13 +668,14 @@ struct load_stats {
     // - if the tablet is being rebuilt, we will return the average tablet size of all the replicas
     std::optional<uint64_t> get_tablet_size_in_transition(host_id host, const range_based_tablet_id& rb_tid, const tablet_info& ti, const tablet_transition_info* trinfo) const;
 
-    // Modifies the tablet sizes in load_stats for the given table after a split or merge. The old_tm argument has
+    // Modifies the tablet sizes and request rates in load_stats for the given table after a split or merge. The old_tm argument has
     // to contain the token_metadata pre-resize. The function returns load_stats with tablet token ranges
     // corresponding to the post-resize tablet_map.
     // In case any pre-resize tablet replica is not found, the function returns nullptr
     lw_shared_ptr<load_stats> reconcile_tablets_resize(const std::unordered_set<table_id>& tables, const token_metadata& old_tm, const token_metadata& new_tm) const;
 
     // Modifies the tablet sizes in load_stats by moving the size of a tablet from leaving to pending host.
+    // The request rate of the tablet, if known, is moved along with it.
     // The function returns modified load_stats if the tablet size was successfully migrated.
     // It returns nullptr if any of the following is true:
     // - tablet was not found on the leaving host
@@ -743,7 +789,9 @@ class tablet_id_map {
 /// A tablet_id obtained from an instance of tablet_map is valid for that instance only.
 class tablet_map {
 public:
-    using tablet_container = utils::chunked_vector<tablet_info>;
+    // Shares chunks of tablets between clones, so that cloning the map and
+    // changing a few tablets of the clone does not copy all the tablets.
+    using tablet_container = utils::cow_chunked_vector<tablet_info>;
     using raft_info_container = utils::chunked_vector<tablet_raft_info>;
     struct initialized_later {};
 private:
@@ -942,6 +990,7 @@ class tablet_map {
 
     /// Returns the token which will become the last token of the lower sibling post-split.
     /// The higher sibling will own (get_split_token(id), get_last_token(id)].
+    /// This is the midpoint of the tablet's range, unless the split decision sets another token for the tablet.
     dht::token get_split_token(tablet_id id) const;
 
     /// Returns tablet_layout of this tablet_map.
@@ -1291,6 +1291,11 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
                     .static_shares = cfg->compaction_static_shares,
                     .max_shares = cfg->compaction_max_shares,
                     .throughput_mb_per_sec = cfg->compaction_throughput_mb_per_sec,
+                    .foreground_latency_target_us = cfg->compaction_controller_foreground_latency_target_us,
+                    .hot_range_sstables_per_read = cfg->compaction_hot_range_sstables_per_read,
+                    .hot_range_reads = cfg->compaction_hot_range_reads,
+                    .slice_sstables_for_split = cfg->compaction_slice_sstables_for_split,
+                    .disk_bandwidth_mb_per_sec = cfg->compaction_disk_bandwidth_mb_per_sec,
                     .flush_all_tables_before_major = cfg->compaction_flush_all_tables_before_major_seconds() * 1s,
                 };
             });
@@ -1939,6 +1944,7 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
                     .critical_disk_utilization_level = cfg->critical_disk_utilization_level,
                     .repair_multishard_reader_buffer_hint_size = cfg->repair_multishard_reader_buffer_hint_size,
                     .repair_multishard_reader_enable_read_ahead = cfg->repair_multishard_reader_enable_read_ahead,
+                    .repair_peer_bandwidth_mb_per_sec = cfg->repair_peer_bandwidth_mb_per_sec,
                 };
             });
             repair.start(std::ref(tsm), std::ref(gossiper), std::ref(messaging), std::ref(db), std::ref(proxy), std::ref(bm), std::ref(sys_ks), std::ref(view_builder), std::ref(view_building_worker), std::ref(task_manager), std::ref(mm), max_memory_repair, std::move(repair_config)).get();
@@ -2864,6 +2870,7 @@ int main(int ac, char** av) {
         {"perf-simple-query", perf::scylla_simple_query_main, "run performance tests by sending simple queries to this server"},
         {"perf-sstable", perf::scylla_sstable_main, "run performance tests by exercising sstable related operations on this server"},
         {"perf-compaction-efficiency", perf::scylla_compaction_efficiency_main, "benchmark compaction strategy efficiency with simulated workloads"},
+        {"perf-compaction-simulator", perf::scylla_compaction_simulator_main, "simulate compaction strategies on recorded sstable metadata"},
         {"perf-alternator", perf::alternator(scylla_main, &after_init_func), "run performance tests on full alternator stack"},
         {"perf-cql-raw", perf::perf_cql_raw(scylla_main, &after_init_func), "run performance tests using raw CQL protocol frames"}
     };
@@ -757,6 +757,8 @@ static constexpr unsigned do_get_rpc_client_idx(messaging_verb verb) {
     case messaging_verb::REPAIR_UPDATE_COMPACTION_CTRL:
     case messaging_verb::REPAIR_UPDATE_REPAIRED_AT_FOR_MERGE:
     case messaging_verb::REPAIR_GET_TABLE_SIZE:
+    case messaging_verb::REPAIR_GET_ROW_HASH_TREE:
+    case messaging_verb::REPAIR_GET_RANGE_HASH_DIGEST:
     case messaging_verb::NODE_OPS_CMD:
     case messaging_verb::HINT_MUTATION:
     case messaging_verb::TABLET_STREAM_FILES:
@@ -774,6 +776,7 @@ static constexpr unsigned do_get_rpc_client_idx(messaging_verb verb) {
     case messaging_verb::CLIENT_ID:
     case messaging_verb::MUTATION:
     case messaging_verb::READ_DATA:
+    case messaging_verb::READ_DATA_BATCH:
     case messaging_verb::READ_MUTATION_DATA:
     case messaging_verb::READ_DIGEST:
     case messaging_verb::UNUSED__DEFINITIONS_UPDATE:
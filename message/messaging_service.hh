@@ -219,7 +219,10 @@ enum class messaging_verb : int32_t {
     CLONE_SSTABLE = 90,
     FETCH_COLUMN_MAPPINGS = 91,
     REPAIR_GET_TABLE_SIZE = 92,
-    LAST = 93,
+    READ_DATA_BATCH = 93,
+    REPAIR_GET_ROW_HASH_TREE = 94,
+    REPAIR_GET_RANGE_HASH_DIGEST = 95,
+    LAST = 96,
 };
 
 } // namespace netw
@@ -52,6 +52,7 @@ class multishard_writer {
     uint64_t _consumed_partitions = 0;
     mutation_reader _producer;
     mutation_reader_consumer _consumer;
+    size_t _shard_buffer_size;
 private:
     dht::shard_replica_set shard_for_mf(const mutation_fragment_v2& mf) {
         auto token = mf.as_partition_start().key().token();
@@ -68,7 +69,8 @@ class multishard_writer {
         schema_ptr s,
         const dht::sharder& sharder,
         mutation_reader producer,
-        mutation_reader_consumer consumer);
+        mutation_reader_consumer consumer,
+        size_t shard_buffer_size);
     future<uint64_t> operator()();
     future<> close() noexcept;
 };
@@ -102,17 +104,24 @@ multishard_writer::multishard_writer(
     schema_ptr s,
     const dht::sharder& sharder,
     mutation_reader producer,
-    mutation_reader_consumer consumer)
+    mutation_reader_consumer consumer,
+    size_t shard_buffer_size)
     : _s(std::move(s))
     , _sharder(sharder)
     , _queue_reader_handles(_sharder.shard_count())
     , _producer(std::move(producer))
-    , _consumer(std::move(consumer)) {
+    , _consumer(std::move(consumer))
+    , _shard_buffer_size(shard_buffer_size) {
     _shard_writers.resize(_sharder.shard_count());
 }
 
 future<> multishard_writer::make_shard_writer(unsigned shard) {
     auto [reader, handle] = make_queue_reader(_s, _producer.permit());
+    // The queue blocks the producer once its buffer is full. Fragments of
+    // consecutive partitions usually go to different shards, so the buffer has
+    // to be large enough for the producer to keep feeding the other shards
+    // while the consumer of this one is busy writing.
+    reader.set_max_buffer_size(_shard_buffer_size);
     _queue_reader_handles[shard] = std::move(handle);
     return smp::submit_to(shard, [gs = global_schema_ptr(_s),
             consumer = _consumer,
@@ -222,8 +231,9 @@ future<uint64_t> distribute_reader_and_consume_on_shards(schema_ptr s,
     const dht::sharder& sharder,
     mutation_reader producer,
     mutation_reader_consumer consumer,
-    utils::phased_barrier::operation&& op) {
-    return do_with(multishard_writer(std::move(s), sharder, std::move(producer), std::move(consumer)), std::move(op), [] (multishard_writer& writer, utils::phased_barrier::operation&) {
+    utils::phased_barrier::operation&& op,
+    size_t shard_buffer_size) {
+    return do_with(multishard_writer(std::move(s), sharder, std::move(producer), std::move(consumer), shard_buffer_size), std::move(op), [] (multishard_writer& writer, utils::phased_barrier::operation&) {
         return seastar::futurize_invoke(writer).finally([&writer] {
             return writer.close();
         });
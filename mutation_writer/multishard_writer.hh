@@ -30,10 +30,14 @@ namespace mutation_writer {
 /// The caller is responsible for ensuring that effective_replication_map_ptr used to obtain the sharder
 /// is alive until the returned future is ready. Alternatively, if auto_refreshing_sharder is used,
 /// the topology_guard associated with operation must be used and checked by the consumer.
+///
+/// Up to shard_buffer_size bytes of fragments are buffered for every shard. The producer is
+/// blocked only when the buffer of the shard the current partition belongs to is full.
 future<uint64_t> distribute_reader_and_consume_on_shards(schema_ptr s,
     const dht::sharder& sharder,
     mutation_reader producer,
     mutation_reader_consumer consumer,
-    utils::phased_barrier::operation&& op = {});
+    utils::phased_barrier::operation&& op = {},
+    size_t shard_buffer_size = mutation_reader::default_max_buffer_size_in_bytes());
 
 } // namespace mutation_writer
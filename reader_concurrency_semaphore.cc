@@ -18,6 +18,7 @@
 
 #include "reader_concurrency_semaphore.hh"
 #include "query/query-result.hh"
+#include "sstables/resume_hints.hh"
 #include "readers/mutation_reader.hh"
 #include "utils/assert.hh"
 #include "utils/exceptions.hh"
@@ -159,6 +160,7 @@ class reader_permit::impl
     timer<db::timeout_clock> _ttl_timer;
     query::max_result_size _max_result_size{query::result_memory_limiter::unlimited_result_size};
     tracing::trace_state_ptr _trace_ptr;
+    lw_shared_ptr<sstables::resume_hints> _resume_hints;
 
     // Used by with_permit/with_ready_permit for admission signaling.
     // Kept inline since it's used on the hot (direct admission) path.
@@ -563,6 +565,14 @@ class reader_permit::impl
         _max_result_size = std::move(s);
     }
 
+    const lw_shared_ptr<sstables::resume_hints>& resume_hints() const noexcept {
+        return _resume_hints;
+    }
+
+    void set_resume_hints(lw_shared_ptr<sstables::resume_hints> hints) noexcept {
+        _resume_hints = std::move(hints);
+    }
+
     void on_start_sstable_read() noexcept {
         if (!_sstables_read) {
             ++_semaphore._stats.disk_reads;
@@ -710,6 +720,14 @@ void reader_permit::set_max_result_size(query::max_result_size s) {
     _impl->set_max_result_size(std::move(s));
 }
 
+const lw_shared_ptr<sstables::resume_hints>& reader_permit::resume_hints() const noexcept {
+    return _impl->resume_hints();
+}
+
+void reader_permit::set_resume_hints(lw_shared_ptr<sstables::resume_hints> hints) noexcept {
+    _impl->set_resume_hints(std::move(hints));
+}
+
 void reader_permit::on_start_sstable_read() noexcept {
     _impl->on_start_sstable_read();
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <seastar/core/shared_ptr.hh>
 #include <seastar/util/optimized_optional.hh>
 #include "seastarx.hh"
 
@@ -21,6 +22,12 @@ struct max_result_size;
 
 }
 
+namespace sstables {
+
+class resume_hints;
+
+}
+
 namespace seastar {
     class file;
 } // namespace seastar
@@ -179,6 +186,10 @@ class reader_permit {
     query::max_result_size max_result_size() const;
     void set_max_result_size(query::max_result_size);
 
+    // Hints for resuming sstable reads of a paged range scan, see sstables::resume_hints.
+    const lw_shared_ptr<sstables::resume_hints>& resume_hints() const noexcept;
+    void set_resume_hints(lw_shared_ptr<sstables::resume_hints> hints) noexcept;
+
     void on_start_sstable_read() noexcept;
     void on_finish_sstable_read() noexcept;
 
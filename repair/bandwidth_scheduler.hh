@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <unordered_map>
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/condition-variable.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include "locator/host_id.hh"
+#include "utils/updateable_value.hh"
+
+// Paces the row level repair the master runs with its followers.
+//
+// A follower reports its headroom in the responses to REPAIR_GET_SYNC_BOUNDARY.
+// The headroom is the fraction of its repair memory, foreground read capacity
+// and disk it can spare, divided by the number of masters repairing with it.
+// So several masters repairing with a busy follower share what the follower
+// can spare, instead of each of them going at full speed.
+//
+// The master keeps a token bucket per follower. The bucket is filled at the
+// configured per-peer bandwidth scaled by the headroom of the follower, and is
+// charged with the bytes the follower reads from disk for the master. The size
+// of the row buf and the number of ranges repaired in parallel are scaled by
+// the smallest headroom of the followers of the range.
+class repair_bandwidth_scheduler {
+public:
+    using clock = seastar::lowres_clock;
+    // Reports older than that are ignored, the follower is assumed to be idle.
+    static constexpr std::chrono::seconds headroom_ttl{30};
+    // The headroom is never assumed to be lower than that, so that repair
+    // keeps making progress with a busy follower.
+    static constexpr double min_headroom = 0.05;
+    // The row buf is not scaled below that size.
+    static constexpr size_t min_row_buf_size = 256 * 1024;
+    // How much unused bandwidth a bucket can accumulate.
+    static constexpr std::chrono::seconds max_burst{1};
+    // How often ranges waiting for admission check whether they were aborted.
+    static constexpr std::chrono::seconds range_admission_recheck_interval{1};
+
+    // Allows a range to be repaired, until destroyed.
+    class range_units {
+        repair_bandwidth_scheduler* _scheduler = nullptr;
+    public:
+        range_units() = default;
+        explicit range_units(repair_bandwidth_scheduler& scheduler) noexcept : _scheduler(&scheduler) {
+            ++_scheduler->_ranges_in_flight;
+        }
+        range_units(range_units&& o) noexcept : _scheduler(std::exchange(o._scheduler, nullptr)) {}
+        range_units& operator=(range_units&& o) noexcept {
+            if (this != &o) {
+                release();
+                _scheduler = std::exchange(o._scheduler, nullptr);
+            }
+            return *this;
+        }
+        ~range_units() {
+            release();
+        }
+        void release() noexcept {
+            if (auto s = std::exchange(_scheduler, nullptr)) {
+                --s->_ranges_in_flight;
+                s->_range_cond.broadcast();
+            }
+        }
+    };
+
+private:
+    struct peer {
+        double headroom = 1.0;
+        clock::time_point reported;
+        // Bytes which can be read on the peer without waiting, negative when in debt.
+        double tokens = 0;
+        clock::time_point refilled;
+    };
+
+    utils::updateable_value<uint32_t> _peer_bandwidth_mb_per_sec;
+    std::unordered_map<locator::host_id, peer> _peers;
+    size_t _ranges_in_flight = 0;
+    seastar::condition_variable _range_cond;
+
+public:
+    explicit repair_bandwidth_scheduler(utils::updateable_value<uint32_t> peer_bandwidth_mb_per_sec)
+        : _peer_bandwidth_mb_per_sec(std::move(peer_bandwidth_mb_per_sec)) {
+    }
+
+    void report_headroom(locator::host_id node, double headroom, clock::time_point now = clock::now()) {
+        auto& p = _peers[node];
+        p.headroom = std::clamp(headroom, 0.0, 1.0);
+        p.reported = now;
+        _range_cond.broadcast();
+    }
+
+    double headroom(locator::host_id node, clock::time_point now = clock::now()) const {
+        auto it = _peers.find(node);
+        if (it == _peers.end() || now - it->second.reported > headroom_ttl) {
+            return 1.0;
+        }
+        return std::max(it->second.headroom, min_headroom);
+    }
+
+    double min_headroom_of(std::span<const locator::host_id> nodes, clock::time_point now = clock::now()) const {
+        double h = 1.0;
+        for (auto& node : nodes) {
+            h = std::min(h, headroom(node, now));
+        }
+        return h;
+    }
+
+    // The bandwidth (in bytes per second) this shard may use with the node, 0 if not limited.
+    double rate(locator::host_id node, clock::time_point now = clock::now()) const {
+        auto mb = _peer_bandwidth_mb_per_sec.get();
+        if (!mb) {
+            return 0;
+        }
+        return double(mb) * 1024 * 1024 / seastar::smp::count * headroom(node, now);
+    }
+
+    // Charges the bucket of the node with the bytes, and returns how long the
+    // master has to wait before it sends the next request to the node.
+    clock::duration charge(locator::host_id node, uint64_t bytes, clock::time_point now = clock::now()) {
+        auto r = rate(node, now);
+        if (!r) {
+            return clock::duration::zero();
+        }
+        auto& p = _peers[node];
+        if (p.refilled == clock::time_point()) {
+            p.tokens = r * max_burst.count();
+        } else {
+            auto elapsed = std::chrono::duration<double>(now - p.refilled).count();
+            p.tokens = std::min(p.tokens + r * std::max(elapsed, 0.0), r * max_burst.count());
+        }
+        p.refilled = now;
+        p.tokens -= bytes;
+        if (p.tokens >= 0) {
+            return clock::duration::zero();
+        }
+        return std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(-p.tokens / r));
+    }
+
+    seastar::future<> throttle(locator::host_id node, uint64_t bytes, seastar::abort_source& as) {
+        auto delay = charge(node, bytes);
+        if (delay > clock::duration::zero()) {
+            co_await seastar::sleep_abortable(delay, as);
+        }
+    }
+
+    size_t row_buf_size(size_t max, std::span<const locator::host_id> nodes, clock::time_point now = clock::now()) const {
+        return std::max(std::min(max, min_row_buf_size), size_t(max * min_headroom_of(nodes, now)));
+    }
+
+    size_t ranges_in_parallel(size_t max, std::span<const locator::host_id> nodes, clock::time_point now = clock::now()) const {
+        return std::max(size_t(1), size_t(max * min_headroom_of(nodes, now)));
+    }
+
+    size_t ranges_in_flight() const noexcept {
+        return _ranges_in_flight;
+    }
+
+    // Waits until fewer than ranges_in_parallel() ranges are repaired.
+    // The nodes have to be kept alive until the returned future resolves.
+    seastar::future<range_units> admit_range(size_t max, std::span<const locator::host_id> nodes, seastar::noncopyable_function<void()> check_aborted) {
+        while (_ranges_in_flight >= ranges_in_parallel(max, nodes)) {
+            check_aborted();
+            try {
+                co_await _range_cond.wait(range_admission_recheck_interval);
+            } catch (seastar::condition_variable_timed_out&) {
+            }
+        }
+        check_aborted();
+        co_return range_units(*this);
+    }
+};
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <vector>
+
+#include "repair/repair.hh"
+
+// A hash tree over the 64-bit space of row hashes, used to reconcile the row
+// hash sets of the working row bufs of the repair master and a follower.
+//
+// A bucket at level `l` holds the row hashes whose top `l * fanout_bits` bits
+// are equal to the bucket number, so the root (level 0, bucket 0) holds all of
+// them, and every bucket has `fanout` children at the next level. Since the row
+// hashes are uniformly distributed, so are the rows among the buckets of a
+// level, and since repair_hash_set is ordered by hash, a bucket is a contiguous
+// range of the set. The summary of a bucket is the combined (xor) hash and the
+// number of its rows, so it does not depend on the order the rows were read in.
+//
+// The master starts by asking for the summaries of the children of the root,
+// and descends only into the buckets whose summaries differ from its own. Row
+// hashes are only exchanged for the buckets which differ and are small enough,
+// so when the row bufs differ by a few rows, a few summaries and hashes are
+// exchanged instead of all the row hashes of the buf.
+class repair_row_hash_tree {
+public:
+    static constexpr unsigned fanout_bits = 4;
+    static constexpr unsigned fanout = 1u << fanout_bits;
+    static constexpr unsigned max_level = 64 / fanout_bits;
+    // Mismatching buckets with at most this many rows on the peer are not
+    // descended into. The summaries of the children cost as much as the
+    // row hashes of this many rows.
+    static constexpr uint64_t max_leaf_rows = 2 * fanout;
+    // Row bufs with fewer rows are reconciled by exchanging all their row
+    // hashes, which costs less than the round trips of the descent.
+    static constexpr size_t min_rows = 1024;
+
+    static repair_hash first_hash(unsigned level, uint64_t bucket) noexcept {
+        return repair_hash(level == 0 ? 0 : bucket << (64 - level * fanout_bits));
+    }
+
+    static repair_hash last_hash(unsigned level, uint64_t bucket) noexcept {
+        if (level == max_level) {
+            return repair_hash(bucket);
+        }
+        return repair_hash(first_hash(level, bucket).hash | (~uint64_t(0) >> (level * fanout_bits)));
+    }
+
+    static uint64_t bucket_of(const repair_hash& h, unsigned level) noexcept {
+        return level == 0 ? 0 : h.hash >> (64 - level * fanout_bits);
+    }
+
+    // Returns the summaries of the children of `buckets` at `level`, `fanout`
+    // of them per bucket, in the order of `buckets`.
+    static std::vector<repair_row_hash_tree_bucket> summarize_children(const repair_hash_set& hashes, unsigned level, const std::vector<uint64_t>& buckets) {
+        if (level >= max_level) {
+            throw std::invalid_argument(fmt::format("repair_row_hash_tree: cannot expand buckets at level {}", level));
+        }
+        std::vector<repair_row_hash_tree_bucket> children(buckets.size() * fanout);
+        for (size_t i = 0; i < buckets.size(); ++i) {
+            auto it = hashes.lower_bound(first_hash(level, buckets[i]));
+            auto end = hashes.upper_bound(last_hash(level, buckets[i]));
+            for (; it != end; ++it) {
+                auto& child = children[i * fanout + (bucket_of(*it, level + 1) & (fanout - 1))];
+                child.combined_hash.add(*it);
+                child.rows++;
+            }
+        }
+        return children;
+    }
+
+    static void copy_buckets(const repair_hash_set& hashes, unsigned level, const std::vector<uint64_t>& buckets, repair_hash_set& out) {
+        for (auto b : buckets) {
+            out.insert(hashes.lower_bound(first_hash(level, b)), hashes.upper_bound(last_hash(level, b)));
+        }
+    }
+
+    // Answers a request of the master from the row hashes of the working row
+    // buf of a follower.
+    static repair_row_hash_tree_response respond(const repair_hash_set& hashes, const repair_row_hash_tree_request& req) {
+        repair_row_hash_tree_response resp;
+        if (!req.expand.empty()) {
+            resp.children = summarize_children(hashes, req.level, req.expand);
+        }
+        copy_buckets(hashes, req.level, req.fetch, resp.hashes);
+        return resp;
+    }
+};
+
+// Rebuilds the row hash set of a peer on the repair master, from the row
+// hashes of the master and the responses of the peer to the requests of the
+// descent. The buckets whose summaries match are filled with the row hashes
+// of the master.
+class repair_row_hash_tree_reconciler {
+    const repair_hash_set& _local;
+    unsigned _level = 0;
+    std::vector<uint64_t> _expand = {0};
+    std::vector<uint64_t> _fetch;
+    repair_hash_set _peer;
+    size_t _round_trips = 0;
+public:
+    explicit repair_row_hash_tree_reconciler(const repair_hash_set& local)
+        : _local(local)
+    { }
+
+    bool done() const noexcept {
+        return _expand.empty() && _fetch.empty();
+    }
+
+    repair_row_hash_tree_request next_request() const {
+        return repair_row_hash_tree_request{_level, _expand, _fetch};
+    }
+
+    void apply(repair_row_hash_tree_response resp) {
+        if (resp.children.size() != _expand.size() * repair_row_hash_tree::fanout) {
+            throw std::runtime_error(fmt::format("repair_row_hash_tree: expected {} summaries, got {}",
+                    _expand.size() * repair_row_hash_tree::fanout, resp.children.size()));
+        }
+        ++_round_trips;
+        _peer.merge(resp.hashes);
+        auto local_children = _expand.empty() ? std::vector<repair_row_hash_tree_bucket>()
+                : repair_row_hash_tree::summarize_children(_local, _level, _expand);
+        const auto child_level = _level + 1;
+        std::vector<uint64_t> matching;
+        std::vector<uint64_t> expand;
+        std::vector<uint64_t> fetch;
+        for (size_t i = 0; i < resp.children.size(); ++i) {
+            const auto& peer = resp.children[i];
+            const auto& local = local_children[i];
+            auto child = _expand[i / repair_row_hash_tree::fanout] * repair_row_hash_tree::fanout + i % repair_row_hash_tree::fanout;
+            if (peer.rows == local.rows && peer.combined_hash == local.combined_hash) {
+                matching.push_back(child);
+            } else if (peer.rows == 0) {
+                continue;
+            } else if (peer.rows <= repair_row_hash_tree::max_leaf_rows || child_level == repair_row_hash_tree::max_level) {
+                fetch.push_back(child);
+            } else {
+                expand.push_back(child);
+            }
+        }
+        repair_row_hash_tree::copy_buckets(_local, child_level, matching, _peer);
+        _level = child_level;
+        _expand = std::move(expand);
+        _fetch = std::move(fetch);
+    }
+
+    size_t round_trips() const noexcept {
+        return _round_trips;
+    }
+
+    repair_hash_set get_peer_hashes() && {
+        return std::move(_peer);
+    }
+};
@@ -117,6 +117,9 @@ class repair_stats {
     uint64_t round_nr_fast_path_already_synced = 0;
     uint64_t round_nr_fast_path_same_combined_hashes= 0;
     uint64_t round_nr_slow_path = 0;
+    // Ranges found in sync by comparing the sstable repair hash summaries,
+    // without reading their rows
+    uint64_t range_nr_synced_by_hash_summaries = 0;
 
     uint64_t rpc_call_nr = 0;
 
@@ -185,11 +188,45 @@ struct get_sync_boundary_response {
     uint64_t new_rows_size;
     // The number of rows this verb read from disk
     uint64_t new_rows_nr;
+    // The share of the follower the master can use, see repair_bandwidth_scheduler.
+    // Only set by remote followers.
+    std::optional<double> headroom;
 };
 
 // Return value of the REPAIR_GET_COMBINED_ROW_HASH RPC verb
 using get_combined_row_hash_response = repair_hash;
 
+// Argument of the REPAIR_GET_ROW_HASH_TREE RPC verb, see repair_row_hash_tree.
+// All the buckets are at the same level of the tree.
+struct repair_row_hash_tree_request {
+    uint32_t level;
+    // The buckets whose children summaries are requested
+    std::vector<uint64_t> expand;
+    // The buckets whose row hashes are requested
+    std::vector<uint64_t> fetch;
+};
+
+struct repair_row_hash_tree_bucket {
+    repair_hash combined_hash;
+    uint64_t rows = 0;
+};
+
+// Return value of the REPAIR_GET_ROW_HASH_TREE RPC verb
+struct repair_row_hash_tree_response {
+    // The summaries of the children of the expanded buckets
+    std::vector<repair_row_hash_tree_bucket> children;
+    // The row hashes of the fetched buckets
+    repair_hash_set hashes;
+};
+
+// Return value of the REPAIR_GET_RANGE_HASH_DIGEST RPC verb: the digest of the
+// data of the repaired range on a node, see sstables::repair_hash_digest.
+struct repair_range_hash_digest {
+    uint64_t hash;
+    uint64_t fragments;
+    bool operator==(const repair_range_hash_digest&) const = default;
+};
+
 struct node_repair_meta_id {
     locator::host_id ip;
     uint32_t repair_meta_id;
@@ -57,6 +57,8 @@
 #include "readers/filtering.hh"
 #include "readers/mutation_fragment_v1_stream.hh"
 #include "repair/hash.hh"
+#include "repair/hash_tree.hh"
+#include "sstables/repair_hash_summary.hh"
 #include "repair/decorated_key_with_hash.hh"
 #include "repair/row.hh"
 #include "repair/writer.hh"
@@ -110,6 +112,10 @@ enum class repair_state : uint16_t {
     put_row_diff_finished,
     row_level_stop_started,
     row_level_stop_finished,
+    get_row_hash_tree_started,
+    get_row_hash_tree_finished,
+    get_range_hash_digest_started,
+    get_range_hash_digest_finished,
 };
 
 struct repair_node_state {
@@ -804,6 +810,9 @@ class repair_meta {
     std::optional<repair_sync_boundary> _current_sync_boundary;
     // Contains the hashes of rows in the _working_row_buffor for all peer nodes
     std::vector<repair_hash_set> _peer_row_hash_sets;
+    // The hashes of rows in the _working_row_buf, kept on a follower while the
+    // master descends the row hash tree
+    std::optional<repair_hash_set> _row_hash_tree_hashes;
     // Gate used to make sure pending operation of meta data is done
     seastar::named_gate _gate;
     sink_source_for_get_full_row_hashes _sink_source_for_get_full_row_hashes;
@@ -883,6 +892,14 @@ class repair_meta {
     bool use_rpc_stream() const {
         return is_rpc_stream_supported(_algo);
     }
+    bool use_row_hash_tree() const {
+        return _db.local().features().repair_row_hash_tree && _working_row_buf.size() >= repair_row_hash_tree::min_rows;
+    }
+    // Tablet ranges are aligned to the buckets of the sstable repair hash
+    // summaries, and owned by a single shard on every node.
+    bool use_hash_summaries() const {
+        return _db.local().features().repair_hash_summaries && _is_tablet;
+    }
 
 public:
     // master constructor
@@ -1012,6 +1029,7 @@ class repair_meta {
 public:
     future<> clear_gently() noexcept {
         co_await utils::clear_gently(_peer_row_hash_sets);
+        co_await utils::clear_gently(_row_hash_tree_hashes);
         co_await utils::clear_gently(_working_row_buf);
         co_await utils::clear_gently(_row_buf);
     }
@@ -1442,6 +1460,7 @@ class repair_meta {
         rlogger.trace("SET _current_sync_boundary to {}, common_sync_boundary={}", _current_sync_boundary, common_sync_boundary);
         _working_row_buf.clear();
         _working_row_buf_combined_hash.clear();
+        _row_hash_tree_hashes.reset();
 
         if (_row_buf.empty()) {
             co_return get_combined_row_hash_response();
@@ -1756,6 +1775,49 @@ class repair_meta {
         co_return co_await working_row_hashes();
     }
 
+    // RPC API
+    // Return the summaries and row hashes of the buckets of the row hash tree
+    // of the working row buf requested by `req`
+    future<repair_row_hash_tree_response>
+    get_row_hash_tree(repair_row_hash_tree_request req, locator::host_id remote_node, shard_id dst_cpu_id) {
+        if (remote_node == myhostid()) {
+            co_return co_await get_row_hash_tree_handler(std::move(req));
+        }
+        repair_row_hash_tree_response resp = co_await ser::repair_rpc_verbs::send_repair_get_row_hash_tree(&_messaging, remote_node,
+                _repair_meta_id, req, dst_cpu_id);
+        auto nr = resp.children.size() + resp.hashes.size();
+        _metrics.rx_hashes_nr += nr;
+        stats().rx_hashes_nr += nr;
+        stats().rpc_call_nr++;
+        co_return resp;
+    }
+
+    // RPC handler
+    future<repair_row_hash_tree_response>
+    get_row_hash_tree_handler(repair_row_hash_tree_request req) {
+        auto gate_held = _gate.hold();
+        // The descent starts at the root, and the working row buf does not
+        // change until it is done.
+        if (req.level == 0 || !_row_hash_tree_hashes) {
+            _row_hash_tree_hashes = co_await working_row_hashes();
+        }
+        co_return repair_row_hash_tree::respond(*_row_hash_tree_hashes, req);
+    }
+
+    // Return the hashes of the rows in the working row buf of a peer, by
+    // descending the row hash tree of its working row buf into the buckets
+    // which differ from the ones of the local working row buf.
+    future<repair_hash_set>
+    get_full_row_hashes_with_row_hash_tree(locator::host_id remote_node, shard_id dst_cpu_id) {
+        repair_hash_set local_hashes = co_await working_row_hashes();
+        repair_row_hash_tree_reconciler reconciler(local_hashes);
+        while (!reconciler.done()) {
+            reconciler.apply(co_await get_row_hash_tree(reconciler.next_request(), remote_node, dst_cpu_id));
+        }
+        rlogger.debug("Got row hashes from peer={} with the row hash tree, round_trips={}", remote_node, reconciler.round_trips());
+        co_return std::move(reconciler).get_peer_hashes();
+    }
+
     // RPC API
     // Return the combined hashes of the current working row buf
     future<get_combined_row_hash_response>
@@ -1875,6 +1937,27 @@ class repair_meta {
         co_return partitions;
     }
 
+    // RPC API
+    future<std::optional<repair_range_hash_digest>> repair_get_range_hash_digest(locator::host_id remote_node, shard_id dst_cpu_id) {
+        if (remote_node == myhostid()) {
+            co_return get_range_hash_digest();
+        }
+        stats().rpc_call_nr++;
+        co_return co_await ser::repair_rpc_verbs::send_repair_get_range_hash_digest(&_messaging, remote_node, _repair_meta_id, dst_cpu_id);
+    }
+
+    // RPC handler
+    // Return the digest of the data of the repaired range, computed from the
+    // repair hash summaries of the sstables, if they allow it.
+    std::optional<repair_range_hash_digest> get_range_hash_digest() {
+        auto gate_held = _gate.hold();
+        auto digest = _db.local().find_column_family(_schema->id()).get_repair_hash_digest(_range);
+        if (!digest) {
+            return std::nullopt;
+        }
+        return repair_range_hash_digest{digest->hash, digest->fragments};
+    }
+
     // RPC API
     future<> repair_set_estimated_partitions(locator::host_id remote_node, uint64_t estimated_partitions, shard_id dst_cpu_id) {
         if (remote_node == myhostid()) {
@@ -2821,6 +2904,29 @@ future<> repair_service::init_ms_handlers() {
             });
         });
     });
+    ser::repair_rpc_verbs::register_repair_get_range_hash_digest(&ms, [this] (const rpc::client_info& cinfo, uint32_t repair_meta_id, shard_id dst_cpu_id) {
+        auto from = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
+        return container().invoke_on(dst_cpu_id, [from, repair_meta_id] (repair_service& local_repair) {
+            auto rm = local_repair.get_repair_meta(from, repair_meta_id);
+            rm->set_repair_state_for_local_node(repair_state::get_range_hash_digest_started);
+            auto digest = rm->get_range_hash_digest();
+            rm->set_repair_state_for_local_node(repair_state::get_range_hash_digest_finished);
+            return digest;
+        });
+    });
+    ser::repair_rpc_verbs::register_repair_get_row_hash_tree(&ms, [this] (const rpc::client_info& cinfo, uint32_t repair_meta_id,
+            const repair_row_hash_tree_request& req, shard_id dst_cpu_id) {
+        auto from = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
+        return container().invoke_on(dst_cpu_id, [from, repair_meta_id, req] (repair_service& local_repair) mutable {
+            auto rm = local_repair.get_repair_meta(from, repair_meta_id);
+            rm->set_repair_state_for_local_node(repair_state::get_row_hash_tree_started);
+            return rm->get_row_hash_tree_handler(std::move(req)).then([rm] (repair_row_hash_tree_response resp) {
+                rm->set_repair_state_for_local_node(repair_state::get_row_hash_tree_finished);
+                _metrics.tx_hashes_nr += resp.children.size() + resp.hashes.size();
+                return resp;
+            });
+        });
+    });
     ser::repair_rpc_verbs::register_repair_get_sync_boundary(&ms, [this] (const rpc::client_info& cinfo, uint32_t repair_meta_id,
             std::optional<repair_sync_boundary> skipped_sync_boundary, rpc::optional<shard_id> dst_cpu_id_opt) {
         auto src_cpu_id = cinfo.retrieve_auxiliary<uint32_t>("src_cpu_id");
@@ -2830,8 +2936,9 @@ future<> repair_service::init_ms_handlers() {
                 skipped_sync_boundary = std::move(skipped_sync_boundary)] (repair_service& local_repair) mutable {
             auto rm = local_repair.get_repair_meta(from, repair_meta_id);
             rm->set_repair_state_for_local_node(repair_state::get_sync_boundary_started);
-            return rm->get_sync_boundary_handler(std::move(skipped_sync_boundary)).then([rm] (get_sync_boundary_response resp) {
+            return rm->get_sync_boundary_handler(std::move(skipped_sync_boundary)).then([rm, &local_repair] (get_sync_boundary_response resp) {
                 rm->set_repair_state_for_local_node(repair_state::get_sync_boundary_finished);
+                resp.headroom = local_repair.follower_headroom();
                 return resp;
             });
         });
@@ -3147,6 +3254,15 @@ class row_level_repair {
                 ns.state = repair_state::get_sync_boundary_finished;
                 master.stats().row_from_disk_bytes[node] += res.new_rows_size;
                 master.stats().row_from_disk_nr[node] += res.new_rows_nr;
+                if (node != master.myhostid()) {
+                    // Pace the reads on the follower, so that the next round
+                    // starts when the follower can spare the bandwidth.
+                    auto& scheduler = _shard_task.rs.bandwidth_scheduler();
+                    if (res.headroom) {
+                        scheduler.report_headroom(node, *res.headroom);
+                    }
+                    co_await scheduler.throttle(node, res.new_rows_size, _shard_task.abort_source());
+                }
                 if (res.boundary && res.row_buf_size > 0) {
                     _sync_boundaries.push_back(*res.boundary);
                     _combined_hashes.push_back(res.row_buf_combined_csum);
@@ -3290,7 +3406,11 @@ class row_level_repair {
             rlogger.debug("Before master.get_full_row_hashes for node {}, hash_sets={}",
                 node, master.peer_row_hash_sets(node_idx).size());
             // Ask the peer to send the full list hashes in the working row buf.
-            if (master.use_rpc_stream()) {
+            if (master.use_row_hash_tree()) {
+                ns.state = repair_state::get_row_hash_tree_started;
+                master.peer_row_hash_sets(node_idx) = master.get_full_row_hashes_with_row_hash_tree(node, dst_cpu_id).get();
+                ns.state = repair_state::get_row_hash_tree_finished;
+            } else if (master.use_rpc_stream()) {
                 ns.state = repair_state::get_full_row_hashes_with_rpc_stream_started;
                 master.peer_row_hash_sets(node_idx) = master.get_full_row_hashes_with_rpc_stream(node, node_idx, dst_cpu_id).get();
                 ns.state = repair_state::get_full_row_hashes_with_rpc_stream_finished;
@@ -3443,7 +3563,12 @@ class row_level_repair {
             _shard_task.check_in_abort_or_shutdown();
             auto repair_meta_id = _shard_task.rs.get_next_repair_meta_id().get();
             auto algorithm = get_common_diff_detect_algorithm(_shard_task.messaging.local(), _all_live_peer_nodes);
-            auto max_row_buf_size = get_max_row_buf_size(algorithm);
+            // Repair fewer ranges in parallel, with smaller row bufs, when
+            // the followers report they can't spare much for repair.
+            auto& scheduler = _shard_task.rs.bandwidth_scheduler();
+            auto range_units = scheduler.admit_range(repair::task_manager_module::max_ranges_in_parallel(_shard_task.rs.max_repair_memory()),
+                    _all_live_peer_nodes, [this] { _shard_task.check_in_abort_or_shutdown(); }).get();
+            auto max_row_buf_size = scheduler.row_buf_size(get_max_row_buf_size(algorithm), _all_live_peer_nodes);
             auto& cf = _shard_task.db.local().find_column_family(_table_id);
             auto& sharder = cf.get_effective_replication_map()->get_sharder(*(cf.schema()));
             auto master_node_shard_config = shard_config {
@@ -3562,7 +3687,26 @@ class row_level_repair {
                     ns.state = repair_state::set_estimated_partitions_finished;
                 })).get();
 
-                while (true) {
+                // Skip reading the range if the repair hash summaries of the
+                // sstables show that all the nodes hold the same data in it.
+                bool in_sync = false;
+                if (master.use_hash_summaries()) {
+                    std::vector<std::optional<repair_range_hash_digest>> digests(master.all_nodes().size());
+                    parallel_for_each(std::views::iota(size_t(0), digests.size()), coroutine::lambda([&] (size_t idx) -> future<> {
+                        auto& ns = master.all_nodes()[idx];
+                        ns.state = repair_state::get_range_hash_digest_started;
+                        digests[idx] = co_await master.repair_get_range_hash_digest(ns.node, ns.shard);
+                        ns.state = repair_state::get_range_hash_digest_finished;
+                    })).get();
+                    in_sync = !digests.empty() && std::ranges::all_of(digests, [&] (const auto& d) { return d && d == digests.front(); });
+                    if (in_sync) {
+                        rlogger.debug("repair[{}]: range={} is in sync according to the repair hash summaries, fragments={}",
+                                _shard_task.global_repair_id.uuid(), _range, digests.front()->fragments);
+                        master.stats().range_nr_synced_by_hash_summaries++;
+                    }
+                }
+
+                while (!in_sync) {
                     auto status = negotiate_sync_boundary(master);
                     if (status == op_status::next_round) {
                         continue;
@@ -3704,6 +3848,7 @@ repair_service::repair_service(sharded<service::topology_state_machine>& tsm,
     , _max_repair_memory(max_repair_memory)
     , _memory_sem(max_repair_memory)
     , _config(std::move(cfg))
+    , _bandwidth_scheduler(_config.repair_peer_bandwidth_mb_per_sec)
 {
     tm.register_module("repair", _repair_module);
     if (this_shard_id() == 0) {
@@ -3870,6 +4015,24 @@ future<> repair_service::load_history() {
   }
 }
 
+double repair_service::follower_headroom() {
+    auto& db = _db.local();
+    if (db.is_in_critical_disk_utilization_mode()) {
+        return 0;
+    }
+    // The repair memory not used by the repairs this shard takes part in.
+    auto memory = std::clamp(double(_memory_sem.available_units()) / _max_repair_memory, 0.0, 1.0);
+    // User reads queue up when the shard is short of CPU or disk, every
+    // 8 waiting reads halve the headroom.
+    auto foreground = 1.0 / (1.0 + double(db.user_read_waiters()) / 8);
+    // Split what the shard can spare among the masters repairing with it.
+    std::unordered_set<locator::host_id> masters;
+    for (const auto& [id, rm] : _repair_metas) {
+        masters.insert(id.ip);
+    }
+    return std::min(memory, foreground) / std::max(masters.size(), size_t(1));
+}
+
 repair_meta_ptr repair_service::get_repair_meta(locator::host_id from, uint32_t repair_meta_id) {
     node_repair_meta_id id{from, repair_meta_id};
     auto it = repair_meta_map().find(id);
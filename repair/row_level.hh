@@ -12,6 +12,7 @@
 #include "gms/gossip_address_map.hh"
 #include "gms/inet_address.hh"
 #include "repair/repair.hh"
+#include "repair/bandwidth_scheduler.hh"
 #include "repair/task_manager_module.hh"
 #include "service/topology_guard.hh"
 #include "tasks/task_manager.hh"
@@ -118,6 +119,7 @@ class repair_service : public seastar::peering_sharded_service<repair_service> {
         utils::updateable_value<float> critical_disk_utilization_level = utils::updateable_value<float>(0.98);
         utils::updateable_value<uint64_t> repair_multishard_reader_buffer_hint_size = utils::updateable_value<uint64_t>(1024 * 1024);
         utils::updateable_value<uint64_t> repair_multishard_reader_enable_read_ahead = utils::updateable_value<uint64_t>(0);
+        utils::updateable_value<uint32_t> repair_peer_bandwidth_mb_per_sec = utils::updateable_value<uint32_t>(0);
     };
 
 private:
@@ -177,6 +179,8 @@ class repair_service : public seastar::peering_sharded_service<repair_service> {
     config _config;
     static config default_config() { return {}; }
 
+    repair_bandwidth_scheduler _bandwidth_scheduler;
+
 public:
     std::unordered_map<locator::global_tablet_id, std::vector<seastar::rwlock::holder>> _repair_compaction_locks;
 
@@ -272,6 +276,9 @@ class repair_service : public seastar::peering_sharded_service<repair_service> {
     gms::gossiper& get_gossiper() noexcept { return _gossiper.local(); }
     size_t max_repair_memory() const { return _max_repair_memory; }
     seastar::semaphore& memory_sem() { return _memory_sem; }
+    repair_bandwidth_scheduler& bandwidth_scheduler() noexcept { return _bandwidth_scheduler; }
+    // The share of this shard a repair master can use, as a follower, see repair_bandwidth_scheduler.
+    double follower_headroom();
     locator::host_id my_host_id() const noexcept;
 
     repair::task_manager_module& get_repair_module() noexcept {
@@ -214,6 +214,10 @@ class shard_repair_task_impl : public repair_task_impl {
             size_t small_table_optimization_ranges_reduced_factor_ = 1);
     void check_failed_ranges();
     void check_in_abort_or_shutdown();
+    // Aborted when the repair task is aborted, or when the module is shut down.
+    seastar::abort_source& abort_source() noexcept {
+        return _as;
+    }
     repair_neighbors get_repair_neighbors(const dht::token_range& range);
     gc_clock::time_point get_flush_time() const { return _flush_time; }
     void update_statistics(const repair_stats& stats) {
@@ -274,6 +278,10 @@ class task_manager_module : public tasks::task_manager::module {
 public:
     static constexpr size_t max_repair_memory_per_range = 32 * 1024 * 1024;
 
+    static size_t max_ranges_in_parallel(size_t max_repair_memory) noexcept {
+        return std::max(size_t(1), size_t(max_repair_memory / max_repair_memory_per_range / 4));
+    }
+
     task_manager_module(tasks::task_manager& tm, repair_service& rs, size_t max_repair_memory) noexcept;
 
     repair_service& get_repair_service() noexcept {
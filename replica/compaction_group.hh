@@ -19,6 +19,7 @@
 #include "locator/tablets.hh"
 #include "replica/logstor/compaction.hh"
 #include "replica/logstor/segment_manager.hh"
+#include "replica/request_rate_tracker.hh"
 #include "sstables/sstable_set.hh"
 #include "utils/chunked_vector.hh"
 #include "db/commitlog/replay_position.hh"
@@ -353,12 +354,18 @@ class storage_group {
     // eventually have all their data moved into main group.
     std::vector<compaction_group_ptr> _merging_groups;
     std::vector<compaction_group_ptr> _split_ready_groups;
+    // The token at which the data is segregated into the split ready groups,
+    // the last one of the left group. Valid in splitting mode.
+    dht::token _split_token;
     seastar::named_gate _async_gate;
+    // Rates of the requests to the tablet, reported to the load balancer.
+    request_rate_tracker _request_rates;
 private:
     bool splitting_mode() const {
         return !_split_ready_groups.empty();
     }
     size_t to_idx(locator::tablet_range_side) const;
+    locator::tablet_range_side split_side(dht::token) const noexcept;
 public:
     storage_group(compaction_group_ptr cg);
 
@@ -373,6 +380,10 @@ class storage_group {
 
     const dht::token_range& token_range() const noexcept;
 
+    request_rate_tracker& request_rates() noexcept {
+        return _request_rates;
+    }
+
     size_t memtable_count() const;
 
     const compaction_group_ptr& main_compaction_group() const noexcept;
@@ -380,11 +391,11 @@ class storage_group {
     // Selects the compaction group for the given token. Computes the range side
     // from the token only when in splitting mode. This avoids the cost of computing
     // range side on the hot path when it's not needed.
-    compaction_group_ptr& select_compaction_group(dht::token, const locator::tablet_map&) noexcept;
+    compaction_group_ptr& select_compaction_group(dht::token) noexcept;
     // Selects the compaction group for an sstable spanning a token range.
     // If the first and last tokens fall on different sides of the split point,
     // the sstable belongs to the main compaction group.
-    compaction_group_ptr& select_compaction_group(dht::token first, dht::token last, const locator::tablet_map&) noexcept;
+    compaction_group_ptr& select_compaction_group(dht::token first, dht::token last) noexcept;
 
     uint64_t live_disk_space_used() const;
 
@@ -403,15 +414,18 @@ class storage_group {
     // into two sstable sets and two memtable sets corresponding to the two adjacent
     // tablets post-split.
     // Preexisting sstables and memtables are not split yet.
+    // The data is segregated at the split token of the tablet in tmap. If it
+    // differs from the token the split ready groups were created for, because
+    // the split was revoked and decided again, they are split again.
     // Returns true if post-conditions for split() are met.
-    bool set_split_mode();
+    bool set_split_mode(const locator::tablet_map& tmap);
 
     // Like set_split_mode() but triggers splitting for old sstables and memtables and waits
     // for it:
     //  1) Flushes all memtables which were created in non-split mode, and waits for that to complete.
     //  2) Compacts all sstables which overlap with the split point
     // Returns a future which resolves when this process is complete.
-    future<> split(compaction::compaction_type_options::split opt, tasks::task_info tablet_split_task_info);
+    future<> split(const locator::tablet_map& tmap, compaction::compaction_type_options::split opt, tasks::task_info tablet_split_task_info);
 
     // Make an sstable set spanning all sstables in the storage_group
     lw_shared_ptr<const sstables::sstable_set> make_sstable_set() const;
@@ -519,6 +533,8 @@ class storage_group_manager {
     virtual compaction_group& compaction_group_for_logstor_segment(logstor::log_segment_id seg_id, dht::token first_token, dht::token last_token) const = 0;
 
     virtual storage_group& storage_group_for_token(dht::token) const = 0;
+    // Returns nullptr if the storage group owning the token is not allocated in this shard.
+    virtual storage_group* maybe_storage_group_for_token(dht::token) const noexcept = 0;
     virtual utils::chunked_vector<storage_group_ptr> storage_groups_for_token_range(dht::token_range tr) const = 0;
 
     virtual locator::combined_load_stats table_load_stats() const = 0;
@@ -386,6 +386,8 @@ static auto configure_sstables_manager(const db::config& cfg, const database_con
         .data_file_directories = cfg.data_file_directories(),
         .format = cfg.sstable_format,
         .large_data_records_per_sstable = cfg.compaction_large_data_records_per_sstable,
+        .compaction_compression_helper_shards = cfg.compaction_compression_helper_shards,
+        .write_repair_hash_summary = cfg.enable_sstable_repair_hash_summary,
         .ignore_component_digest_mismatch = cfg.ignore_component_digest_mismatch(),
         .enable_dangerous_direct_import_of_cassandra_counters = cfg.enable_dangerous_direct_import_of_cassandra_counters(),
     };
@@ -460,6 +462,7 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
     , _querier_cache([this] (const reader_concurrency_semaphore& s) {
         return this->is_user_semaphore(s);
     })
+    , _query_result_cache(std::make_unique<query_result_cache>(_cfg.query_result_cache_size_in_bytes, _cfg.query_result_cache_entry_ttl_in_ms))
     , _large_data_handler(std::make_unique<db::cql_table_large_data_handler>(feat,
               _cfg.compaction_large_partition_warning_threshold_mb,
               _cfg.compaction_large_row_warning_threshold_mb,
@@ -494,6 +497,16 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
 
     _row_cache_tracker.set_compaction_scheduling_group(dbcfg.memory_compaction_scheduling_group);
 
+    _compaction_manager.set_foreground_latency_source([this] {
+        auto& h = _cf_stats.foreground_read_latency;
+        auto sample = compaction::compaction_manager::foreground_latency_sample{
+            .requests = h.count(),
+            .p99 = std::chrono::microseconds(h.count() ? h.quantile(0.99) : 0),
+        };
+        h.clear();
+        return sample;
+    });
+
     setup_scylla_memory_diagnostics_producer();
 }
 
@@ -586,6 +599,48 @@ void compaction_controller::set_max_shares(float max_shares) {
     _control_points.back().output = max_shares;
 }
 
+void compaction_controller::update_controller(float shares) {
+    if (!controller_disabled() && _autotune_sampler) {
+        if (auto sample = _autotune_sampler()) {
+            shares = _autotuner.adjust(shares, *sample, min_autotuned_shares, _control_points.back().output);
+        }
+    }
+    backlog_controller::update_controller(shares);
+}
+
+float compaction_shares_autotuner::adjust(float curve_shares, const sample& s, float min_shares, float max_shares) {
+    if (_stats.shares > 0 && s.compacted_bytes > 0 && s.interval.count() > 0) {
+        double throughput = s.compacted_bytes / s.interval.count() / _stats.shares;
+        if (_stats.throughput_per_share > 0) {
+            _stats.throughput_per_share += throughput_smoothing * (throughput - _stats.throughput_per_share);
+        } else {
+            _stats.throughput_per_share = throughput;
+        }
+    }
+
+    if (s.foreground_requests >= min_foreground_requests && s.target.count() > 0) {
+        _stats.foreground_p99 = s.foreground_p99;
+        float ratio = float(s.foreground_p99.count()) / s.target.count();
+        if (ratio > 1) {
+            _stats.gain /= std::min(ratio, 2.0f);
+            ++_stats.latency_throttles;
+        } else if (ratio < latency_headroom && s.backlog > _last_backlog) {
+            _stats.gain *= gain_increase;
+            ++_stats.backlog_boosts;
+        }
+        _stats.gain = std::clamp(_stats.gain, min_gain, max_gain);
+    }
+    _last_backlog = s.backlog;
+
+    float shares = curve_shares * _stats.gain;
+    if (_stats.throughput_per_share > 0) {
+        auto drain_shares = s.backlog / (_stats.throughput_per_share * max_backlog_drain_time.count());
+        shares = std::max(shares, float(drain_shares));
+    }
+    _stats.shares = std::clamp(shares, min_shares, max_shares);
+    return _stats.shares;
+}
+
 namespace replica {
 
 static const metrics::label class_label("class");
@@ -705,6 +760,33 @@ database::setup_metrics() {
         sm::make_gauge("querier_cache_population", _querier_cache.get_stats().population,
                        sm::description("The number of entries currently in the querier cache.")),
 
+        sm::make_counter("query_result_cache_lookups", _query_result_cache->get_stats().lookups,
+                       sm::description("Counts query result cache lookups (prepared single-partition reads of tables with query result caching enabled)")),
+
+        sm::make_counter("query_result_cache_hits", _query_result_cache->get_stats().hits,
+                       sm::description("Counts query result cache lookups that were served from the cache, without reading from the replica")),
+
+        sm::make_counter("query_result_cache_inserts", _query_result_cache->get_stats().inserts,
+                       sm::description("Counts results inserted into the query result cache")),
+
+        sm::make_counter("query_result_cache_raced_inserts", _query_result_cache->get_stats().raced_inserts,
+                       sm::description("Counts results not inserted into the query result cache because the partition was written to while reading")),
+
+        sm::make_counter("query_result_cache_invalidations", _query_result_cache->get_stats().invalidations,
+                       sm::description("Counts query result cache entries dropped due to writes")),
+
+        sm::make_counter("query_result_cache_time_based_evictions", _query_result_cache->get_stats().time_based_evictions,
+                       sm::description("Counts query result cache entries that timed out and were evicted")),
+
+        sm::make_counter("query_result_cache_memory_based_evictions", _query_result_cache->get_stats().memory_based_evictions,
+                       sm::description("Counts query result cache entries evicted to stay below query_result_cache_size_in_bytes")),
+
+        sm::make_gauge("query_result_cache_population", _query_result_cache->get_stats().population,
+                       sm::description("The number of entries currently in the query result cache.")),
+
+        sm::make_gauge("query_result_cache_bytes", _query_result_cache->get_stats().memory_usage,
+                       sm::description("The memory used by the entries of the query result cache.")),
+
     });
 
     // Registering all the metrics with a single call causes the stack size to blow up.
@@ -845,6 +927,10 @@ bool database::is_in_critical_disk_utilization_mode() const {
     return false;
 }
 
+uint64_t database::user_read_waiters() {
+    return sum_read_concurrency_sem_stat(&reader_concurrency_semaphore::stats::waiters);
+}
+
 future<> database::parse_system_tables(sharded<service::storage_proxy>& proxy, sharded<db::system_keyspace>& sys_ks, std::optional<service::intended_storage_mode> storage_mode) {
     using namespace db::schema_tables;
     co_await do_parse_schema_tables(proxy, db::schema_tables::KEYSPACES, coroutine::lambda([&] (schema_result_value_type &v) -> future<> {
@@ -1644,6 +1730,7 @@ keyspace::make_column_family_config(const schema& s, const database& db) const {
     cfg.tombstone_warn_threshold = db_config.tombstone_warn_threshold();
     cfg.view_update_memory_semaphore_limit = _config.view_update_memory_semaphore_limit;
     cfg.data_listeners = &db.data_listeners();
+    cfg.query_result_cache = &db.get_query_result_cache();
     cfg.enable_compacting_data_for_streaming_and_repair = db_config.enable_compacting_data_for_streaming_and_repair;
     cfg.enable_tombstone_gc_for_streaming_and_repair = db_config.enable_tombstone_gc_for_streaming_and_repair;
     cfg.guardrail_config = db::guardrail_config{
@@ -1881,6 +1968,9 @@ database::query(schema_ptr query_schema, const query::read_command& cmd, query::
     auto read_func = [&, this] (reader_permit permit) {
         reader_permit::need_cpu_guard ncpu_guard{permit};
         permit.set_max_result_size(max_result_size);
+        if (cmd.query_uuid) {
+            _querier_cache.attach_resume_hints(cmd.query_uuid, permit);
+        }
         return cf.query(std::move(query_schema), std::move(permit), cmd, opts, ranges, trace_state, get_result_memory_limiter(),
                 timeout, &querier_opt).then([&result, ncpu_guard = std::move(ncpu_guard)] (lw_shared_ptr<query::result> res) {
             result = std::move(res);
@@ -1925,6 +2015,54 @@ database::query(schema_ptr query_schema, const query::read_command& cmd, query::
     co_return std::tuple(std::move(result), hit_rate);
 }
 
+future<std::tuple<std::vector<lw_shared_ptr<query::result>>, cache_temperature>>
+database::query_batch(schema_ptr query_schema, const query::read_command& cmd, query::result_options opts, const dht::partition_range_vector& ranges,
+                      tracing::trace_state_ptr trace_state, db::timeout_clock::time_point timeout) {
+    column_family& cf = find_column_family(cmd.cf_id);
+
+    auto& semaphore = get_reader_concurrency_semaphore();
+    auto max_result_size = cmd.max_result_size ? *cmd.max_result_size : get_query_max_result_size();
+
+    // table::query() merges all ranges it is given into a single result, so
+    // pass each range on its own, to keep the results separate. The ranges
+    // are read in parallel, like the unbatched reads they replace.
+    auto single_ranges = ranges
+            | std::views::transform([] (const dht::partition_range& pr) { return dht::partition_range_vector{pr}; })
+            | std::ranges::to<std::vector<dht::partition_range_vector>>();
+    std::vector<lw_shared_ptr<query::result>> results(ranges.size());
+
+    auto read_func = [&, this] (reader_permit permit) {
+        reader_permit::need_cpu_guard ncpu_guard{permit};
+        permit.set_max_result_size(max_result_size);
+        return parallel_for_each(std::views::iota(size_t(0), single_ranges.size()), [&, this, permit] (size_t i) {
+            return cf.query(query_schema, permit, cmd, opts, single_ranges[i], trace_state, get_result_memory_limiter(), timeout).then([&results, i] (lw_shared_ptr<query::result> res) {
+                results[i] = std::move(res);
+            });
+        }).finally([ncpu_guard = std::move(ncpu_guard)] { });
+    };
+
+    std::exception_ptr ex;
+    try {
+        auto op = cf.read_in_progress();
+
+        reader_permit_opt permit_holder;
+        co_await semaphore.with_permit(query_schema, "data-query-batch", cf.estimate_read_memory_cost(), timeout,
+                trace_state, permit_holder, read_func);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+
+    if (ex) {
+        ++semaphore.get_stats().total_failed_reads;
+        co_return coroutine::exception(std::move(ex));
+    }
+
+    auto hit_rate = cf.get_global_cache_hit_rate();
+    ++semaphore.get_stats().total_successful_reads;
+    _stats->short_data_queries += std::ranges::count_if(results, [] (const lw_shared_ptr<query::result>& r) { return bool(r->is_short_read()); });
+    co_return std::tuple(std::move(results), hit_rate);
+}
+
 future<std::tuple<reconcilable_result, cache_temperature>>
 database::query_mutations(schema_ptr query_schema, const query::read_command& cmd, const dht::partition_range& range,
                           tracing::trace_state_ptr trace_state, db::timeout_clock::time_point timeout, bool tombstone_gc_enabled) {
@@ -1945,6 +2083,9 @@ database::query_mutations(schema_ptr query_schema, const query::read_command& cm
     auto read_func = [&] (reader_permit permit) {
         reader_permit::need_cpu_guard ncpu_guard{permit};
         permit.set_max_result_size(max_result_size);
+        if (cmd.query_uuid) {
+            _querier_cache.attach_resume_hints(cmd.query_uuid, permit);
+        }
         return cf.mutation_query(std::move(query_schema), std::move(permit), cmd, range,
                 std::move(trace_state), std::move(accounter), timeout, tombstone_gc_enabled, &querier_opt)
         .then([&result, ncpu_guard = std::move(ncpu_guard)] (reconcilable_result res) {
@@ -2856,6 +2997,7 @@ future<> database::shutdown() {
 }
 
 future<> database::stop() {
+    _compaction_manager.set_foreground_latency_source({});
     if (_unsubscribe_qos_configuration_change) {
         co_await std::exchange(_unsubscribe_qos_configuration_change, {})();
     }
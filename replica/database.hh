@@ -57,6 +57,7 @@
 #include "reader_concurrency_semaphore_group.hh"
 #include "db/timeout_clock.hh"
 #include "replica/querier.hh"
+#include "replica/query_result_cache.hh"
 #include "cache_temperature.hh"
 #include <unordered_set>
 #include "utils/error_injection.hh"
@@ -128,6 +129,7 @@ class sstable_set;
 class directory_semaphore;
 struct sstable_files_snapshot;
 struct entry_descriptor;
+struct repair_hash_digest;
 
 }
 
@@ -387,6 +389,11 @@ struct cf_stats {
     uint64_t total_view_updates_failed_pairing = 0;
     // How many times we had to send additional view updates when there was more view replicas than base replicas during pairing.
     uint64_t total_view_updates_due_to_replica_count_mismatch = 0;
+
+    // Latency of the replica reads executed on this shard since the
+    // compaction controller last sampled it, see
+    // compaction_manager::set_foreground_latency_source().
+    utils::time_estimated_histogram foreground_read_latency;
 };
 
 class table;
@@ -478,6 +485,7 @@ class table : public enable_lw_shared_from_this<table>
         bool enable_node_aggregated_table_metrics = true;
         size_t view_update_memory_semaphore_limit;
         db::data_listeners* data_listeners = nullptr;
+        replica::query_result_cache* query_result_cache = nullptr;
         uint32_t tombstone_warn_threshold{0};
         unsigned x_log2_compaction_groups{0};
         utils::updateable_value<bool> enable_compacting_data_for_streaming_and_repair;
@@ -504,6 +512,10 @@ class table : public enable_lw_shared_from_this<table>
 
     template<typename... Args>
     void do_apply(compaction_group& cg, db::rp_handle&&, Args&&... args);
+    // Drop the results of the partition (or of the whole table) cached in
+    // the query result cache, see replica::query_result_cache.
+    void invalidate_cached_query_results(dht::token token);
+    void invalidate_cached_query_results();
 
     lw_shared_ptr<memtable_list> make_memory_only_memtable_list();
     lw_shared_ptr<memtable_list> make_memtable_list(compaction_group& cg);
@@ -606,6 +618,8 @@ class table : public enable_lw_shared_from_this<table>
     bool _is_bootstrap_or_replace = false;
     sstables::shared_sstable make_sstable(sstables::sstable_state state);
     sstables::shared_sstable make_sstable(sstables::sstable_state state, sstables::sstable_version_types version);
+    // Makes a sstable on the given storage, rather than on the table's own storage.
+    sstables::shared_sstable make_sstable(sstables::sstable_state state, sstables::sstable_version_types version, const data_dictionary::storage_options& storage_opts);
 
 public:
     void on_flush_timer();
@@ -1171,6 +1185,12 @@ class table : public enable_lw_shared_from_this<table>
     void trigger_compaction();
     void try_trigger_compaction(compaction_group& cg) noexcept;
     void trigger_logstor_compaction();
+    // Called for single-partition reads with the number of sstables they had to read from,
+    // to trigger compaction of the token ranges whose reads touch too many sstables.
+    void note_read_fanout(dht::token token, unsigned sstables) const;
+    // Count requests in the request rates of the tablets they are served by, see request_rate_tracker.
+    void note_tablet_read(const dht::partition_range& pr) const;
+    void note_tablet_write(const compaction_group& cg, dht::token token) const;
     // Triggers offstrategy compaction, if needed, in the background.
     void trigger_offstrategy_compaction();
     // Performs offstrategy compaction, if needed, returning
@@ -1470,6 +1490,10 @@ class table : public enable_lw_shared_from_this<table>
     future<compaction_reenablers_and_lock_holders> get_compaction_reenablers_and_lock_holders_for_repair(replica::database& db,
             const service::frozen_topology_guard& guard, dht::token_range range);
     future<uint64_t> estimated_partitions_in_range(dht::token_range tr) const;
+    // Returns the digest of the data of the table in `tr`, computed from the
+    // RepairHashSummary of its sstables, or a disengaged optional if it cannot
+    // be computed without reading the data, e.g. when `tr` has data in memtables.
+    std::optional<sstables::repair_hash_digest> get_repair_hash_digest(const dht::token_range& tr) const;
 
     bool ready_for_writes() const {
         return !_readonly;
@@ -1765,6 +1789,7 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
     bool _shutdown = false;
     bool _enable_autocompaction_toggle = false;
     querier_cache _querier_cache;
+    std::unique_ptr<query_result_cache> _query_result_cache;
 
     std::unique_ptr<logstor::logstor> _logstor;
 
@@ -1872,6 +1897,10 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
 public:
     bool is_in_critical_disk_utilization_mode() const;
 
+    // The number of user reads waiting for admission, memory or execution on
+    // this shard, a measure of the foreground load of the shard.
+    uint64_t user_read_waiters();
+
     void insert_keyspace(std::unique_ptr<keyspace> ks);
     void update_keyspace(std::unique_ptr<keyspace_change> change);
     void drop_keyspace(const sstring& name);
@@ -2022,6 +2051,12 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
     future<std::tuple<lw_shared_ptr<query::result>, cache_temperature>> query(schema_ptr query_schema, const query::read_command& cmd, query::result_options opts,
                                                                   const dht::partition_range_vector& ranges, tracing::trace_state_ptr trace_state,
                                                                   db::timeout_clock::time_point timeout, db::per_partition_rate_limit::info rate_limit_info = std::monostate{});
+    // Reads each of the given singular ranges into a separate result, all of
+    // them under a single reader permit. Results are returned in the order of
+    // `ranges`. Paging is not supported, no queriers are saved.
+    future<std::tuple<std::vector<lw_shared_ptr<query::result>>, cache_temperature>> query_batch(schema_ptr query_schema, const query::read_command& cmd,
+                                                                  query::result_options opts, const dht::partition_range_vector& ranges,
+                                                                  tracing::trace_state_ptr trace_state, db::timeout_clock::time_point timeout);
     future<std::tuple<reconcilable_result, cache_temperature>> query_mutations(schema_ptr query_schema, const query::read_command& cmd, const dht::partition_range& range,
                                                 tracing::trace_state_ptr trace_state, db::timeout_clock::time_point timeout, bool tombstone_gc_enabled = true);
     // Apply the mutation atomically.
@@ -2190,6 +2225,10 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
         return _querier_cache;
     }
 
+    query_result_cache& get_query_result_cache() const {
+        return *_query_result_cache;
+    }
+
     db::view::update_backlog get_view_update_backlog() const {
         return {max_memory_pending_view_updates() - _view_update_memory_sem.current(), max_memory_pending_view_updates()};
     }
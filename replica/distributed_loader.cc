@@ -26,6 +26,7 @@
 #include "service/task_manager_module.hh"
 #include "compaction/compaction_manager.hh"
 #include "compaction/task_manager_module.hh"
+#include "compaction/time_window_compaction_strategy.hh"
 #include "sstables/sstables.hh"
 #include "sstables/sstables_manager.hh"
 #include "sstables/sstable_directory.hh"
@@ -382,6 +383,18 @@ future<> table_populator::collect_subdirs() {
     for (auto state : { sstables::sstable_state::normal, sstables::sstable_state::staging, sstables::sstable_state::quarantine }) {
         co_await std::visit([this, state] (const auto& so) -> future<> { co_await collect_subdirs(so, state); }, _global_table->get_storage_options().value);
     }
+    // Windows of a TWCS table may have been offloaded to object storage, see
+    // time_window_compaction_strategy_options::offload_storage.
+    if (_global_table->get_storage_options().is_local_type()) {
+        if (auto so = compaction::time_window_compaction_strategy::offload_storage_options(*_global_table->schema())) {
+            auto dptr = make_lw_shared<sharded<sstables::sstable_directory>>();
+            co_await dptr->start(_global_table.as_sharded_parameter(), sstables::sstable_state::normal,
+                            sharded_parameter([so = std::move(*so)] {
+                                return make_lw_shared<const data_dictionary::storage_options>(so);
+                            }), default_io_error_handler_gen());
+            _sstable_directories.push_back(std::move(dptr));
+        }
+    }
     // directory must be stopped using table_populator::stop below
 }
 
@@ -279,6 +279,9 @@ class read_context : public reader_lifecycle_policy {
         }
         auto permit = co_await coroutine::try_future(_db.local().obtain_reader_permit(std::move(schema), description, timeout, std::move(trace_ptr)));
         permit.set_max_result_size(get_max_result_size());
+        if (_cmd.query_uuid) {
+            _db.local().get_querier_cache().attach_resume_hints(_cmd.query_uuid, permit);
+        }
         co_return permit;
     }
 
@@ -276,7 +276,10 @@ void querier_cache::insert_querier(
         --stats.population;
     });
 
-    auto notify_handler = [&stats, &index, it] (reader_concurrency_semaphore::evict_reason reason) {
+    auto notify_handler = [this, &stats, &index, it] (reader_concurrency_semaphore::evict_reason reason) {
+        if (reason == reader_concurrency_semaphore::evict_reason::permit) {
+            save_resume_hints(it->first, it->second->permit());
+        }
         index.erase(it);
         switch (reason) {
             case reader_concurrency_semaphore::evict_reason::permit:
@@ -459,6 +462,34 @@ void querier::maybe_log_tombstone_warning(std::string_view what, uint64_t live,
     }
 }
 
+void querier_cache::save_resume_hints(query_id key, reader_permit permit) {
+    const auto now = lowres_clock::now();
+    if (_saved_resume_hints.size() >= max_saved_resume_hints) {
+        std::erase_if(_saved_resume_hints, [now] (const auto& e) { return e.second.expiry <= now; });
+    }
+    if (_saved_resume_hints.size() >= max_saved_resume_hints) {
+        _saved_resume_hints.erase(_saved_resume_hints.begin());
+    }
+    // The readers of the querier fill the hints in when they are closed.
+    auto hints = make_lw_shared<sstables::resume_hints>();
+    permit.set_resume_hints(hints);
+    _saved_resume_hints.insert_or_assign(key, saved_resume_hints{std::move(hints), now + _entry_ttl});
+}
+
+void querier_cache::attach_resume_hints(query_id key, reader_permit& permit) {
+    if (_saved_resume_hints.empty()) {
+        return;
+    }
+    auto it = _saved_resume_hints.find(key);
+    if (it == _saved_resume_hints.end()) {
+        return;
+    }
+    if (it->second.expiry > lowres_clock::now() && !it->second.hints->empty()) {
+        permit.set_resume_hints(std::move(it->second.hints));
+    }
+    _saved_resume_hints.erase(it);
+}
+
 void querier_cache::set_entry_ttl(std::chrono::seconds entry_ttl) {
     _entry_ttl = entry_ttl;
 }
@@ -470,6 +501,7 @@ future<bool> querier_cache::evict_one() noexcept {
             continue;
         }
         auto it = idx.begin();
+        save_resume_hints(it->first, it->second->permit());
         auto reader_opt = it->second->permit().semaphore().unregister_inactive_read(querier_utils::get_inactive_read_handle(*it->second));
         idx.erase(it);
         ++_stats.resource_based_evictions;
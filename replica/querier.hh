@@ -14,6 +14,7 @@
 #include "reader_concurrency_semaphore.hh"
 #include "readers/mutation_source.hh"
 #include "keys/full_position.hh"
+#include "sstables/resume_hints.hh"
 
 #include <boost/intrusive/set.hpp>
 
@@ -323,10 +324,21 @@ class querier_cache {
     using index = std::unordered_multimap<query_id, std::unique_ptr<querier_base>>;
     using is_user_semaphore_func = std::function<bool(const reader_concurrency_semaphore&)>;
 
+    // The maximum number of evicted queries to keep the resume hints of.
+    static constexpr size_t max_saved_resume_hints = 1024;
+
 private:
+    struct saved_resume_hints {
+        lw_shared_ptr<sstables::resume_hints> hints;
+        lowres_clock::time_point expiry;
+    };
+
     index _data_querier_index;
     index _mutation_querier_index;
     index _shard_mutation_querier_index;
+    // Resume hints of queries whose querier was evicted to free up resources,
+    // to be picked up by the recreated readers of the next page.
+    std::unordered_map<query_id, saved_resume_hints> _saved_resume_hints;
     std::chrono::seconds _entry_ttl;
     stats _stats;
     named_gate _closing_gate;
@@ -353,6 +365,8 @@ class querier_cache {
         tracing::trace_state_ptr trace_state,
         db::timeout_clock::time_point timeout);
 
+    void save_resume_hints(query_id key, reader_permit permit);
+
 public:
     querier_cache(is_user_semaphore_func is_user_semaphore_func, std::chrono::seconds entry_ttl = default_entry_ttl);
 
@@ -412,6 +426,14 @@ class querier_cache {
             tracing::trace_state_ptr trace_state,
             db::timeout_clock::time_point timeout);
 
+    /// Attach the resume hints of the query to a newly created permit.
+    ///
+    /// If the querier of the previous page was evicted, the hints saved by
+    /// its readers are handed over, allowing the sstable readers of this page
+    /// to skip the index lookup, see sstables::resume_hints. Otherwise, the
+    /// permit is left alone.
+    void attach_resume_hints(query_id key, reader_permit& permit);
+
     /// Change the ttl of cache entries
     ///
     /// Applies only to entries inserted after the change.
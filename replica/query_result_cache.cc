@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#include "replica/query_result_cache.hh"
+#include "utils/hash.hh"
+
+namespace replica {
+
+size_t query_result_cache::key_hash::operator()(const key& k) const {
+    size_t h = utils::hash_combine(std::hash<table_id>()(k.table), std::hash<dht::token>()(k.token));
+    h = utils::hash_combine(h, std::hash<uint64_t>()(k.statement_id));
+    for (const auto& v : k.values) {
+        h = utils::hash_combine(h, v ? std::hash<bytes_view>()(*v) : 0);
+    }
+    return h;
+}
+
+size_t query_result_cache::partition_id_hash::operator()(const partition_id& p) const {
+    return utils::hash_combine(std::hash<table_id>()(p.table), std::hash<dht::token>()(p.token));
+}
+
+query_result_cache::query_result_cache(utils::updateable_value<uint64_t> max_memory, utils::updateable_value<uint32_t> entry_ttl_ms)
+    : _max_memory(std::move(max_memory))
+    , _entry_ttl_ms(std::move(entry_ttl_ms)) {
+}
+
+size_t query_result_cache::bucket_of(table_id table, dht::token token) {
+    return partition_id_hash()(partition_id{table, token}) % generation_buckets;
+}
+
+void query_result_cache::erase(lru_list::iterator it) {
+    auto [begin, end] = _partitions.equal_range(partition_id{it->k.table, it->k.token});
+    for (auto pit = begin; pit != end; ++pit) {
+        if (pit->second == it) {
+            _partitions.erase(pit);
+            break;
+        }
+    }
+    _index.erase(it->k);
+    _stats.memory_usage -= it->memory_usage;
+    --_stats.population;
+    _lru.erase(it);
+}
+
+void query_result_cache::evict_to(uint64_t max_memory) {
+    while (!_lru.empty() && _stats.memory_usage > max_memory) {
+        erase(std::prev(_lru.end()));
+        ++_stats.memory_based_evictions;
+    }
+}
+
+lw_shared_ptr<query::result> query_result_cache::lookup(const key& k) {
+    ++_stats.lookups;
+    auto it = _index.find(k);
+    if (it == _index.end()) {
+        return {};
+    }
+    auto e = it->second;
+    if (lowres_clock::now() - e->inserted_at > std::chrono::milliseconds(_entry_ttl_ms())) {
+        erase(e);
+        ++_stats.time_based_evictions;
+        return {};
+    }
+    _lru.splice(_lru.begin(), _lru, e);
+    ++_stats.hits;
+    const auto& r = *e->result;
+    return make_lw_shared<query::result>(bytes_ostream(r.buf()), r.digest(), r.last_modified(), r.is_short_read(),
+            r.row_count_low_bits(), r.partition_count(), r.row_count_high_bits(), r.last_position());
+}
+
+query_result_cache::snapshot query_result_cache::get_snapshot(table_id table, dht::token token) const {
+    return snapshot{_epoch, _generations[bucket_of(table, token)]};
+}
+
+void query_result_cache::insert(key k, const query::result& result, snapshot snap) {
+    if (!enabled()) {
+        return;
+    }
+    if (get_snapshot(k.table, k.token) != snap) {
+        ++_stats.raced_inserts;
+        return;
+    }
+    if (auto it = _index.find(k); it != _index.end()) {
+        erase(it->second);
+    }
+    size_t memory_usage = sizeof(entry) + result.buf().size();
+    for (const auto& v : k.values) {
+        memory_usage += v ? v->size() : 0;
+    }
+    const auto max_memory = _max_memory();
+    if (memory_usage > max_memory) {
+        return;
+    }
+    evict_to(max_memory - memory_usage);
+
+    auto copy = make_lw_shared<const query::result>(bytes_ostream(result.buf()), result.digest(), result.last_modified(), result.is_short_read(),
+            result.row_count_low_bits(), result.partition_count(), result.row_count_high_bits(), result.last_position());
+    auto pid = partition_id{k.table, k.token};
+    _lru.push_front(entry{std::move(k), std::move(copy), memory_usage, lowres_clock::now()});
+    auto e = _lru.begin();
+    _index.emplace(e->k, e);
+    _partitions.emplace(pid, e);
+    _stats.memory_usage += memory_usage;
+    ++_stats.population;
+    ++_stats.inserts;
+}
+
+void query_result_cache::invalidate(table_id table, dht::token token) {
+    ++_generations[bucket_of(table, token)];
+    auto [begin, end] = _partitions.equal_range(partition_id{table, token});
+    if (begin == end) {
+        return;
+    }
+    std::vector<lru_list::iterator> entries;
+    for (auto it = begin; it != end; ++it) {
+        entries.push_back(it->second);
+    }
+    for (auto e : entries) {
+        erase(e);
+        ++_stats.invalidations;
+    }
+}
+
+void query_result_cache::invalidate(table_id table) {
+    ++_epoch;
+    for (auto it = _lru.begin(); it != _lru.end();) {
+        auto next = std::next(it);
+        if (it->k.table == table) {
+            erase(it);
+            ++_stats.invalidations;
+        }
+        it = next;
+    }
+}
+
+} // namespace replica
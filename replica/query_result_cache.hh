@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <array>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include "bytes.hh"
+#include "dht/token.hh"
+#include "query/query-result.hh"
+#include "schema/schema_fwd.hh"
+#include "utils/updateable_value.hh"
+
+namespace replica {
+
+/// Per-shard cache of the results of prepared single-partition SELECTs.
+///
+/// Entries are keyed by the identity of the prepared statement, its bound
+/// values and the token of the queried partition. Only tables which opted in
+/// via caching = {'query_results': 'true'} use the cache, see
+/// caching_options::query_results().
+///
+/// The cache is kept coherent with the local replica: every write applied to
+/// a table's memtable invalidates the entries of the written partition, and
+/// operations which change the table's data wholesale (streaming, truncate,
+/// cleanup, schema changes) invalidate all entries of the table.
+///
+/// To avoid caching a result which raced with a write, the reader takes a
+/// snapshot() before it starts reading and passes it to insert(), which drops
+/// the result if the partition (or the whole table) was invalidated since.
+///
+/// Entries are also evicted when they are older than the configured TTL, to
+/// bound the staleness of results which depend on the query time (expiring
+/// cells), and in LRU order to keep memory usage below the configured limit.
+class query_result_cache {
+public:
+    struct key {
+        table_id table;
+        table_schema_version schema_version;
+        // Identifies the prepared statement, see cql3::statements::select_statement.
+        uint64_t statement_id;
+        dht::token token;
+        std::vector<bytes_opt> values;
+
+        bool operator==(const key&) const = default;
+    };
+
+    struct stats {
+        // The number of cache lookups.
+        uint64_t lookups = 0;
+        // The subset of lookups that found a result.
+        uint64_t hits = 0;
+        // The number of results inserted into the cache.
+        uint64_t inserts = 0;
+        // The number of results which were not inserted, because the
+        // partition was written to while they were read.
+        uint64_t raced_inserts = 0;
+        // The number of entries dropped due to writes to their partition or table.
+        uint64_t invalidations = 0;
+        // The number of entries evicted due to their TTL expiring.
+        uint64_t time_based_evictions = 0;
+        // The number of entries evicted to stay below the memory limit.
+        uint64_t memory_based_evictions = 0;
+        // The number of entries currently in the cache.
+        uint64_t population = 0;
+        // The memory currently used by the entries in the cache.
+        uint64_t memory_usage = 0;
+    };
+
+    /// Opaque token obtained before reading, used to detect writes which
+    /// raced with the read.
+    struct snapshot {
+        uint64_t epoch;
+        uint64_t generation;
+
+        bool operator==(const snapshot&) const = default;
+    };
+
+private:
+    struct key_hash {
+        size_t operator()(const key& k) const;
+    };
+
+    struct partition_id {
+        table_id table;
+        dht::token token;
+
+        bool operator==(const partition_id&) const = default;
+    };
+
+    struct partition_id_hash {
+        size_t operator()(const partition_id& p) const;
+    };
+
+    struct entry {
+        key k;
+        lw_shared_ptr<const query::result> result;
+        size_t memory_usage;
+        lowres_clock::time_point inserted_at;
+    };
+
+    using lru_list = std::list<entry>;
+
+    // Number of buckets the per-partition write generations are hashed into.
+    // A collision only causes a racing insert to be dropped needlessly.
+    static constexpr size_t generation_buckets = 256;
+
+    lru_list _lru; // Most recently used entries at the front.
+    std::unordered_map<key, lru_list::iterator, key_hash> _index;
+    std::unordered_multimap<partition_id, lru_list::iterator, partition_id_hash> _partitions;
+    std::array<uint64_t, generation_buckets> _generations{};
+    // Bumped on table-wide invalidations.
+    uint64_t _epoch = 0;
+    utils::updateable_value<uint64_t> _max_memory;
+    utils::updateable_value<uint32_t> _entry_ttl_ms;
+    stats _stats;
+
+private:
+    static size_t bucket_of(table_id table, dht::token token);
+    void erase(lru_list::iterator it);
+    void evict_to(uint64_t max_memory);
+
+public:
+    query_result_cache(utils::updateable_value<uint64_t> max_memory, utils::updateable_value<uint32_t> entry_ttl_ms);
+
+    query_result_cache(const query_result_cache&) = delete;
+    query_result_cache& operator=(const query_result_cache&) = delete;
+
+    bool enabled() const {
+        return _max_memory() > 0;
+    }
+
+    /// Lookup a cached result. Returns a copy of it, so the caller is free
+    /// to consume it.
+    lw_shared_ptr<query::result> lookup(const key& k);
+
+    snapshot get_snapshot(table_id table, dht::token token) const;
+
+    /// Insert a result read after `snap` was taken. The result is dropped if
+    /// the partition was invalidated in the meantime.
+    void insert(key k, const query::result& result, snapshot snap);
+
+    /// Invalidate all entries of a partition. Called after a write was applied.
+    void invalidate(table_id table, dht::token token);
+
+    /// Invalidate all entries of a table.
+    void invalidate(table_id table);
+
+    const stats& get_stats() const {
+        return _stats;
+    }
+};
+
+} // namespace replica
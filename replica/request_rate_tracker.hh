@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <optional>
+
+#include <seastar/core/lowres_clock.hh>
+#include "seastarx.hh"
+
+#include "locator/tablets.hh"
+
+namespace replica {
+
+/// Tracks the rates of the reads and writes served by a tablet replica.
+///
+/// Requests are only counted on the hot path. The counts are folded into
+/// exponentially decaying averages of the rates when the rates are read,
+/// which happens when the load stats are collected for the load balancer,
+/// so a tablet whose traffic moves elsewhere cools down within a few
+/// half-lives.
+///
+/// The rates are also tracked for `segments` equal parts of the token range
+/// of the tablet, so that a hot tablet can be split at the token which
+/// splits its requests in half, rather than at the midpoint of its range.
+class request_rate_tracker {
+public:
+    static constexpr lowres_clock::duration half_life = std::chrono::minutes(1);
+    // Rates are not updated more often than this, so that short intervals
+    // with few requests do not make them jump.
+    static constexpr lowres_clock::duration min_update_interval = std::chrono::seconds(1);
+    static constexpr unsigned segments = 16;
+
+private:
+    uint64_t _reads = 0;
+    uint64_t _writes = 0;
+    locator::tablet_request_rate _rate;
+    std::array<uint64_t, segments> _segment_requests{};
+    std::array<double, segments> _segment_rates{};
+    lowres_clock::time_point _last_update;
+
+    struct range_bounds {
+        uint64_t first; // exclusive
+        uint64_t width;
+    };
+
+    static range_bounds bounds_of(const dht::token_range& range) noexcept {
+        const uint64_t first = range.start() ? range.start()->value().unbias() : 0;
+        const uint64_t last = range.end() ? range.end()->value().unbias() : std::numeric_limits<uint64_t>::max();
+        return range_bounds{first, last - first};
+    }
+
+    static unsigned segment_of(const dht::token_range& range, dht::token t) noexcept {
+        const auto [first, width] = bounds_of(range);
+        const uint64_t offset = t.unbias() - first;
+        if (!width || offset > width) {
+            return 0;
+        }
+        return std::min<uint64_t>((__uint128_t(offset) * segments) / (__uint128_t(width) + 1), segments - 1);
+    }
+
+public:
+    explicit request_rate_tracker(lowres_clock::time_point now = lowres_clock::now()) noexcept
+        : _last_update(now)
+    { }
+
+    void note_read() noexcept {
+        ++_reads;
+    }
+
+    void note_write() noexcept {
+        ++_writes;
+    }
+
+    /// Notes that a request went to token `t` of the tablet whose token range is `range`.
+    void note_token(const dht::token_range& range, dht::token t) noexcept {
+        ++_segment_requests[segment_of(range, t)];
+    }
+
+    /// Carries the rates of a tablet over to one of the `n` tablets it is split into.
+    /// The rates of the segments are not, since the segments of the new tablet differ.
+    request_rate_tracker split(unsigned n) const noexcept {
+        request_rate_tracker t(_last_update);
+        t._reads = _reads / n;
+        t._writes = _writes / n;
+        t._rate = locator::tablet_request_rate{_rate.reads / n, _rate.writes / n};
+        return t;
+    }
+
+    /// Adds the rates of a tablet merged into this one.
+    void merge(const request_rate_tracker& o) noexcept {
+        _reads += o._reads;
+        _writes += o._writes;
+        _rate += o._rate;
+        _segment_requests = {};
+        _segment_rates = {};
+    }
+
+    /// Returns the average rates of requests per second to the tablet whose
+    /// token range is `range`, and the token which splits them in half.
+    locator::tablet_request_rate get_rate(const dht::token_range& range, lowres_clock::time_point now = lowres_clock::now()) noexcept {
+        const auto elapsed = now - _last_update;
+        if (elapsed >= min_update_interval) {
+            const double seconds = std::chrono::duration<double>(elapsed).count();
+            // The weight of the previous average halves every half_life.
+            const double weight = 1 - std::exp2(-seconds / std::chrono::duration<double>(half_life).count());
+            _rate.reads += weight * (_reads / seconds - _rate.reads);
+            _rate.writes += weight * (_writes / seconds - _rate.writes);
+            for (unsigned i = 0; i < segments; ++i) {
+                _segment_rates[i] += weight * (_segment_requests[i] / seconds - _segment_rates[i]);
+            }
+            _reads = 0;
+            _writes = 0;
+            _segment_requests = {};
+            _last_update = now;
+        }
+        auto rate = _rate;
+        rate.median_token = get_median_token(range);
+        return rate;
+    }
+
+    /// Returns the token which splits the requests to the tablet whose token
+    /// range is `range` in half, assuming they are spread evenly within each
+    /// segment, or a disengaged optional if there were no requests.
+    /// The token is inside the range and differs from its last token.
+    std::optional<dht::token> get_median_token(const dht::token_range& range) const noexcept {
+        const auto [first, width] = bounds_of(range);
+        double total = 0;
+        for (auto r : _segment_rates) {
+            total += r;
+        }
+        if (total <= 0 || width < 2) {
+            return std::nullopt;
+        }
+        const uint64_t segment_width = width / segments;
+        double left = total / 2;
+        for (unsigned i = 0; i < segments; ++i) {
+            if (_segment_rates[i] < left && i != segments - 1) {
+                left -= _segment_rates[i];
+                continue;
+            }
+            const double fraction = _segment_rates[i] > 0 ? std::clamp(left / _segment_rates[i], 0.0, 1.0) : 0.0;
+            const uint64_t offset = i * segment_width + uint64_t(fraction * segment_width);
+            return dht::token::bias(first + std::clamp<uint64_t>(offset, 1, width - 1));
+        }
+        return std::nullopt;
+    }
+};
+
+} // namespace replica
@@ -31,6 +31,7 @@
 #include "sstables/sstable_set.hh"
 #include "sstables/sstables.hh"
 #include "sstables/sstables_manager.hh"
+#include "sstables/repair_hash_summary.hh"
 #include "db/schema_tables.hh"
 #include "cell_locking.hh"
 #include "utils/assert.hh"
@@ -497,13 +498,17 @@ sstables::shared_sstable table::make_sstable(sstables::sstable_state state) {
 }
 
 sstables::shared_sstable table::make_sstable(sstables::sstable_state state, sstables::sstable_version_types version) {
+    return make_sstable(state, version, *_storage_opts);
+}
+
+sstables::shared_sstable table::make_sstable(sstables::sstable_state state, sstables::sstable_version_types version, const data_dictionary::storage_options& storage_opts) {
     auto& sstm = get_sstables_manager();
     auto gen = calculate_generation_for_new_table();
     optimized_optional<sstables::sstable_id> sid_opt;
-    if (_storage_opts->is_object_storage_type()) {
+    if (storage_opts.is_object_storage_type()) {
         sid_opt = sstables::sstable_id(gen.as_uuid());
     }
-    return sstm.make_sstable(_schema, *_storage_opts, gen, sid_opt, state, version, sstables::sstable::format_types::big);
+    return sstm.make_sstable(_schema, storage_opts, gen, sid_opt, state, version, sstables::sstable::format_types::big);
 }
 
 sstables::shared_sstable table::make_sstable() {
@@ -758,6 +763,9 @@ class single_storage_group_manager final : public storage_group_manager {
     storage_group& storage_group_for_token(dht::token token) const override {
         return *_single_sg;
     }
+    storage_group* maybe_storage_group_for_token(dht::token token) const noexcept override {
+        return _single_sg.get();
+    }
 
     locator::combined_load_stats table_load_stats() const override {
         return locator::combined_load_stats{
@@ -900,7 +908,7 @@ class tablet_storage_group_manager final : public storage_group_manager {
         auto cg = make_lw_shared<compaction_group>(_t, tid.value(), std::move(range), make_repair_sstable_classifier_func());
         auto sg = make_lw_shared<storage_group>(std::move(cg));
         if (tmap.needs_split()) {
-            sg->set_split_mode();
+            sg->set_split_mode(tmap);
         }
         return sg;
     }
@@ -955,6 +963,9 @@ class tablet_storage_group_manager final : public storage_group_manager {
     storage_group& storage_group_for_token(dht::token token) const override {
         return storage_group_for_id(storage_group_of(token));
     }
+    storage_group* maybe_storage_group_for_token(dht::token token) const noexcept override {
+        return maybe_storage_group_for_id(schema(), tablet_id_for_token(token));
+    }
 
     locator::combined_load_stats table_load_stats() const override;
     bool all_storage_groups_split() override;
@@ -1001,17 +1012,21 @@ size_t storage_group::to_idx(locator::tablet_range_side side) const {
     return size_t(side);
 }
 
-compaction_group_ptr& storage_group::select_compaction_group(dht::token token, const locator::tablet_map& tmap) noexcept {
+locator::tablet_range_side storage_group::split_side(dht::token token) const noexcept {
+    return token > _split_token ? locator::tablet_range_side::right : locator::tablet_range_side::left;
+}
+
+compaction_group_ptr& storage_group::select_compaction_group(dht::token token) noexcept {
     if (splitting_mode()) {
-        return _split_ready_groups[to_idx(tmap.get_tablet_range_side(token))];
+        return _split_ready_groups[to_idx(split_side(token))];
     }
     return _main_cg;
 }
 
-compaction_group_ptr& storage_group::select_compaction_group(dht::token first, dht::token last, const locator::tablet_map& tmap) noexcept {
+compaction_group_ptr& storage_group::select_compaction_group(dht::token first, dht::token last) noexcept {
     if (splitting_mode()) {
-        auto first_side = tmap.get_tablet_range_side(first);
-        auto last_side = tmap.get_tablet_range_side(last);
+        auto first_side = split_side(first);
+        auto last_side = split_side(last);
         if (first_side == last_side) {
             return _split_ready_groups[to_idx(first_side)];
         }
@@ -1056,13 +1071,24 @@ bool storage_group::split_unready_groups_are_empty() const {
     return std::ranges::all_of(split_unready_groups(), std::mem_fn(&compaction_group::empty));
 }
 
-bool storage_group::set_split_mode() {
+bool storage_group::set_split_mode(const locator::tablet_map& tmap) {
     // A group being stopped (e.g. during migration cleanup) cannot satisfy split mode.
     // Also, a race can happen if new groups are added while old ones are being stopped,
     // so the new ones can be left unstopped, potentially resulting in use-after-free.
     if (_async_gate.is_closed()) {
         return false;
     }
+    auto split_token = tmap.get_split_token(locator::tablet_id(_main_cg->group_id()));
+    if (splitting_mode() && split_token != _split_token) {
+        // The split was revoked and decided again, at another token. The data in the
+        // split ready groups was segregated at the old token, so it has to be split
+        // again, like the data of the merging groups.
+        tlogger.info("storage_group::set_split_mode: split token of group={} range={} changed from {} to {}, splitting again",
+                _main_cg->group_id(), _main_cg->token_range(), _split_token, split_token);
+        for (auto& cg : std::exchange(_split_ready_groups, {})) {
+            _merging_groups.push_back(std::move(cg));
+        }
+    }
     if (!splitting_mode()) {
         // Don't create new compaction groups if the main cg has compaction disabled
         if (_main_cg->compaction_disabled()) {
@@ -1079,6 +1105,7 @@ bool storage_group::set_split_mode() {
         split_ready_groups[to_idx(locator::tablet_range_side::left)] = create_cg();
         split_ready_groups[to_idx(locator::tablet_range_side::right)] = create_cg();
         _split_ready_groups = std::move(split_ready_groups);
+        _split_token = split_token;
     }
 
     // The storage group is considered "split ready" if all split unready groups (main + merging) are empty.
@@ -1175,8 +1202,8 @@ future<utils::chunked_vector<logstor::segment_snapshot>> compaction_group::take_
     co_return std::move(snp);
 }
 
-future<> storage_group::split(compaction::compaction_type_options::split opt, tasks::task_info tablet_split_task_info) {
-    if (set_split_mode()) {
+future<> storage_group::split(const locator::tablet_map& tmap, compaction::compaction_type_options::split opt, tasks::task_info tablet_split_task_info) {
+    if (set_split_mode(tmap)) {
         co_return;
     }
     co_await utils::get_local_injector().inject("delay_split_compaction", 5s);
@@ -1269,7 +1296,7 @@ bool tablet_storage_group_manager::all_storage_groups_split() {
 
     bool split_ready = true;
     for (const storage_group_ptr& sg : _storage_groups | std::views::values) {
-        split_ready &= sg->set_split_mode();
+        split_ready &= sg->set_split_mode(tmap);
     }
 
     // The table replica will say to coordinator that its split status is ready by
@@ -1305,8 +1332,8 @@ future<> tablet_storage_group_manager::split_all_storage_groups(tasks::task_info
 
     co_await utils::get_local_injector().inject("split_storage_groups_wait", utils::wait_for_message{std::chrono::minutes{5}}, false);
 
-    co_await for_each_storage_group_gently([opt, tablet_split_task_info] (storage_group& storage_group) {
-        return storage_group.split(opt, tablet_split_task_info);
+    co_await for_each_storage_group_gently([this, opt, tablet_split_task_info] (storage_group& storage_group) {
+        return storage_group.split(tablet_map(), opt, tablet_split_task_info);
     });
 }
 
@@ -1398,7 +1425,7 @@ storage_group& table::storage_group_for_id(size_t i) const {
 compaction_group& tablet_storage_group_manager::compaction_group_for_token(dht::token token) const {
     auto idx = storage_group_of(token);
     auto& sg = storage_group_for_id(idx);
-    return *sg.select_compaction_group(token, tablet_map());
+    return *sg.select_compaction_group(token);
 }
 
 compaction_group& table::compaction_group_for_token(dht::token token) const {
@@ -1511,10 +1538,7 @@ compaction_group& tablet_storage_group_manager::compaction_group_for_token_range
 
     try {
         auto& sg = storage_group_for_id(first_id);
-        return *sg.select_compaction_group(
-                first_token,
-                last_token,
-                tablet_map());
+        return *sg.select_compaction_group(first_token, last_token);
     } catch (std::out_of_range& e) {
         on_internal_error(tlogger, format("Unable to load {} of tablet {}, due to {}",
                                           desc,
@@ -1678,7 +1702,7 @@ future<>
 table::do_add_sstable_and_update_cache(compaction_group& cg, sstables::shared_sstable& sst, sstables::offstrategy offstrategy,
                                        bool trigger_compaction) {
     auto permit = co_await seastar::get_units(_sstable_set_mutation_sem, 1);
-    co_return co_await get_row_cache().invalidate(row_cache::external_updater([&] () mutable noexcept {
+    co_await get_row_cache().invalidate(row_cache::external_updater([&] () mutable noexcept {
         // FIXME: this is not really noexcept, but we need to provide strong exception guarantees.
         // atomically load all opened sstables into column family.
         if (!offstrategy) {
@@ -1696,6 +1720,7 @@ table::do_add_sstable_and_update_cache(compaction_group& cg, sstables::shared_ss
     }), dht::partition_range::make({sst->get_first_decorated_key(), true}, {sst->get_last_decorated_key(), true}), [sst, schema = _schema] (const dht::decorated_key& key) {
         return sst->filter_has_key(sstables::key::from_partition_key(*schema, key.key()));
     });
+    invalidate_cached_query_results();
 }
 
 future<>
@@ -2208,6 +2233,7 @@ table::stop() noexcept {
         _sg_manager->clear_storage_groups();
         _sstables = make_compound_sstable_set();
     }));
+    invalidate_cached_query_results();
     if (uses_logstor()) {
         co_await _logstor_index->drain_cache();
     }
@@ -2688,6 +2714,42 @@ void table::trigger_logstor_compaction() {
     });
 }
 
+void table::note_tablet_read(const dht::partition_range& pr) const {
+    if (!uses_tablets()) {
+        return;
+    }
+    const auto token = pr.start() ? pr.start()->value().token() : dht::minimum_token();
+    if (auto* sg = _sg_manager->maybe_storage_group_for_token(token)) {
+        sg->request_rates().note_read();
+        // Scans would all be counted at the start of their range.
+        if (pr.is_singular()) {
+            sg->request_rates().note_token(sg->token_range(), token);
+        }
+    }
+}
+
+void table::note_tablet_write(const compaction_group& cg, dht::token token) const {
+    if (!uses_tablets()) {
+        return;
+    }
+    // Compaction groups are identified by the tablet of their storage group.
+    if (auto* sg = _sg_manager->maybe_storage_group_for_id(_schema, cg.group_id())) {
+        sg->request_rates().note_write();
+        sg->request_rates().note_token(sg->token_range(), token);
+    }
+}
+
+void table::note_read_fanout(dht::token token, unsigned sstables) const {
+    const auto min_sstables = _compaction_manager.hot_range_sstables_per_read();
+    if (!min_sstables || sstables < min_sstables) {
+        return;
+    }
+    auto& cg = compaction_group_for_token(token);
+    for (auto view : cg.all_views()) {
+        _compaction_manager.note_read_fanout(*view, token, sstables);
+    }
+}
+
 void table::try_trigger_compaction(compaction_group& cg) noexcept {
     try {
         cg.trigger_compaction();
@@ -2999,6 +3061,7 @@ future<> table::drop_quarantined_sstables() {
     std::vector<sstables::shared_sstable> removed;
     auto updater = row_cache::external_updater(quarantine_removal_updater::make(*this, removed));
     co_await _cache.invalidate(std::move(updater));
+    invalidate_cached_query_results();
 
     _cache.refresh_snapshot();
     rebuild_statistics();
@@ -3174,6 +3237,9 @@ class compaction_group::compaction_group_view : public compaction::compaction_gr
     sstables::shared_sstable make_sstable(sstables::sstable_state state, sstables::sstable_version_types version) const override {
         return _t.make_sstable(state, version);
     }
+    sstables::shared_sstable make_sstable(sstables::sstable_state state, const data_dictionary::storage_options& storage_opts) const override {
+        return _t.make_sstable(state, _t.get_sstables_manager().get_preferred_sstable_version(), storage_opts);
+    }
     sstables::sstable_writer_config configure_writer(sstring origin) const override {
         auto cfg = _t.get_sstables_manager().configure_writer(std::move(origin));
         return cfg;
@@ -3438,6 +3504,7 @@ locator::combined_load_stats tablet_storage_group_manager::table_load_stats() co
     table_stats.split_ready_seq_number = _split_ready_seq_number;
 
     locator::tablet_load_stats tablet_stats;
+    locator::tablet_request_stats request_stats;
 
     for_each_storage_group([&] (size_t id, storage_group& sg) {
         auto tid = locator::tablet_id(id);
@@ -3499,11 +3566,13 @@ locator::combined_load_stats tablet_storage_group_manager::table_load_stats() co
             // Make sure the token range is in the form (a, b]
             SCYLLA_ASSERT(!trange.start()->is_inclusive() && trange.end()->is_inclusive());
             tablet_stats.tablet_sizes[gid.table][trange] = tablet_size;
+            request_stats.tablet_rates[gid.table][trange] = sg.request_rates().get_rate(trange);
         }
     });
     return locator::combined_load_stats{
         .table_ls = std::move(table_stats),
-        .tablet_ls = std::move(tablet_stats)
+        .tablet_ls = std::move(tablet_stats),
+        .tablet_rs = std::move(request_stats)
     };
 }
 
@@ -3566,6 +3635,7 @@ void tablet_storage_group_manager::handle_tablet_split_completion(const locator:
                     sstables_repaired_at, table_id, id, group_id, old_range, new_range, i);
             split_ready_groups[i]->update_id_and_range(group_id, new_range);
             new_storage_groups[group_id] = make_lw_shared<storage_group>(std::move(split_ready_groups[i]));
+            new_storage_groups[group_id]->request_rates() = sg->request_rates().split(split_size);
         }
 
         tlogger.debug("Remapping tablet {} of table {} into new tablets [{}].",
@@ -3690,6 +3760,7 @@ void tablet_storage_group_manager::handle_tablet_merge_completion(locator::effec
                         cg->get_sstables_repaired_at(), cg->token_range(), new_sg->token_range(), cg->group_id(), current_new, group_id);
                 new_sg->add_merging_group(cg);
             });
+            new_sg->request_rates().merge(sg->request_rates());
             // Cannot wait for group to be closed, since it can only return after some long-running operation
             // is done with it, and old erm is still held at this point.
             (void) with_gate(_t.async_gate(), [sg] {
@@ -3738,7 +3809,7 @@ void tablet_storage_group_manager::update_effective_replication_map(
         tlogger.info0("Detected new split decision for table {}.{} at tablet count {}, setting split mode on existing storage groups",
                       schema()->ks_name(), schema()->cf_name(), new_tablet_count);
         for (const storage_group_ptr& sg : _storage_groups | std::views::values) {
-            sg->set_split_mode();
+            sg->set_split_mode(*new_tablet_map);
         }
     }
 
@@ -4492,6 +4563,14 @@ future<> database::snapshot_table_on_all_shards(sharded<database>& sharded_db, c
 future<std::pair<std::vector<sstables::shared_sstable>, table::sstable_list_permit>> table::snapshot_sstables() {
     auto permit = co_await get_sstable_list_permit();
     auto tables = *_sstables->all() | std::ranges::to<std::vector<sstables::shared_sstable>>();
+    // Snapshotting sstables on object storage is not implemented, so the
+    // TWCS windows offloaded to it are left out of the snapshot.
+    auto offloaded = std::ranges::partition(tables, [] (const sstables::shared_sstable& sst) { return !sst->get_storage().is_object_storage(); });
+    if (!offloaded.empty()) {
+        tlogger.warn("Snapshot of {}.{} does not include {} sstables offloaded to object storage",
+                _schema->ks_name(), _schema->cf_name(), offloaded.size());
+        tables.erase(offloaded.begin(), offloaded.end());
+    }
     co_return std::make_pair(std::move(tables), std::move(permit));
 }
 
@@ -4729,6 +4808,7 @@ future<> table::clear() {
     co_await parallel_foreach_compaction_group(std::mem_fn(&compaction_group::clear_memtables));
 
     co_await _cache.invalidate(row_cache::external_updater([] { /* There is no underlying mutation source */ }));
+    invalidate_cached_query_results();
 }
 
 bool storage_group::compaction_disabled() const {
@@ -4809,6 +4889,7 @@ future<db::replay_position> table::discard_sstables(db_clock::time_point truncat
         refresh_compound_sstable_set();
         tlogger.debug("cleaning out row cache");
     }));
+    invalidate_cached_query_results();
     rebuild_statistics();
 
     co_await coroutine::parallel_for_each(per_cg_remove, [&] (auto& entry) -> future<> {
@@ -4906,6 +4987,7 @@ void table::set_schema(schema_ptr s) {
     });
 
     _cache.set_schema(s);
+    invalidate_cached_query_results();
     if (_counter_cell_locks) {
         _counter_cell_locks->set_schema(s);
     }
@@ -5142,6 +5224,18 @@ void table::do_apply(compaction_group& cg, db::rp_handle&& h, Args&&... args) {
     _stats.writes.mark(lc);
 }
 
+void table::invalidate_cached_query_results(dht::token token) {
+    if (_config.query_result_cache && _schema->caching_options().query_results()) {
+        _config.query_result_cache->invalidate(_schema->id(), token);
+    }
+}
+
+void table::invalidate_cached_query_results() {
+    if (_config.query_result_cache) {
+        _config.query_result_cache->invalidate(_schema->id());
+    }
+}
+
 api::timestamp_type table::get_max_timestamp_for_tablet(locator::tablet_id tid) const {
     return std::ranges::max(storage_group_for_id(tid.value()).compaction_groups_immediate()
         | std::views::transform([](const compaction_group_ptr& cg_ptr) {
@@ -5156,14 +5250,18 @@ future<> table::apply(const mutation& m, db::rp_handle&& h, db::timeout_clock::t
 
     auto& cg = compaction_group_for_token(m.token());
     auto holder = cg.async_gate().hold();
+    note_tablet_write(cg, m.token());
 
     if (_logstor) [[unlikely]] {
         auto ss_holder = cg.sstable_add_gate().hold();
-        return _logstor->write(m, cg, std::move(ss_holder), timeout);
+        return _logstor->write(m, cg, std::move(ss_holder), timeout).then([this, token = m.token()] {
+            invalidate_cached_query_results(token);
+        });
     }
 
     return dirty_memory_region_group().run_when_memory_available([this, &m, h = std::move(h), &cg, holder = std::move(holder)] () mutable {
         do_apply(cg, std::move(h), m, _large_data_guardrail->get_memtable_cache_tracker(*m.schema(), m.key()));
+        invalidate_cached_query_results(m.token());
     }, timeout);
 }
 
@@ -5175,16 +5273,31 @@ future<> table::apply(const frozen_mutation& m, schema_ptr m_schema, db::rp_hand
         return (*_virtual_writer)(m);
     }
 
-    auto& cg = compaction_group_for_key(m.key(), m_schema);
+    // The token locates the compaction group of the mutation with tablets,
+    // and invalidates the cached query results of the partition.
+    const auto token = uses_tablets() || _schema->caching_options().query_results()
+            ? std::make_optional(dht::get_token(*m_schema, m.key()))
+            : std::nullopt;
+    auto& cg = token ? compaction_group_for_token(*token) : compaction_group_for_key(m.key(), m_schema);
     auto holder = cg.async_gate().hold();
+    if (uses_tablets()) {
+        note_tablet_write(cg, *token);
+    }
 
     if (_logstor) [[unlikely]] {
         auto ss_holder = cg.sstable_add_gate().hold();
-        return _logstor->write(m.unfreeze(m_schema), cg, std::move(ss_holder), timeout);
+        auto mut = m.unfreeze(m_schema);
+        auto token = mut.token();
+        return _logstor->write(std::move(mut), cg, std::move(ss_holder), timeout).then([this, token] {
+            invalidate_cached_query_results(token);
+        });
     }
 
-    return dirty_memory_region_group().run_when_memory_available([this, &m, m_schema = std::move(m_schema), h = std::move(h), &cg, holder = std::move(holder), guardrails = std::move(guardrails), violations_out]() mutable {
-        return do_apply(cg, std::move(h), m, m_schema, *guardrails, _large_data_guardrail->get_memtable_cache_tracker(*m_schema, m.key()), std::move(violations_out));
+    return dirty_memory_region_group().run_when_memory_available([this, &m, m_schema = std::move(m_schema), h = std::move(h), &cg, holder = std::move(holder), guardrails = std::move(guardrails), violations_out, token]() mutable {
+        do_apply(cg, std::move(h), m, m_schema, *guardrails, _large_data_guardrail->get_memtable_cache_tracker(*m_schema, m.key()), std::move(violations_out));
+        if (token && _schema->caching_options().query_results()) {
+            invalidate_cached_query_results(*token);
+        }
     }, timeout);
 }
 
@@ -5241,9 +5354,14 @@ table::query(schema_ptr query_schema,
     const auto table_async_gate_holder = _async_gate.hold();
     utils::latency_counter lc;
     _stats.reads.set_latency(lc);
+    const auto read_start = utils::latency_counter::now();
+    for (const auto& pr : partition_ranges) {
+        note_tablet_read(pr);
+    }
 
     auto finally = defer([&] () noexcept {
         _stats.reads.mark(lc);
+        _config.cf_stats->foreground_read_latency.add(utils::latency_counter::now() - read_start);
     });
 
     const auto short_read_allowed = query::short_read(cmd.slice.options.contains<query::partition_slice::option::allow_short_read>());
@@ -5813,6 +5931,7 @@ future<> compaction_group::cleanup() {
                   p_range, group_id(), _t.schema()->ks_name(), _t.schema()->cf_name());
     // Since permit is still held, all actions below will be executed atomically:
     co_await _t._cache.invalidate(std::move(updater), p_range);
+    _t.invalidate_cached_query_results();
     _t._cache.refresh_snapshot();
     _t.rebuild_statistics();
 
@@ -5957,6 +6076,26 @@ future<uint64_t> table::estimated_partitions_in_range(dht::token_range tr) const
     co_return partition_count;
 }
 
+std::optional<sstables::repair_hash_digest> table::get_repair_hash_digest(const dht::token_range& tr) const {
+    if (uses_logstor()) {
+        return std::nullopt;
+    }
+    const auto pr = dht::to_partition_range(tr);
+    std::vector<sstables::shared_sstable> sstables;
+    for (const auto& sg : storage_groups_for_token_range(tr)) {
+        bool memtables_empty = true;
+        sg->for_each_compaction_group([&] (const compaction_group_ptr& cg) {
+            memtables_empty &= cg->memtable_empty();
+        });
+        if (!memtables_empty) {
+            return std::nullopt;
+        }
+        auto sg_sstables = sg->make_sstable_set()->select(pr);
+        sstables.insert(sstables.end(), sg_sstables.begin(), sg_sstables.end());
+    }
+    return sstables::get_repair_hash_digest(sstables, tr, *_schema);
+}
+
 tombstone_gc_state table::get_tombstone_gc_state() const {
     return tombstone_gc_state(_compaction_manager.get_shared_tombstone_gc_state());
 }
@@ -12,6 +12,7 @@
 #include "types/types.hh"
 #include "types/tuple.hh"
 #include "types/list.hh"
+#include "types/map.hh"
 #include "db/system_keyspace.hh"
 #include "schema/schema_builder.hh"
 #include "cql3/query_processor.hh"
@@ -41,6 +42,7 @@ static thread_local auto replica_type = tuple_type_impl::get_instance({uuid_type
 static thread_local auto replica_set_type = list_type_impl::get_instance(replica_type, false);
 static thread_local auto tablet_info_type = tuple_type_impl::get_instance({long_type, long_type, replica_set_type});
 static thread_local auto tablet_info_v2_type = tuple_type_impl::get_instance({long_type, long_type, replica_set_type, long_type});
+static thread_local auto split_tokens_type = map_type_impl::get_instance(long_type, long_type, false);
 
 data_type get_replica_set_type() {
     return replica_set_type;
@@ -86,6 +88,7 @@ schema_ptr make_tablets_schema() {
             .with_column("resize_seq_number", long_type, column_kind::static_column)
             .with_column("isolated_tablet_for_merge", long_type, column_kind::static_column)
             .with_column("selected_tablets_for_merge", list_type_impl::get_instance(long_type, false), column_kind::static_column)
+            .with_column("split_tokens", split_tokens_type, column_kind::static_column)
             .with_column("target_pow2_tablet_count", long_type, column_kind::static_column)
             .with_column("repair_time", timestamp_type)
             .with_column("repair_task_info", tablet_task_info_type)
@@ -237,6 +240,16 @@ data_value repair_scheduler_config_to_data_value(const locator::repair_scheduler
     return result;
 };
 
+static
+data_value split_tokens_to_data_value(const std::vector<std::pair<locator::tablet_id, dht::token>>& split_tokens) {
+    map_type_impl::native_type values;
+    values.reserve(split_tokens.size());
+    for (auto& [tid, token] : split_tokens) {
+        values.emplace_back(data_value(int64_t(tid.value())), data_value(dht::token::to_int64(token)));
+    }
+    return make_map_value(split_tokens_type, std::move(values));
+}
+
 // Based on calibration run measuring 6ms time to freeze
 // mutation with 16K tablets (with 9 replicas each) on a
 // 3.4GHz amd64 cpu, and twice as much for unfreeze.
@@ -282,6 +295,9 @@ tablet_map_to_mutations(const tablet_map& tablets, table_id id, const sstring& k
             m.set_static_cell("selected_tablets_for_merge", make_list_value(list_type, std::move(values)), ts);
         }
     }
+    if (auto* split = std::get_if<resize_decision::split>(&tablets.resize_decision().way); split && !split->split_tokens.empty() && features.tablet_split_tokens) {
+        m.set_static_cell("split_tokens", split_tokens_to_data_value(split->split_tokens), ts);
+    }
     if (features.tablet_resize_virtual_task && tablets.resize_task_info().is_valid()) {
         m.set_static_cell("resize_task_info", tablet_task_info_to_data_value(tablets.resize_task_info()), ts);
     }
@@ -433,6 +449,8 @@ tablet_mutation_builder::set_resize_decision(locator::resize_decision resize_dec
                 auto list_type = list_type_impl::get_instance(long_type, false);
                 _m.set_static_cell("selected_tablets_for_merge", make_list_value(list_type, std::move(values)), _ts);
             }
+        } else if (auto& split = std::get<resize_decision::split>(resize_decision.way); !split.split_tokens.empty() && features.tablet_split_tokens) {
+            _m.set_static_cell("split_tokens", split_tokens_to_data_value(split.split_tokens), _ts);
         }
         auto resize_task_info = std::holds_alternative<resize_decision::split>(resize_decision.way)
             ? locator::tablet_task_info::make_split_request()
@@ -447,6 +465,10 @@ tablet_mutation_builder::set_resize_decision(locator::resize_decision resize_dec
         _m.set_static_cell(*col1, atomic_cell::make_dead(_ts, gc_clock::now()));
         auto col2 = _s->get_column_definition("selected_tablets_for_merge");
         _m.set_static_cell(*col2, atomic_cell::make_dead(_ts, gc_clock::now()));
+        if (features.tablet_split_tokens) {
+            auto col3 = _s->get_column_definition("split_tokens");
+            _m.set_static_cell(*col3, atomic_cell::make_dead(_ts, gc_clock::now()));
+        }
         return del_resize_task_info(features);
     }
     return *this;
@@ -609,6 +631,17 @@ locator::repair_scheduler_config deserialize_repair_scheduler_config(cql3::untyp
             repair_scheduler_config_type->deserialize_value(raw_value));
 }
 
+static
+std::vector<std::pair<locator::tablet_id, dht::token>> split_tokens_from_view(cql3::untyped_result_set_row::view_type raw_value) {
+    auto values = value_cast<map_type_impl::native_type>(split_tokens_type->deserialize_value(raw_value));
+    std::vector<std::pair<locator::tablet_id, dht::token>> result;
+    result.reserve(values.size());
+    for (auto& [tid, token] : values) {
+        result.emplace_back(locator::tablet_id(value_cast<int64_t>(tid)), dht::token::from_int64(value_cast<int64_t>(token)));
+    }
+    return result;
+}
+
 future<> save_tablet_metadata(replica::database& db, const tablet_metadata& tm, api::timestamp_type ts) {
     tablet_logger.trace("Saving tablet metadata: {}", tm);
     utils::chunked_vector<frozen_mutation> muts;
@@ -929,7 +962,11 @@ struct tablet_metadata_builder {
                     if (resize_type_name == "none") {
                         return locator::resize_decision(resize_seq_number);
                     } else if (resize_type_name == "split") {
-                        return locator::resize_decision(locator::resize_decision::split(), resize_seq_number);
+                        auto split = locator::resize_decision::split();
+                        if (row.has("split_tokens")) {
+                            split.split_tokens = split_tokens_from_view(row.get_view("split_tokens"));
+                        }
+                        return locator::resize_decision(std::move(split), resize_seq_number);
                     } else if (resize_type_name == "merge") {
                         auto merge = locator::resize_decision::merge {
                             .isolated_tablet = row.get_opt<int64_t>("isolated_tablet_for_merge")
@@ -25,7 +25,11 @@ class caching_options {
     sstring _key_cache;
     sstring _row_cache;
     bool _enabled = true;
-    caching_options(sstring k, sstring r, bool enabled);
+    // Opt-in: allow the coordinator to keep the results of prepared,
+    // single-partition SELECTs in a per-shard cache which is invalidated by
+    // writes to the partition (see replica::query_result_cache).
+    bool _query_results = false;
+    caching_options(sstring k, sstring r, bool enabled, bool query_results = false);
 
     friend class schema;
     caching_options();
@@ -37,6 +41,10 @@ class caching_options {
         return _enabled;
     }
 
+    bool query_results() const {
+        return _enabled && _query_results;
+    }
+
     std::map<sstring, sstring> to_map() const;
 
     sstring to_sstring() const;
@@ -12,6 +12,7 @@
 
 #include "gms/inet_address.hh"
 #include "locator/host_id.hh"
+#include "locator/tablets.hh"
 #include "utils/atomic_vector.hh"
 #include "service/client_routes.hh"
 
@@ -67,6 +68,13 @@ class endpoint_lifecycle_subscriber {
      */
     virtual void on_down(const gms::inet_address& endpoint, locator::host_id host_id) {}
     virtual void on_client_routes_change(const client_routes_service::client_route_keys& client_route_keys) {}
+
+    /**
+     * Called when tablets of a table move or change.
+     *
+     * @param tablets the current routing of the changed tablets.
+     */
+    virtual void on_tablets_change(const sstring& ks_name, const sstring& cf_name, const std::vector<locator::tablet_routing_info>& tablets) {}
 };
 
 class endpoint_lifecycle_notifier {
@@ -83,6 +91,7 @@ class endpoint_lifecycle_notifier {
     future<> notify_joined(gms::inet_address endpoint, locator::host_id host_id);
 
     future<> notify_client_routes_change(const client_routes_service::client_route_keys& client_route_keys);
+    future<> notify_tablets_change(const sstring& ks_name, const sstring& cf_name, const std::vector<locator::tablet_routing_info>& tablets);
 };
 
 }
@@ -272,6 +272,7 @@ class storage_proxy::remote {
         ser::storage_proxy_rpc_verbs::register_mutation_done(&_ms, std::bind_front(&remote::handle_mutation_done, this));
         ser::storage_proxy_rpc_verbs::register_mutation_failed(&_ms, std::bind_front(&remote::handle_mutation_failed, this));
         ser::storage_proxy_rpc_verbs::register_read_data(&_ms, std::bind_front(&remote::handle_read_data, this));
+        ser::storage_proxy_rpc_verbs::register_read_data_batch(&_ms, std::bind_front(&remote::handle_read_data_batch, this));
         ser::storage_proxy_rpc_verbs::register_read_mutation_data(&_ms, std::bind_front(&remote::handle_read_mutation_data, this));
         ser::storage_proxy_rpc_verbs::register_read_digest(&_ms, std::bind_front(&remote::handle_read_digest, this));
         ser::storage_proxy_rpc_verbs::register_truncate(&_ms, std::bind_front(&remote::handle_truncate, this));
@@ -422,6 +423,25 @@ class storage_proxy::remote {
         co_return rpc::tuple{make_foreign(::make_lw_shared<query::result>(std::move(result))), hit_rate.value_or(cache_temperature::invalid())};
     }
 
+    future<rpc::tuple<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>, cache_temperature>>
+    send_read_data_batch(
+            locator::host_id addr, storage_proxy::clock_type::time_point timeout, tracing::trace_state_ptr tr_state,
+            const query::read_command& cmd, const dht::partition_range_vector& prs,
+            query::digest_algorithm digest_algo, fencing_token fence) {
+        tracing::trace(tr_state, "read_data_batch: sending a message with {} partitions to /{}", prs.size(), addr);
+        auto&& [results, hit_rate, exception] =
+            co_await ser::storage_proxy_rpc_verbs::send_read_data_batch(&_ms, addr, timeout, cmd, prs, digest_algo, fence);
+        if (exception) {
+            co_await coroutine::return_exception_ptr(exception.into_exception_ptr());
+        }
+
+        tracing::trace(tr_state, "read_data_batch: got response from /{}", addr);
+        co_return rpc::tuple{results
+                | std::views::as_rvalue
+                | std::views::transform([] (query::result&& r) { return make_foreign(::make_lw_shared<query::result>(std::move(r))); })
+                | std::ranges::to<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>>(), hit_rate};
+    }
+
     future<rpc::tuple<query::result_digest, api::timestamp_type, cache_temperature, std::optional<full_position>>>
     send_read_digest(
             locator::host_id addr, storage_proxy::clock_type::time_point timeout, tracing::trace_state_ptr tr_state,
@@ -968,6 +988,75 @@ class storage_proxy::remote {
             std::move(pr), oda, rate_limit_info_opt, fence);
     }
 
+    using read_data_batch_result_t = rpc::tuple<foreign_ptr<lw_shared_ptr<std::vector<query::result>>>, cache_temperature, replica::exception_variant>;
+    future<read_data_batch_result_t> handle_read_data_batch(
+            const rpc::client_info& cinfo, rpc::opt_time_point t,
+            query::read_command cmd1, dht::partition_range_vector prs,
+            query::digest_algorithm da,
+            service::fencing_token fence) {
+        tracing::trace_state_ptr trace_state_ptr;
+        auto src_addr = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
+        auto src_shard = cinfo.retrieve_auxiliary<uint32_t>("src_cpu_id");
+        const auto fence_opt = std::make_optional(fence);
+
+        if (cmd1.trace_info) {
+            trace_state_ptr = tracing::tracing::get_local_tracing_instance().create_session(*cmd1.trace_info);
+            tracing::begin(trace_state_ptr);
+            tracing::trace(trace_state_ptr, "read_data_batch: message with {} partitions received from /{}", prs.size(), src_addr);
+        }
+
+        // Check the fence early to avoid querying the schema for stale requests.
+        if (auto f = _sp.apply_fence_result<read_data_batch_result_t>(fence_opt, src_addr)) {
+            co_return co_await std::move(*f);
+        }
+
+        if (!cmd1.max_result_size) {
+            auto& cfg = _sp.local_db().get_config();
+            cmd1.max_result_size.emplace(cfg.max_memory_for_unlimited_query_soft_limit(), cfg.max_memory_for_unlimited_query_hard_limit());
+        }
+        shared_ptr<storage_proxy> p = _sp.shared_from_this();
+        auto cmd = make_lw_shared<query::read_command>(std::move(cmd1));
+        auto timeout = t ? *t : db::no_timeout;
+
+        // The verb is only sent by nodes supporting native reversed queries,
+        // so the command never needs to be converted from the legacy format.
+        auto f_s = co_await coroutine::as_future(get_schema_for_read(cmd->schema_version, src_addr, src_shard, timeout));
+        if (f_s.failed()) {
+            co_return co_await encode_replica_exception_for_rpc<read_data_batch_result_t>(p->features(), f_s.get_exception());
+        }
+        schema_ptr s = f_s.get();
+
+        // This erm ensures that tablet migrations wait for replica requests,
+        // even if the coordinator is no longer available.
+        auto erm = s->table().get_effective_replication_map();
+
+        p->get_stats().replica_data_batch_reads++;
+        query::result_options opts;
+        opts.digest_algo = da;
+        opts.request = da == query::digest_algorithm::none ? query::result_request::only_result : query::result_request::result_and_digest;
+        auto f = co_await coroutine::as_future(p->query_result_local_batch(erm, std::move(s), cmd, prs, opts, trace_state_ptr, timeout));
+        tracing::trace(trace_state_ptr, "read_data_batch handling is done, sending a response to /{}", src_addr);
+
+        if (auto f = _sp.apply_fence_result<read_data_batch_result_t>(fence_opt, src_addr)) {
+            co_return co_await std::move(*f);
+        }
+        if (f.failed()) {
+            co_return co_await encode_replica_exception_for_rpc<read_data_batch_result_t>(p->features(), f.get_exception());
+        }
+
+        // The results live on the shards which produced them, while the
+        // response is serialized as a single object on this shard.
+        auto&& [results, hit_rate] = f.get();
+        auto response = make_lw_shared<std::vector<query::result>>();
+        response->reserve(results.size());
+        for (const auto& r : results) {
+            response->emplace_back(bytes_ostream(r->buf()), r->digest(), r->last_modified(), r->is_short_read(),
+                    r->row_count_low_bits(), r->partition_count(), r->row_count_high_bits(), r->last_position());
+            co_await coroutine::maybe_yield();
+        }
+        co_return read_data_batch_result_t(make_foreign(std::move(response)), hit_rate, replica::exception_variant{});
+    }
+
     using read_mutation_data_result_t = rpc::tuple<foreign_ptr<lw_shared_ptr<reconcilable_result>>, cache_temperature, replica::exception_variant>;
     future<read_mutation_data_result_t> handle_read_mutation_data(
             const rpc::client_info& cinfo, rpc::opt_time_point t,
@@ -3124,6 +3213,14 @@ void storage_proxy_stats::stats::register_stats() {
                        sm::description("number of range read operations failed due to an \"unavailable\" error"),
                        {storage_proxy_stats::current_scheduling_group_label(), basic_level}).set_skip_when_empty(),
 
+        sm::make_total_operations("batched_reads", batched_reads,
+                       sm::description("number of batched multi-partition read requests sent to replicas"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
+        sm::make_total_operations("batched_read_partitions", batched_read_partitions,
+                       sm::description("number of partitions read through batched multi-partition read requests"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
         sm::make_total_operations("speculative_digest_reads", speculative_digest_reads,
                        sm::description("number of speculative digest read requests that were sent"),
                        {storage_proxy_stats::current_scheduling_group_label(), basic_level}).set_skip_when_empty(),
@@ -3227,17 +3324,21 @@ void storage_proxy_stats::stats::register_stats() {
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
 
         sm::make_total_operations("reads", replica_data_reads,
-                       sm::description("number of remote reads this Node received. op_type label could be data, mutation_data or digest"),
+                       sm::description("number of remote reads this Node received. op_type label could be data, mutation_data, digest or data_batch"),
                        {storage_proxy_stats::current_scheduling_group_label(), storage_proxy_stats::op_type_label("data")}).set_skip_when_empty(),
 
         sm::make_total_operations("reads", replica_mutation_data_reads,
-                       sm::description("number of remote reads this Node received. op_type label could be data, mutation_data or digest"),
+                       sm::description("number of remote reads this Node received. op_type label could be data, mutation_data, digest or data_batch"),
                        {storage_proxy_stats::current_scheduling_group_label(), storage_proxy_stats::op_type_label("mutation_data")}).set_skip_when_empty(),
 
         sm::make_total_operations("reads", replica_digest_reads,
-                       sm::description("number of remote reads this Node received. op_type label could be data, mutation_data or digest"),
+                       sm::description("number of remote reads this Node received. op_type label could be data, mutation_data, digest or data_batch"),
                        {storage_proxy_stats::current_scheduling_group_label(), storage_proxy_stats::op_type_label("digest")}).set_skip_when_empty(),
 
+        sm::make_total_operations("reads", replica_data_batch_reads,
+                       sm::description("number of remote reads this Node received. op_type label could be data, mutation_data, digest or data_batch"),
+                       {storage_proxy_stats::current_scheduling_group_label(), storage_proxy_stats::op_type_label("data_batch")}).set_skip_when_empty(),
+
         sm::make_total_operations("cross_shard_ops", replica_cross_shard_ops,
                        sm::description("number of operations that crossed a shard boundary"),
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
@@ -6313,6 +6414,54 @@ storage_proxy::query_result_local(locator::effective_replication_map_ptr erm, sc
     }
 }
 
+future<rpc::tuple<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>, cache_temperature>>
+storage_proxy::query_result_local_batch(locator::effective_replication_map_ptr erm, schema_ptr query_schema, lw_shared_ptr<query::read_command> cmd,
+                                        const dht::partition_range_vector& prs, query::result_options opts,
+                                        tracing::trace_state_ptr trace_state, storage_proxy::clock_type::time_point timeout) {
+    cmd->slice.options.set_if<query::partition_slice::option::with_digest>(opts.request != query::result_request::only_result);
+
+    struct shard_batch {
+        dht::partition_range_vector ranges;
+        std::vector<size_t> positions;
+    };
+    std::vector<shard_batch> batches(smp::count);
+    const auto& sharder = erm->get_sharder(*query_schema);
+    for (size_t i = 0; i < prs.size(); ++i) {
+        if (!prs[i].is_singular()) {
+            on_internal_error(slogger, format("query_result_local_batch: non-singular range {}", prs[i]));
+        }
+        auto& batch = batches[sharder.shard_for_reads(prs[i].start()->value().token())];
+        batch.ranges.push_back(prs[i]);
+        batch.positions.push_back(i);
+    }
+
+    std::vector<foreign_ptr<lw_shared_ptr<query::result>>> results(prs.size());
+    cache_temperature hit_rate = cache_temperature::invalid();
+    co_await coroutine::parallel_for_each(std::views::iota(0u, smp::count), [&] (unsigned shard) -> future<> {
+        auto& batch = batches[shard];
+        if (batch.ranges.empty()) {
+            co_return;
+        }
+        get_stats().replica_cross_shard_ops += shard != this_shard_id();
+        auto [shard_results, shard_hit_rate] = co_await _db.invoke_on(shard, _read_smp_service_group, [gs = global_schema_ptr(query_schema), &ranges = batch.ranges, cmd, opts, timeout,
+                gt = tracing::global_trace_state_ptr(trace_state)] (replica::database& db) -> future<std::tuple<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>, cache_temperature>> {
+            auto trace_state = gt.get();
+            tracing::trace(trace_state, "Start querying a batch of {} singular ranges", ranges.size());
+            auto [res, ht] = co_await db.query_batch(gs, *cmd, opts, ranges, trace_state, timeout);
+            tracing::trace(trace_state, "Querying is done");
+            co_return std::tuple(res
+                    | std::views::as_rvalue
+                    | std::views::transform([] (lw_shared_ptr<query::result>&& r) { return make_foreign(std::move(r)); })
+                    | std::ranges::to<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>>(), ht);
+        });
+        for (size_t i = 0; i < batch.positions.size(); ++i) {
+            results[batch.positions[i]] = std::move(shard_results[i]);
+        }
+        hit_rate = shard_hit_rate;
+    });
+    co_return rpc::tuple(std::move(results), hit_rate);
+}
+
 void storage_proxy::handle_read_error(std::variant<exceptions::coordinator_exception_container, std::exception_ptr> failure, bool range) {
     // All errors are handled, it's OK to discard the result.
     (void)utils::result_try([&] () -> result<> {
@@ -6348,11 +6497,15 @@ storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
         dht::partition_range_vector&& partition_ranges,
         db::consistency_level cl,
         storage_proxy::coordinator_query_options query_options) {
+    schema_ptr schema = local_schema_registry().get(cmd->schema_version);
+
+    if (can_batch_singular_read(*schema, *cmd, partition_ranges, cl, query_options)) {
+        co_return co_await query_singular_batched(std::move(cmd), std::move(partition_ranges), cl, std::move(query_options));
+    }
+
     utils::small_vector<std::pair<::shared_ptr<abstract_read_executor>, dht::token_range>, 1> exec;
     exec.reserve(partition_ranges.size());
 
-    schema_ptr schema = local_schema_registry().get(cmd->schema_version);
-
     replica::table& table = _db.local().find_column_family(schema->id());
     auto erm = table.get_effective_replication_map();
 
@@ -6444,6 +6597,245 @@ storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
     co_return coordinator_query_result(std::move(result).value(), std::move(used_replicas), repair_decision);
 }
 
+bool storage_proxy::can_batch_singular_read(const schema& s, const query::read_command& cmd, const dht::partition_range_vector& partition_ranges,
+        db::consistency_level cl, const coordinator_query_options& query_options) const {
+    const auto threshold = _db.local().get_config().multi_partition_read_batching_threshold();
+    if (threshold == 0 || partition_ranges.size() < threshold || !features().batched_singular_reads) {
+        return false;
+    }
+    // A batched read contacts a single replica per partition: there are no
+    // digests to compare and nothing to repair.
+    if (cl != db::consistency_level::ONE && cl != db::consistency_level::LOCAL_ONE) {
+        return false;
+    }
+    if (query_options.read_repair_decision.value_or(db::read_repair_decision::NONE) != db::read_repair_decision::NONE) {
+        return false;
+    }
+    // Per-partition rate limits are only accounted by the regular read path.
+    if (cmd.allow_limit && _db.local().can_apply_per_partition_rate_limit(s, db::operation_type::read)) {
+        return false;
+    }
+    return !cmd.slice.is_reversed() || features().native_reverse_queries;
+}
+
+// Reads a batch of partitions served by the same replica. Like
+// speculating_read_executor, when the replica doesn't answer within the
+// speculative retry delay of the table, or fails, the batch is also sent to
+// the extra replica shared by all partitions of the batch, and the first
+// successful response wins.
+class batched_read_executor : public enable_shared_from_this<batched_read_executor> {
+public:
+    using result_type = rpc::tuple<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>, cache_temperature>;
+private:
+    using clock_type = storage_proxy::clock_type;
+    shared_ptr<storage_proxy> _proxy;
+    locator::effective_replication_map_ptr _erm;
+    schema_ptr _schema;
+    lw_shared_ptr<replica::column_family> _cf;
+    lw_shared_ptr<query::read_command> _cmd;
+    dht::partition_range_vector _ranges;
+    locator::host_id _target;
+    std::optional<locator::host_id> _extra;
+    tracing::trace_state_ptr _trace_state;
+    clock_type::time_point _timeout;
+    fencing_token _fence;
+    promise<result_type> _result;
+    timer<clock_type> _speculate_timer;
+    unsigned _pending = 0;
+    bool _done = false;
+    bool _speculated = false;
+    std::exception_ptr _last_error;
+public:
+    batched_read_executor(shared_ptr<storage_proxy> proxy, locator::effective_replication_map_ptr erm, schema_ptr schema,
+            lw_shared_ptr<replica::column_family> cf, lw_shared_ptr<query::read_command> cmd, dht::partition_range_vector ranges,
+            locator::host_id target, std::optional<locator::host_id> extra, tracing::trace_state_ptr trace_state,
+            clock_type::time_point timeout, fencing_token fence)
+        : _proxy(std::move(proxy))
+        , _erm(std::move(erm))
+        , _schema(std::move(schema))
+        , _cf(std::move(cf))
+        , _cmd(std::move(cmd))
+        , _ranges(std::move(ranges))
+        , _target(target)
+        , _extra(extra)
+        , _trace_state(std::move(trace_state))
+        , _timeout(timeout)
+        , _fence(fence)
+    {}
+
+    future<result_type> execute() {
+        auto f = _result.get_future();
+        if (_extra) {
+            // The timer only fires while the request to the target is
+            // pending, and that request keeps the executor alive.
+            _speculate_timer.set_callback([this] {
+                speculate();
+            });
+            auto& sr = _schema->speculative_retry();
+            auto t = (sr.get_type() == speculative_retry::type::PERCENTILE) ?
+                std::min(_cf->get_coordinator_read_latency_percentile(sr.get_value()), std::chrono::milliseconds(_proxy->_timeout_config.read_timeout_in_ms()/2)) :
+                std::chrono::milliseconds(unsigned(sr.get_value()));
+            _speculate_timer.arm(t);
+        }
+        send(_target);
+        return f;
+    }
+private:
+    future<result_type> read_from(locator::host_id ep) {
+        auto opts = query::result_options{query::result_request::only_result, query::digest_algorithm::none};
+        if (_proxy->is_me(*_erm, ep)) {
+            return _proxy->apply_fence_on_ready(_proxy->query_result_local_batch(_erm, _schema, _cmd, _ranges, opts, _trace_state, _timeout), _fence, _proxy->my_host_id(*_erm));
+        }
+        return _proxy->remote().send_read_data_batch(ep, _timeout, _trace_state, *_cmd, _ranges, opts.digest_algo, _fence);
+    }
+
+    void send(locator::host_id ep) {
+        ++_pending;
+        _proxy->get_stats().batched_reads++;
+        _proxy->get_stats().batched_read_partitions += _ranges.size();
+        utils::latency_counter lc;
+        lc.start();
+        // Keeps the executor alive until every request it sent completes.
+        (void)read_from(ep).then_wrapped([this, self = shared_from_this(), ep, lc] (future<result_type> f) mutable {
+            --_pending;
+            if (f.failed()) {
+                _last_error = f.get_exception();
+                tracing::trace(_trace_state, "Batched read from /{} failed: {}", ep, _last_error);
+                if (!_done) {
+                    if (!_speculated && _speculate_timer.cancel()) {
+                        speculate();
+                    } else if (!_pending) {
+                        _done = true;
+                        _result.set_exception(_last_error);
+                    }
+                }
+                return;
+            }
+            auto res = f.get();
+            _cf->set_hit_rate(ep, std::get<1>(res));
+            _cf->add_coordinator_read_latency(lc.stop().latency());
+            if (!_done) {
+                _done = true;
+                _speculate_timer.cancel();
+                _result.set_value(std::move(res));
+            }
+        });
+    }
+
+    void speculate() {
+        if (_done || _speculated) {
+            return;
+        }
+        _speculated = true;
+        _proxy->get_stats().speculative_data_reads++;
+        tracing::trace(_trace_state, "Launching speculative retry of a batch of {} partitions to /{}", _ranges.size(), *_extra);
+        send(*_extra);
+    }
+};
+
+future<result<storage_proxy::coordinator_query_result>>
+storage_proxy::query_singular_batched(lw_shared_ptr<query::read_command> cmd,
+        dht::partition_range_vector&& partition_ranges,
+        db::consistency_level cl,
+        storage_proxy::coordinator_query_options query_options) {
+    schema_ptr schema = local_schema_registry().get(cmd->schema_version);
+
+    replica::table& table = _db.local().find_column_family(schema->id());
+    auto cf = table.shared_from_this();
+    auto erm = table.get_effective_replication_map();
+    const auto retry_type = schema->speculative_retry().get_type();
+    auto local_dc_filter = erm->get_topology().get_local_dc_filter();
+
+    // Partitions served by the same replica and with the same extra replica
+    // to speculate with, along with their position in `partition_ranges`,
+    // so the results can be merged in request order.
+    struct replica_batch {
+        dht::partition_range_vector ranges;
+        std::vector<size_t> positions;
+    };
+    std::map<std::pair<locator::host_id, std::optional<locator::host_id>>, replica_batch> batches;
+    replicas_per_token_range used_replicas;
+    bool is_read_non_local = false;
+
+    for (size_t i = 0; i < partition_ranges.size(); ++i) {
+        auto& pr = partition_ranges[i];
+        if (!pr.is_singular()) {
+            co_await coroutine::return_exception(std::runtime_error("mixed singular and non singular range are not supported"));
+        }
+
+        const dht::token& token = pr.start()->value().token();
+        auto token_range = dht::token_range::make_singular(token);
+        auto it = query_options.preferred_replicas.find(token_range);
+        const auto preferred_replicas = it == query_options.preferred_replicas.end()
+            ? host_id_vector_replica_set{} : (it->second | std::ranges::to<host_id_vector_replica_set>());
+
+        host_id_vector_replica_set all_replicas = get_endpoints_for_reading(*schema, *erm, token, query_options.node_local_only);
+        is_read_non_local |= !all_replicas.empty() && all_replicas.front() != erm->get_topology().my_host_id();
+        std::optional<locator::host_id> extra_replica;
+        host_id_vector_replica_set target_replicas = filter_replicas_for_read(cl, *erm, all_replicas, preferred_replicas, db::read_repair_decision::NONE,
+                retry_type == speculative_retry::type::NONE ? nullptr : &extra_replica,
+                _db.local().get_config().cache_hit_rate_read_balancing() ? &*cf : nullptr);
+
+        try {
+            db::assure_sufficient_live_nodes(cl, *erm, target_replicas, host_id_vector_topology_change{});
+        } catch (exceptions::unavailable_exception& ex) {
+            slogger.debug("Read unavailable: cl={} required {} alive {}", ex.consistency, ex.required, ex.alive);
+            get_stats().read_unavailables.mark();
+            throw;
+        }
+
+        // Same rules as get_read_executor() for CL=ONE/LOCAL_ONE without read repair.
+        if (extra_replica && db::is_datacenter_local(cl) && !local_dc_filter(*extra_replica)) {
+            extra_replica.reset();
+        }
+
+        const auto target = target_replicas.front();
+        auto& batch = batches[std::pair(target, extra_replica)];
+        batch.ranges.push_back(std::move(pr));
+        batch.positions.push_back(i);
+        used_replicas.emplace(std::move(token_range), std::vector<locator::host_id>{target});
+    }
+    if (is_read_non_local) {
+        get_stats().reads_coordinator_outside_replica_set++;
+    }
+
+    tracing::trace(query_options.trace_state, "Batching {} partitions into {} replica reads", partition_ranges.size(), batches.size());
+
+    // keeps sp alive for the co-routine lifetime
+    auto p = shared_from_this();
+
+    const auto timeout = query_options.timeout(*this);
+    const auto fence = get_fence(*erm);
+    std::vector<foreign_ptr<lw_shared_ptr<query::result>>> results(partition_ranges.size());
+
+    try {
+        co_await coroutine::parallel_for_each(batches, [&] (auto& key_and_batch) -> future<> {
+            auto& [key, batch] = key_and_batch;
+            auto positions = std::move(batch.positions);
+            auto executor = ::make_shared<batched_read_executor>(p, erm, schema, cf, cmd, std::move(batch.ranges),
+                    key.first, key.second, query_options.trace_state, timeout, fence);
+            auto [batch_results, hit_rate] = co_await executor->execute();
+            for (size_t i = 0; i < positions.size(); ++i) {
+                results[positions[i]] = std::move(batch_results[i]);
+            }
+        });
+    } catch (...) {
+        auto ex = std::current_exception();
+        if (try_catch<rpc::timeout_error>(ex) || try_catch<timed_out_error>(ex)) {
+            ex = std::make_exception_ptr(read_timeout_exception(schema->ks_name(), schema->cf_name(), cl, 0, 1, false));
+        }
+        handle_read_error(ex, false);
+        std::rethrow_exception(std::move(ex));
+    }
+
+    query::result_merger merger(cmd->get_row_limit(), cmd->partition_limit);
+    merger.reserve(results.size());
+    for (auto& r : results) {
+        merger(std::move(r));
+    }
+    co_return coordinator_query_result(merger.get(), std::move(used_replicas));
+}
+
 bool storage_proxy::is_worth_merging_for_range_query(
         const locator::topology& topo,
         host_id_vector_replica_set& merged,
@@ -368,6 +368,17 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
             dht::partition_range_vector&& partition_ranges,
             db::consistency_level cl,
             coordinator_query_options optional_params);
+    // Checks whether a multi-partition singular read can be served by
+    // query_singular_batched() instead of one read executor per partition.
+    bool can_batch_singular_read(const schema& s, const query::read_command& cmd, const dht::partition_range_vector& partition_ranges,
+            db::consistency_level cl, const coordinator_query_options& optional_params) const;
+    // Groups the partitions by the replica serving them and sends a single
+    // read_data_batch request to each replica. The results are merged in the
+    // order of `partition_ranges`.
+    future<result<coordinator_query_result>> query_singular_batched(lw_shared_ptr<query::read_command> cmd,
+            dht::partition_range_vector&& partition_ranges,
+            db::consistency_level cl,
+            coordinator_query_options optional_params);
     response_id_type register_response_handler(shared_ptr<abstract_write_response_handler>&& h);
     void remove_response_handler(response_id_type id);
     void remove_response_handler_entry(response_handlers_map::iterator entry);
@@ -441,6 +452,16 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
             tracing::trace_state_ptr trace_state,
             clock_type::time_point timeout,
             db::per_partition_rate_limit::info rate_limit_info);
+    // Reads a batch of singular partition ranges owned by this node. The ranges
+    // are grouped by shard and each shard serves its group under a single
+    // reader permit. Returns one result per range, in the order of `prs`.
+    future<rpc::tuple<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>, cache_temperature>> query_result_local_batch(
+            locator::effective_replication_map_ptr,
+            schema_ptr,
+            lw_shared_ptr<query::read_command> cmd, const dht::partition_range_vector& prs,
+            query::result_options opts,
+            tracing::trace_state_ptr trace_state,
+            clock_type::time_point timeout);
     future<rpc::tuple<query::result_digest, api::timestamp_type, cache_temperature, std::optional<full_position>>> query_result_local_digest(
             locator::effective_replication_map_ptr,
             schema_ptr,
@@ -904,6 +925,7 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
     friend class abstract_read_executor;
     friend class abstract_write_response_handler;
     friend class speculating_read_executor;
+    friend class batched_read_executor;
     friend class view_update_backlog_broker;
     friend class paxos_response_handler;
     friend class mutation_holder;
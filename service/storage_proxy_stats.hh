@@ -139,6 +139,11 @@ struct stats : public write_stats {
 
     cas_contention_histogram cas_read_contention;
 
+    // number of batched multi-partition reads sent as a coordinator and
+    // the number of partitions they carried
+    uint64_t batched_reads = 0;
+    uint64_t batched_read_partitions = 0;
+
     uint64_t read_repair_attempts = 0;
     uint64_t read_repair_repaired_blocking = 0;
     uint64_t read_repair_repaired_background = 0;
@@ -158,6 +163,7 @@ struct stats : public write_stats {
     uint64_t replica_data_reads = 0;
     uint64_t replica_digest_reads = 0;
     uint64_t replica_mutation_data_reads = 0;
+    uint64_t replica_data_batch_reads = 0;
 
     uint64_t replica_cross_shard_ops = 0;
 
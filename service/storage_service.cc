@@ -648,6 +648,162 @@ future<> storage_service::notify_nodes_after_sync(nodes_to_notify_after_sync&& n
     }
 }
 
+void storage_service::schedule_tablets_change_notification(const locator::tablet_metadata_change_hint& hint) {
+    if (!hint) {
+        // The whole tablet metadata was reloaded, so every table has to be checked.
+        _pending_tablets_full_reload = true;
+    }
+    for (const auto& [id, table_hint] : hint.tables) {
+        auto [it, inserted] = _pending_tablets_change.tables.try_emplace(id, table_hint);
+        auto& pending = it->second;
+        if (inserted || pending.full_read) {
+            continue;
+        }
+        if (table_hint.full_read || table_hint.tokens.empty()) {
+            pending.full_read = true;
+            pending.tokens.clear();
+        } else {
+            pending.tokens.insert(pending.tokens.end(), table_hint.tokens.begin(), table_hint.tokens.end());
+        }
+    }
+    _tablets_change_event.signal();
+}
+
+future<> storage_service::notify_tablets_change(const locator::tablet_metadata_change_hint& hint, bool full_reload) {
+    // Bounds the size of a single TABLETS_CHANGE event.
+    static constexpr size_t max_tablets_per_event = 1024;
+
+    auto tmptr = get_token_metadata_ptr();
+    const auto& tablets = tmptr->tablets();
+
+    std::unordered_map<table_id, const locator::tablet_metadata_change_hint::table_hint*> to_check;
+    if (full_reload) {
+        std::erase_if(_notified_tablet_maps, [&] (const auto& e) { return !tablets.has_tablet_map(e.first); });
+        for (const auto& [base_id, _] : tablets.all_table_groups()) {
+            to_check.emplace(base_id, nullptr);
+        }
+    }
+    for (const auto& [id, table_hint] : hint.tables) {
+        if (!tablets.has_tablet_map(id)) {
+            _notified_tablet_maps.erase(id);
+            continue;
+        }
+        // Only the given tokens are checked, unless the table has to be checked as a whole.
+        auto partial = !full_reload && !table_hint.full_read && !table_hint.tokens.empty();
+        auto [it, inserted] = to_check.emplace(tablets.get_base_table(id), partial ? &table_hint : nullptr);
+        if (!inserted && it->second != &table_hint) {
+            it->second = nullptr;
+        }
+    }
+
+    for (const auto& [base_id, table_hint] : to_check) {
+        auto tmap_ptr = co_await tablets.get_tablet_map_ptr(base_id);
+        const auto& tmap = *tmap_ptr;
+        auto notified = _notified_tablet_maps.find(base_id);
+        if (notified == _notified_tablet_maps.end()) {
+            // Drivers learn about the tablets of a new table from the
+            // tablets-routing-v1 payload, only later changes are sent.
+            _notified_tablet_maps.emplace(base_id, std::move(tmap_ptr));
+            continue;
+        }
+        const auto& old_tmap = *notified->second;
+
+        // Only tablets whose replicas changed are sent, so the intermediate
+        // stages of a migration, which keep the replicas of the tablet, are not.
+        // A split or a merge changes all tablets.
+        std::vector<locator::tablet_id> tids;
+        if (old_tmap.tablet_count() != tmap.tablet_count()) {
+            tids.reserve(tmap.tablet_count());
+            std::ranges::copy(tmap.tablet_ids(), std::back_inserter(tids));
+        } else if (table_hint) {
+            for (auto token : table_hint->tokens) {
+                auto tid = tmap.get_tablet_id(token);
+                if (old_tmap.get_tablet_info(tid).replicas != tmap.get_tablet_info(tid).replicas) {
+                    tids.push_back(tid);
+                }
+            }
+            std::ranges::sort(tids);
+            tids.erase(std::ranges::unique(tids).begin(), tids.end());
+        } else {
+            for (auto tid : tmap.tablet_ids()) {
+                if (old_tmap.get_tablet_info(tid).replicas != tmap.get_tablet_info(tid).replicas) {
+                    tids.push_back(tid);
+                }
+                co_await coroutine::maybe_yield();
+            }
+        }
+        notified->second = std::move(tmap_ptr);
+        if (tids.empty()) {
+            continue;
+        }
+
+        std::vector<locator::tablet_routing_info> routing;
+        routing.reserve(tids.size());
+        for (auto tid : tids) {
+            auto first_token = tid == tmap.first_tablet() ? dht::minimum_token() : tmap.get_last_token(locator::tablet_id(size_t(tid) - 1));
+            routing.push_back(locator::tablet_routing_info{
+                tmap.get_tablet_info(tid).replicas,
+                std::make_pair(first_token, tmap.get_last_token(tid)),
+            });
+            co_await coroutine::maybe_yield();
+        }
+
+        // Co-located tables share the tablets of their base table.
+        locator::table_group_set group{base_id};
+        if (auto it = tablets.all_table_groups().find(base_id); it != tablets.all_table_groups().end()) {
+            group = it->second;
+        }
+        for (auto id : group) {
+            auto t = _db.local().get_tables_metadata().get_table_if_exists(id);
+            if (!t) {
+                continue;
+            }
+            auto s = t->schema();
+            for (size_t i = 0; i < routing.size(); i += max_tablets_per_event) {
+                std::vector<locator::tablet_routing_info> chunk(routing.begin() + i, routing.begin() + std::min(i + max_tablets_per_event, routing.size()));
+                co_await container().invoke_on_all([&s, &chunk] (auto&& ss) {
+                    return ss._lifecycle_notifier.notify_tablets_change(s->ks_name(), s->cf_name(), chunk);
+                });
+            }
+        }
+    }
+}
+
+future<> storage_service::run_tablets_change_notifier() {
+    // Changes made while drivers are being notified, or during the pause
+    // which follows, are coalesced into the next round of notifications.
+    static constexpr auto min_notification_interval = std::chrono::milliseconds(100);
+
+    auto can_proceed = [this] { return !_async_gate.is_closed() && !_group0_as.abort_requested(); };
+    while (can_proceed()) {
+        co_await _tablets_change_event.when([&] {
+            return _pending_tablets_change || _pending_tablets_full_reload || !can_proceed();
+        });
+        if (!can_proceed()) {
+            break;
+        }
+        auto hint = std::exchange(_pending_tablets_change, {});
+        auto full_reload = std::exchange(_pending_tablets_full_reload, false);
+        try {
+            co_await notify_tablets_change(hint, full_reload);
+        } catch (...) {
+            slogger.warn("Failed to notify drivers about tablets changes: {}", std::current_exception());
+        }
+        try {
+            co_await sleep_abortable(min_notification_interval, _group0_as);
+        } catch (const sleep_aborted&) {
+            break;
+        }
+    }
+}
+
+void storage_service::start_tablets_change_notifier() {
+    if (this_shard_id() != 0) {
+        return;
+    }
+    _tablets_change_notifier = run_tablets_change_notifier();
+}
+
 future<> storage_service::topology_state_load(state_change_hint hint) {
 #ifdef SEASTAR_DEBUG
     static bool running = false;
@@ -760,6 +916,7 @@ future<> storage_service::topology_state_load(state_change_hint hint) {
         co_await replicate_to_all_cores(std::move(tmptr));
         rtlogger.debug("topology_state_load: notifying nodes after token metadata replication");
         co_await notify_nodes_after_sync(std::move(nodes_to_notify));
+        schedule_tablets_change_notification(hint.tablets_hint.value_or(locator::tablet_metadata_change_hint{}));
         rtlogger.debug("topology_state_load: token metadata replication to all cores finished");
     }
 
@@ -1743,6 +1900,7 @@ future<> storage_service::join_topology(sharded<service::storage_proxy>& proxy,
 
     // Initializes monitor only after updating local topology.
     start_tablet_split_monitor();
+    start_tablets_change_notifier();
 
     auto ids = _topology_state_machine._topology.normal_nodes |
                 std::views::keys |
@@ -2365,6 +2523,8 @@ future<> storage_service::stop() {
     co_await _async_gate.close();
     _tablet_split_monitor_event.signal();
     co_await std::move(_tablet_split_monitor);
+    _tablets_change_event.signal();
+    co_await std::move(_tablets_change_notifier);
 }
 
 future<> storage_service::wait_for_group0_stop() {
@@ -4089,6 +4249,7 @@ future<> storage_service::update_tablet_metadata(const locator::tablet_metadata_
     auto change = co_await prepare_tablet_metadata(hint,
             co_await get_mutable_token_metadata_ptr());
     co_await replicate_to_all_cores(std::move(change));
+    schedule_tablets_change_notification(hint);
     wake_up_topology_state_machine();
 }
 
@@ -6152,6 +6313,7 @@ future<locator::load_stats> storage_service::load_stats_for_tablet_based_tables(
             locator::combined_load_stats combined_ls { table->table_load_stats() };
             load_stats.tables.emplace(id, std::move(combined_ls.table_ls));
             tablet_sizes_per_shard[this_shard_id()].size += load_stats.tablet_stats[this_host].add_tablet_sizes(combined_ls.tablet_ls);
+            load_stats.request_stats[this_host].add_tablet_rates(combined_ls.tablet_rs);
 
             co_await coroutine::maybe_yield();
         }
@@ -6305,6 +6467,50 @@ future<> storage_service::set_tablet_balancing_enabled(bool enabled) {
     }
 }
 
+future<tablet_balancer_snapshot> storage_service::get_tablet_balancer_snapshot() {
+    auto holder = _async_gate.hold();
+
+    if (this_shard_id() != 0) {
+        co_return co_await container().invoke_on(0, [] (auto& ss) {
+            return ss.get_tablet_balancer_snapshot();
+        });
+    }
+
+    static constexpr std::chrono::seconds load_stats_timeout{30};
+    auto tm = get_token_metadata_ptr();
+    const auto nodes = tm->get_topology().get_nodes();
+    locator::load_stats stats;
+
+    co_await coroutine::parallel_for_each(nodes, [&] (const locator::node& node) -> future<> {
+        auto dst = node.host_id();
+        if (!node.is_member()) {
+            co_return;
+        }
+        if (!_gossiper.is_alive(dst)) {
+            slogger.warn("Tablet balancer snapshot: node {} is down, its tablet sizes are missing", dst);
+            co_return;
+        }
+
+        abort_source as;
+        auto request_abort = [&as] () mutable noexcept {
+            as.request_abort();
+        };
+        auto t = timer<lowres_clock>(request_abort);
+        t.arm(lowres_clock::now() + load_stats_timeout);
+        auto sub = _abort_source.subscribe(request_abort);
+
+        auto dst_server = raft::server_id(dst.uuid());
+        if (_feature_service.tablet_load_stats_v2) {
+            stats += co_await ser::storage_service_rpc_verbs::send_table_load_stats(&_messaging.local(), dst, as, dst_server);
+        } else {
+            stats += locator::load_stats::from_v1(
+                    co_await ser::storage_service_rpc_verbs::send_table_load_stats_v1(&_messaging.local(), dst, as, dst_server));
+        }
+    });
+
+    co_return co_await make_tablet_balancer_snapshot(*tm, stats, _db.local());
+}
+
 future<utils::UUID> storage_service::submit_quiesce_topology_request() {
     while (true) {
         auto guard = co_await _group0->client().start_operation(_group0_as, raft_timeout{});
@@ -7128,6 +7334,18 @@ future<> endpoint_lifecycle_notifier::notify_client_routes_change(const client_r
     });
 }
 
+future<> endpoint_lifecycle_notifier::notify_tablets_change(const sstring& ks_name, const sstring& cf_name, const std::vector<locator::tablet_routing_info>& tablets) {
+    co_await seastar::async([this, &ks_name, &cf_name, &tablets] {
+        _subscribers.thread_for_each([&ks_name, &cf_name, &tablets] (endpoint_lifecycle_subscriber* subscriber) {
+            try {
+                subscriber->on_tablets_change(ks_name, cf_name, tablets);
+            } catch (...) {
+                slogger.warn("Tablets change notification of {}.{} failed: {}", ks_name, cf_name, std::current_exception());
+            }
+        });
+    });
+}
+
 future<> storage_service::notify_joined(inet_address endpoint, locator::host_id hid) {
     co_await utils::get_local_injector().inject(
         "storage_service_notify_joined_sleep", std::chrono::milliseconds{500});
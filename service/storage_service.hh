@@ -45,6 +45,7 @@
 #include "raft/server.hh"
 #include "db/view/view_building_state.hh"
 #include "service/tablet_allocator.hh"
+#include "service/tablet_balancer_snapshot.hh"
 #include "service/tablet_operation.hh"
 #include "mutation/timestamp.hh"
 #include "utils/UUID.hh"
@@ -225,6 +226,14 @@ class storage_service : public service::migration_listener, public gms::i_endpoi
     utils::sequenced_set<table_id> _tablet_split_candidates;
     future<> _tablet_split_monitor = make_ready_future<>();
 
+    // Tablets changed since the last TABLETS_CHANGE notification, see run_tablets_change_notifier().
+    locator::tablet_metadata_change_hint _pending_tablets_change;
+    bool _pending_tablets_full_reload = false;
+    condition_variable _tablets_change_event;
+    future<> _tablets_change_notifier = make_ready_future<>();
+    // The tablet maps the drivers were last notified about, by base table.
+    std::unordered_map<table_id, locator::tablet_metadata::tablet_map_ptr> _notified_tablet_maps;
+
     shared_ptr<node_ops::task_manager_module> _node_ops_module;
     shared_ptr<service::task_manager_module> _tablets_module;
     shared_ptr<service::topo::task_manager_module> _global_topology_requests_module;
@@ -241,6 +250,7 @@ class storage_service : public service::migration_listener, public gms::i_endpoi
     future<> process_tablet_split_candidate(table_id) noexcept;
     void register_tablet_split_candidate(table_id) noexcept;
     future<> run_tablet_split_monitor();
+    future<> run_tablets_change_notifier();
     void check_raft_rpc(raft::server_id dst);
 public:
     future<service::tablet_operation_result> do_tablet_operation(locator::global_tablet_id tablet,
@@ -339,6 +349,7 @@ class storage_service : public service::migration_listener, public gms::i_endpoi
     tablets_pow2_convergence_status get_tablets_pow2_convergence_status(const sstring& ks_name) const;
 
     void start_tablet_split_monitor();
+    void start_tablets_change_notifier();
 private:
     using acquire_merge_lock = bool_class<class acquire_merge_lock_tag>;
 
@@ -992,6 +1003,8 @@ class storage_service : public service::migration_listener, public gms::i_endpoi
     future<> restore_tablets(table_id, sstring snap_name);
     future<> abort_restore_tablets(table_id);
     future<> set_tablet_balancing_enabled(bool);
+    // Collects the load stats from all the token owners, see tablet_balancer_snapshot.
+    future<tablet_balancer_snapshot> get_tablet_balancer_snapshot();
 
     future<utils::UUID> submit_quiesce_topology_request();
     future<> await_topology_quiesced();
@@ -1054,6 +1067,13 @@ class storage_service : public service::migration_listener, public gms::i_endpoi
     // Triggers notifications (on_joined, on_left) based on the recent changes to token metadata, as described by the passed in structure.
     // This function should be called on the result of `sync_raft_topology_nodes`, after the global token metadata is updated.
     future<> notify_nodes_after_sync(nodes_to_notify_after_sync&& nodes_to_notify);
+    // Queues pushing the new routing of the tablets changed according to the hint to the drivers,
+    // an empty hint means the whole tablet metadata was reloaded. The drivers are notified in the
+    // background by run_tablets_change_notifier().
+    // This function should be called after the global token metadata is updated.
+    void schedule_tablets_change_notification(const locator::tablet_metadata_change_hint& hint);
+    // Pushes the routing of the tablets whose replicas changed since the drivers were last notified.
+    future<> notify_tablets_change(const locator::tablet_metadata_change_hint& hint, bool full_reload);
     // load topology state machine snapshot into memory
     // raft_group0_client::_read_apply_mutex must be held
     future<> topology_state_load(state_change_hint hint = {});
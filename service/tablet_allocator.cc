@@ -663,6 +663,8 @@ class load_balancer {
     // shards and nodes can have different capacity. If force_capacity_based_balancing is false,
     // tablet sizes are fetched from load_stats.
     // So we equalize: sum of tablet_sizes / capacity_in_bytes.
+    // When request rates are balanced too, the size of a tablet is blended with its request rate
+    // expressed in bytes, see get_bytes_per_request().
     using load_type = double;
 
     using table_candidates_map = std::unordered_map<table_id, std::unordered_set<migration_tablet_set>>;
@@ -986,6 +988,21 @@ class load_balancer {
     // the balancer will use this size instead of the actual tablet size.
     uint64_t _minimal_tablet_size = service::default_target_tablet_size / 100;
 
+    // The weight of tablet request rates in the load, between 0 and 1. The weight of tablet sizes is the rest.
+    double _request_rate_weight = 0;
+
+    // The minimal relative difference between the load of the source and the load of the destination
+    // post-movement for a migration, when request rates are part of the load.
+    double _request_rate_hysteresis = 0;
+
+    // The load in bytes of a request per second in the balanced node set, or 0 if request rates
+    // are not part of the load. See get_bytes_per_request().
+    double _bytes_per_request = 0;
+
+    // The request rate of a tablet replica above which the table is split, or 0 if request
+    // rates do not drive tablet resizing.
+    double _split_request_rate_threshold = 0;
+
 private:
     tablet_replica_set get_replicas_for_tablet_load(const tablet_info& ti, const tablet_transition_info* trinfo) const {
         // We reflect migrations in the load as if they already happened,
@@ -1078,7 +1095,10 @@ class load_balancer {
         , _skiplist(std::move(skiplist))
         , _size_based_balance_threshold(db.get_config().size_based_balance_threshold_percentage() / 100.0)
         , _force_capacity_based_balancing(db.get_config().force_capacity_based_balancing())
-        , _minimal_tablet_size(db.get_config().minimal_tablet_size_for_balancing()) {
+        , _minimal_tablet_size(db.get_config().minimal_tablet_size_for_balancing())
+        , _request_rate_weight(std::clamp<double>(db.get_config().tablet_load_balancing_request_rate_weight(), 0, 1))
+        , _request_rate_hysteresis(db.get_config().tablet_load_balancing_hysteresis_percentage() / 100.0)
+        , _split_request_rate_threshold(std::max<double>(db.get_config().tablet_split_request_rate_threshold(), 0)) {
 
         // Force capacity based balancing until all the nodes have been upgraded
         if (!_db.features().size_based_load_balancing && !_force_capacity_based_balancing) {
@@ -1444,6 +1464,7 @@ class load_balancer {
         }
 
         uint64_t tablet_group_size = 0;
+        double tablet_group_request_rate = 0;
         auto token_range = tmap.get_token_range(tid);
         auto it = _tm->tablets().all_table_groups().find(table);
         const auto& colocated_tables = it != _tm->tablets().all_table_groups().end() ? it->second : table_group_set{};
@@ -1454,10 +1475,63 @@ class load_balancer {
             auto trinfo = member_tmap.get_tablet_transition_info(tid);
             auto tablet_size_opt = get_tablet_size(host, rb_tid, ti, trinfo);
             tablet_group_size += std::max(tablet_size_opt.value_or(_target_tablet_size), _minimal_tablet_size);
+            if (_bytes_per_request) {
+                if (auto rate = _table_load_stats->get_tablet_request_rate_in_transition(host, rb_tid, ti, trinfo)) {
+                    tablet_group_request_rate += rate->total();
+                }
+            }
+        }
+        if (_bytes_per_request) {
+            return std::llround((1 - _request_rate_weight) * tablet_group_size
+                    + _request_rate_weight * tablet_group_request_rate * _bytes_per_request);
         }
         return tablet_group_size;
     }
 
+    // Returns the number of bytes which a request per second to a tablet adds to its load,
+    // chosen so that the request rates of all the tablets in the balanced node set add up
+    // to their total size. So a tablet serving a given share of the requests carries that
+    // share of the storage in load, and blending sizes with request rates leaves the total
+    // load, and so the load of a balanced node, unchanged.
+    //
+    // Returns 0 if request rates should not be part of the load, including when some node
+    // did not report them, e.g. because it was not upgraded yet.
+    double get_bytes_per_request(const node_load_map& nodes) const {
+        if (!_request_rate_weight || _force_capacity_based_balancing || !_table_load_stats) {
+            return 0;
+        }
+        double total_size = 0;
+        double total_rate = 0;
+        for (auto& [host, node] : nodes) {
+            auto rates_i = _table_load_stats->request_stats.find(host);
+            auto sizes_i = _table_load_stats->tablet_stats.find(host);
+            if (rates_i == _table_load_stats->request_stats.end() || sizes_i == _table_load_stats->tablet_stats.end()) {
+                if (node.drained) {
+                    continue;
+                }
+                lblogger.debug("Node {} did not report tablet request rates, balancing storage only", host);
+                return 0;
+            }
+            for (auto& [table, sizes] : sizes_i->second.tablet_sizes) {
+                for (auto& [range, size] : sizes) {
+                    total_size += size;
+                }
+            }
+            for (auto& [table, rates] : rates_i->second.tablet_rates) {
+                for (auto& [range, rate] : rates) {
+                    total_rate += rate.total();
+                }
+            }
+        }
+        return total_rate > 0 ? total_size / total_rate : 0;
+    }
+
+    // Request rates fluctuate, so when they are part of the load, a migration has to improve
+    // the balance by a margin, otherwise tablets could move back and forth between rounds.
+    double load_hysteresis() const {
+        return _bytes_per_request ? _request_rate_hysteresis : 0;
+    }
+
     future<migration_plan> make_rack_list_colocation_plan(const migration_plan& mplan) {
         lblogger.debug("In make_rack_list_colocation_plan");
 
@@ -2354,6 +2428,88 @@ class load_balancer {
         return _table_load_stats->get_avg_tablet_size(tmap, global_tablet_id{table, tid});
     }
 
+    // Calls func(tid, host, rate) with the request rate of each replica of each tablet of the table group,
+    // summed over the co-located tables. Stops and returns false when a replica did not report the
+    // request rates of its tablets.
+    template <typename Func>
+    requires std::invocable<Func, tablet_id, host_id, const tablet_request_rate&>
+    bool for_each_tablet_request_rate(const tablet_map& tmap, const locator::table_group_set& tables, Func&& func) const {
+        if (!_table_load_stats) {
+            return false;
+        }
+        for (auto tid : tmap.tablet_ids()) {
+            auto token_range = tmap.get_token_range(tid);
+            auto& ti = tmap.get_tablet_info(tid);
+            auto trinfo = tmap.get_tablet_transition_info(tid);
+            for (auto& replica : ti.replicas) {
+                tablet_request_rate rate;
+                for (auto table : tables) {
+                    auto table_rate = _table_load_stats->get_tablet_request_rate_in_transition(replica.host,
+                            range_based_tablet_id{table, token_range}, ti, trinfo);
+                    if (!table_rate) {
+                        return false;
+                    }
+                    // The median token of the busiest table of the group stands for the group.
+                    auto median_token = table_rate->total() > rate.total() ? table_rate->median_token : rate.median_token;
+                    rate += *table_rate;
+                    rate.median_token = median_token;
+                }
+                func(tid, replica.host, rate);
+            }
+        }
+        return true;
+    }
+
+    // Returns the highest request rate of a replica of a tablet of the table group,
+    // or std::nullopt if some replica did not report its request rates.
+    std::optional<double> get_max_tablet_request_rate(const tablet_map& tmap, const locator::table_group_set& tables) const {
+        double max_rate = 0;
+        if (!for_each_tablet_request_rate(tmap, tables, [&] (tablet_id, host_id, const tablet_request_rate& rate) {
+            max_rate = std::max(max_rate, rate.total());
+        })) {
+            return std::nullopt;
+        }
+        return max_rate;
+    }
+
+    // Produces split plan.
+    // Tablets whose replicas serve more requests than _split_request_rate_threshold are split
+    // at the token which splits their requests in half, as reported by their busiest replica,
+    // so that both halves cool down. Other tablets are split at the midpoint of their range.
+    // Tables with a power-of-two tablet count keep their tablets aligned to the powers of two,
+    // see tablet_layout::pow_of_2, so they are always split at the midpoints.
+    resize_decision_way make_split_decision(table_id table, const tablet_map& tmap, bool pow2_count) const {
+        if (pow2_count || !_split_request_rate_threshold || !_db.features().tablet_split_tokens) {
+            return resize_decision::split{};
+        }
+
+        const auto& tables = _tm->tablets().all_table_groups().at(table);
+        std::map<tablet_id, std::pair<double, dht::token>> busiest;
+        for_each_tablet_request_rate(tmap, tables, [&] (tablet_id tid, host_id, const tablet_request_rate& rate) {
+            if (rate.total() <= _split_request_rate_threshold || !rate.median_token) {
+                return;
+            }
+            auto [it, inserted] = busiest.try_emplace(tid, rate.total(), *rate.median_token);
+            if (!inserted && rate.total() > it->second.first) {
+                it->second = {rate.total(), *rate.median_token};
+            }
+        });
+
+        resize_decision::split split;
+        for (auto& [tid, rate_and_token] : busiest) {
+            auto token = rate_and_token.second;
+            // The replica reported the median for the range of the tablet it had, which might
+            // have changed since.
+            auto range = tmap.get_token_range(tid);
+            if (!range.contains(token, dht::token_comparator()) || token == tmap.get_last_token(tid)) {
+                continue;
+            }
+            lblogger.debug("Tablet {}:{} will be split at token {} instead of {}", table, tid, token, tmap.get_split_token(tid));
+            split.split_tokens.emplace_back(tid, token);
+        }
+        return split;
+    }
+
     // Produces merge plan.
     // This is not about deciding if we should merge, but how to do a merge.
     // Returns resize_decision::none if we cannot decide how to do a merge, e.g. due to missing tablet stats.
@@ -2505,6 +2661,23 @@ class load_balancer {
 
                 result.avg_tablet_size = avg_tablet_size;
                 maybe_apply({tablet_count_from_size, format("avg_tablet_size={}", avg_tablet_size)});
+
+                // Split when a tablet replica serves more requests than the threshold. Like with sizes,
+                // the split is cancelled only when crossing back the half-way point.
+                // A merge doubles the request rates of the tablets, so it is held off until they fall
+                // below a quarter of the threshold, which leaves a margin against splitting again.
+                const auto* tmap = _tm->tablets().has_tablet_map(table) ? &_tm->tablets().get_tablet_map(table) : nullptr;
+                if (_split_request_rate_threshold && tmap && tmap->tablet_count() == tablet_count) {
+                    if (auto max_rate = get_max_tablet_request_rate(*tmap, tables)) {
+                        auto reason = format("max_tablet_request_rate={:.1f}", *max_rate);
+                        if (*max_rate > _split_request_rate_threshold ||
+                            (cur_decision.is_split() && *max_rate >= _split_request_rate_threshold / 2)) {
+                            maybe_apply({tablet_count * 2, std::move(reason)});
+                        } else if (*max_rate >= _split_request_rate_threshold / 4) {
+                            maybe_apply({tablet_count, std::move(reason)});
+                        }
+                    }
+                }
             } else {
                 // When we don't have tablet size info, allow tablet count to increase but not to decrease.
                 // Increasing will always bring us closer to the true target count, since tablet_count_from_size
@@ -2777,7 +2950,14 @@ class load_balancer {
             }
 
             if (table_plan.target_tablet_count_aligned > table_plan.current_tablet_count) {
-                table_plan.resize_decision = locator::resize_decision::split();
+                if (!_tm->tablets().has_tablet_map(table)) {
+                    table_plan.resize_decision = locator::resize_decision::split();
+                } else if (auto& tmap = _tm->tablets().get_tablet_map(table); tmap.resize_decision().is_split()) {
+                    // Preserve split tokens if we're already splitting
+                    table_plan.resize_decision = tmap.resize_decision().way;
+                } else {
+                    table_plan.resize_decision = make_split_decision(table, tmap, table_plan.pow2_count);
+                }
             } else if (table_plan.target_tablet_count_aligned < table_plan.current_tablet_count) {
                 // Needed to avoid oscillations, because we reduce the count by a factor of 2.
                 // FIXME: Once we have a way to split individual tablets, we can achieve exactly the desired tablet count.
@@ -3031,7 +3211,7 @@ class load_balancer {
         }
 
         const load_type load_delta = max_load - min_load;
-        return (load_delta / max_load) < _size_based_balance_threshold;
+        return (load_delta / max_load) < std::max(_size_based_balance_threshold, load_hysteresis());
     }
 
     // If cluster cannot agree on tablet merge feature, then merge will not be finalized since
@@ -3276,7 +3456,7 @@ class load_balancer {
         }
 
         // Prevent load inversion post-movement which can lead to oscillations.
-        if (src_info.avg_load <= *dst_info.get_avg_load(tablet_sizes)) {
+        if (src_info.avg_load * (1 - load_hysteresis()) <= *dst_info.get_avg_load(tablet_sizes)) {
             lblogger.trace("Load inversion post-movement: src={} (avg_load={}), dst={} (avg_load={}) tablet_sizes={}",
                            src_info.id, src_info.avg_load, dst_info.id, dst_info.avg_load, tablet_sizes);
             return false;
@@ -3294,7 +3474,12 @@ class load_balancer {
     // Can be called when node_info.drained.
     bool check_intranode_convergence(const node_load& node_info, shard_id src_shard, shard_id dst_shard,
                                      uint64_t used_size_delta) {
-        return node_info.shard_load(src_shard) > node_info.shard_load(dst_shard, int64_t(used_size_delta));
+        auto src_load = node_info.shard_load(src_shard);
+        auto dst_load = node_info.shard_load(dst_shard, int64_t(used_size_delta));
+        if (src_load && dst_load) {
+            return *src_load * (1 - load_hysteresis()) > *dst_load;
+        }
+        return src_load > dst_load;
     }
 
     // Can be called when node_info.drained.
@@ -4366,6 +4551,7 @@ class load_balancer {
 
         node_load_map nodes;
         std::unordered_set<host_id> nodes_to_drain;
+        _bytes_per_request = 0;
 
         _tm->for_each_token_owner([&] (const locator::node& node) {
             if (!node_filter(node)) {
@@ -4516,6 +4702,12 @@ class load_balancer {
             }
         }
 
+        _bytes_per_request = get_bytes_per_request(nodes);
+        if (_bytes_per_request) {
+            lblogger.debug("Balancing request rates with weight {} ({} bytes per request/s), hysteresis {}",
+                    _request_rate_weight, _bytes_per_request, _request_rate_hysteresis);
+        }
+
         // Check if we have destination nodes
         const bool has_dest_nodes = std::ranges::any_of(std::views::values(nodes), [&] (const auto& load) {
             return !load.drained;
@@ -0,0 +1,287 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include "service/tablet_balancer_snapshot.hh"
+#include "replica/database.hh"
+#include "utils/overloaded_functor.hh"
+
+namespace service {
+
+future<tablet_balancer_snapshot> make_tablet_balancer_snapshot(const locator::token_metadata& tm, const locator::load_stats& stats, const replica::database& db) {
+    tablet_balancer_snapshot snapshot;
+
+    for (const auto& [dc, nodes] : tm.get_datacenter_token_owners_nodes()) {
+        for (const auto& n : nodes) {
+            const auto& node = n.get();
+            tablet_balancer_snapshot::node sn{
+                .id = node.host_id(),
+                .dc_rack = node.dc_rack(),
+                .shard_count = node.get_shard_count(),
+                .state = locator::node::to_string(node.get_state()),
+                .draining = node.is_draining(),
+            };
+            if (auto it = stats.capacity.find(node.host_id()); it != stats.capacity.end()) {
+                sn.capacity = it->second;
+            }
+            if (auto it = stats.tablet_stats.find(node.host_id()); it != stats.tablet_stats.end()) {
+                sn.effective_capacity = it->second.effective_capacity;
+            }
+            snapshot.nodes.push_back(std::move(sn));
+        }
+    }
+
+    std::unordered_set<sstring> keyspaces;
+    for (const auto& [id, tmap] : tm.tablets().all_tables_ungrouped()) {
+        auto t = db.get_tables_metadata().get_table_if_exists(id);
+        if (!t) {
+            continue;
+        }
+        const auto& s = *t->schema();
+        if (keyspaces.insert(s.ks_name()).second) {
+            const auto& ksm = *db.find_keyspace(s.ks_name()).metadata();
+            snapshot.keyspaces.push_back(tablet_balancer_snapshot::keyspace{
+                .name = s.ks_name(),
+                .replication = ksm.strategy_options(),
+            });
+        }
+
+        tablet_balancer_snapshot::table st{
+            .id = id,
+            .keyspace = s.ks_name(),
+            .name = s.cf_name(),
+        };
+        if (!tm.tablets().is_base_table(id)) {
+            st.base_table = tm.tablets().get_base_table(id);
+        }
+        st.tablets.reserve(tmap->tablet_count());
+        for (auto tid : tmap->tablet_ids()) {
+            const auto range = tmap->get_token_range(tid);
+            const locator::range_based_tablet_id rb_tid{id, range};
+            tablet_balancer_snapshot::tablet tablet{.last_token = tmap->get_last_token(tid)};
+            for (const auto& r : tmap->get_tablet_info(tid).replicas) {
+                tablet.replicas.push_back(tablet_balancer_snapshot::replica{
+                    .replica = r,
+                    .size = stats.get_tablet_size(r.host, rb_tid),
+                    .rate = stats.get_tablet_request_rate(r.host, rb_tid),
+                });
+            }
+            st.tablets.push_back(std::move(tablet));
+            co_await coroutine::maybe_yield();
+        }
+        snapshot.tables.push_back(std::move(st));
+    }
+
+    co_return snapshot;
+}
+
+static rjson::value replication_to_json(const locator::replication_strategy_config_options& options) {
+    auto v = rjson::empty_object();
+    for (const auto& [key, option] : options) {
+        std::visit(overloaded_functor{
+            [&] (const sstring& value) {
+                rjson::add_with_string_name(v, key, rjson::from_string(value));
+            },
+            [&] (const locator::rack_list& racks) {
+                auto a = rjson::empty_array();
+                for (const auto& rack : racks) {
+                    rjson::push_back(a, rjson::from_string(rack));
+                }
+                rjson::add_with_string_name(v, key, std::move(a));
+            },
+        }, option);
+    }
+    return v;
+}
+
+static locator::replication_strategy_config_options replication_from_json(const rjson::value& v) {
+    locator::replication_strategy_config_options options;
+    for (auto it = v.MemberBegin(); it != v.MemberEnd(); ++it) {
+        auto key = rjson::to_sstring(it->name);
+        if (it->value.IsArray()) {
+            locator::rack_list racks;
+            for (const auto& rack : it->value.GetArray()) {
+                racks.push_back(rjson::to_sstring(rack));
+            }
+            options.emplace(std::move(key), std::move(racks));
+        } else {
+            options.emplace(std::move(key), rjson::to_sstring(it->value));
+        }
+    }
+    return options;
+}
+
+future<rjson::value> tablet_balancer_snapshot_to_json(const tablet_balancer_snapshot& snapshot) {
+    auto nodes = rjson::empty_array();
+    for (const auto& n : snapshot.nodes) {
+        auto v = rjson::empty_object();
+        rjson::add(v, "host_id", rjson::from_string(n.id.to_sstring()));
+        rjson::add(v, "dc", rjson::from_string(n.dc_rack.dc));
+        rjson::add(v, "rack", rjson::from_string(n.dc_rack.rack));
+        rjson::add(v, "shards", n.shard_count);
+        rjson::add(v, "state", rjson::from_string(n.state));
+        rjson::add(v, "draining", n.draining);
+        if (n.capacity) {
+            rjson::add(v, "capacity", *n.capacity);
+        }
+        if (n.effective_capacity) {
+            rjson::add(v, "effective_capacity", *n.effective_capacity);
+        }
+        rjson::push_back(nodes, std::move(v));
+    }
+
+    auto keyspaces = rjson::empty_array();
+    for (const auto& ks : snapshot.keyspaces) {
+        auto v = rjson::empty_object();
+        rjson::add(v, "name", rjson::from_string(ks.name));
+        rjson::add(v, "replication", replication_to_json(ks.replication));
+        rjson::push_back(keyspaces, std::move(v));
+    }
+
+    auto tables = rjson::empty_array();
+    for (const auto& t : snapshot.tables) {
+        auto v = rjson::empty_object();
+        rjson::add(v, "id", rjson::from_string(t.id.to_sstring()));
+        rjson::add(v, "keyspace", rjson::from_string(t.keyspace));
+        rjson::add(v, "name", rjson::from_string(t.name));
+        if (t.base_table) {
+            rjson::add(v, "base_table", rjson::from_string(t.base_table->to_sstring()));
+        }
+        auto tablets = rjson::empty_array();
+        for (const auto& tablet : t.tablets) {
+            auto tv = rjson::empty_object();
+            rjson::add(tv, "last_token", dht::token::to_int64(tablet.last_token));
+            auto replicas = rjson::empty_array();
+            for (const auto& r : tablet.replicas) {
+                auto rv = rjson::empty_object();
+                rjson::add(rv, "host", rjson::from_string(r.replica.host.to_sstring()));
+                rjson::add(rv, "shard", r.replica.shard);
+                if (r.size) {
+                    rjson::add(rv, "size", *r.size);
+                }
+                if (r.rate) {
+                    rjson::add(rv, "reads", r.rate->reads);
+                    rjson::add(rv, "writes", r.rate->writes);
+                }
+                rjson::push_back(replicas, std::move(rv));
+            }
+            rjson::add(tv, "replicas", std::move(replicas));
+            rjson::push_back(tablets, std::move(tv));
+            co_await coroutine::maybe_yield();
+        }
+        rjson::add(v, "tablets", std::move(tablets));
+        rjson::push_back(tables, std::move(v));
+    }
+
+    auto v = rjson::empty_object();
+    rjson::add(v, "version", tablet_balancer_snapshot::format_version);
+    rjson::add(v, "nodes", std::move(nodes));
+    rjson::add(v, "keyspaces", std::move(keyspaces));
+    rjson::add(v, "tables", std::move(tables));
+    co_return v;
+}
+
+tablet_balancer_snapshot tablet_balancer_snapshot_from_json(const rjson::value& v) {
+    const auto version = rjson::get<int>(v, "version");
+    if (version != tablet_balancer_snapshot::format_version) {
+        throw std::runtime_error(fmt::format("Unsupported tablet balancer snapshot version {}, expected {}",
+                version, tablet_balancer_snapshot::format_version));
+    }
+
+    tablet_balancer_snapshot snapshot;
+    for (const auto& n : rjson::get(v, "nodes").GetArray()) {
+        snapshot.nodes.push_back(tablet_balancer_snapshot::node{
+            .id = locator::host_id(utils::UUID(rjson::to_string_view(rjson::get(n, "host_id")))),
+            .dc_rack = {rjson::to_sstring(rjson::get(n, "dc")), rjson::to_sstring(rjson::get(n, "rack"))},
+            .shard_count = rjson::get<unsigned>(n, "shards"),
+            .state = rjson::to_sstring(rjson::get(n, "state")),
+            .draining = rjson::get_opt<bool>(n, "draining").value_or(false),
+            .capacity = rjson::get_opt<uint64_t>(n, "capacity"),
+            .effective_capacity = rjson::get_opt<uint64_t>(n, "effective_capacity"),
+        });
+    }
+
+    for (const auto& ks : rjson::get(v, "keyspaces").GetArray()) {
+        snapshot.keyspaces.push_back(tablet_balancer_snapshot::keyspace{
+            .name = rjson::to_sstring(rjson::get(ks, "name")),
+            .replication = replication_from_json(rjson::get(ks, "replication")),
+        });
+    }
+
+    for (const auto& t : rjson::get(v, "tables").GetArray()) {
+        tablet_balancer_snapshot::table st{
+            .id = table_id(utils::UUID(rjson::to_string_view(rjson::get(t, "id")))),
+            .keyspace = rjson::to_sstring(rjson::get(t, "keyspace")),
+            .name = rjson::to_sstring(rjson::get(t, "name")),
+        };
+        if (auto* base = rjson::find(t, "base_table")) {
+            st.base_table = table_id(utils::UUID(rjson::to_string_view(*base)));
+        }
+        for (const auto& tv : rjson::get(t, "tablets").GetArray()) {
+            tablet_balancer_snapshot::tablet tablet{.last_token = rjson::to_token(rjson::get(tv, "last_token"))};
+            for (const auto& rv : rjson::get(tv, "replicas").GetArray()) {
+                tablet_balancer_snapshot::replica r{
+                    .replica = locator::tablet_replica{
+                        locator::host_id(utils::UUID(rjson::to_string_view(rjson::get(rv, "host")))),
+                        rjson::get<unsigned>(rv, "shard"),
+                    },
+                    .size = rjson::get_opt<uint64_t>(rv, "size"),
+                };
+                auto reads = rjson::get_opt<double>(rv, "reads");
+                auto writes = rjson::get_opt<double>(rv, "writes");
+                if (reads || writes) {
+                    r.rate = locator::tablet_request_rate{reads.value_or(0), writes.value_or(0)};
+                }
+                tablet.replicas.push_back(std::move(r));
+            }
+            st.tablets.push_back(std::move(tablet));
+        }
+        snapshot.tables.push_back(std::move(st));
+    }
+    return snapshot;
+}
+
+locator::load_stats tablet_balancer_snapshot_load_stats(const tablet_balancer_snapshot& snapshot) {
+    locator::load_stats stats;
+    for (const auto& n : snapshot.nodes) {
+        if (n.capacity) {
+            stats.capacity[n.id] = *n.capacity;
+        }
+        if (n.effective_capacity) {
+            stats.tablet_stats[n.id].effective_capacity = *n.effective_capacity;
+        }
+    }
+    for (const auto& t : snapshot.tables) {
+        uint64_t size = 0;
+        size_t replicas = 0;
+        std::optional<dht::token> prev_last_token;
+        for (const auto& tablet : t.tablets) {
+            // Tablet ranges in load_stats are in the form (a, b].
+            auto range = dht::token_range::make({prev_last_token.value_or(dht::minimum_token()), false}, {tablet.last_token, true});
+            prev_last_token = tablet.last_token;
+            for (const auto& r : tablet.replicas) {
+                if (r.size) {
+                    stats.tablet_stats[r.replica.host].tablet_sizes[t.id][range] = *r.size;
+                    size += *r.size;
+                    ++replicas;
+                }
+                if (r.rate) {
+                    stats.request_stats[r.replica.host].tablet_rates[t.id][range] = *r.rate;
+                }
+            }
+        }
+        if (replicas) {
+            // The size of a single replica of the table, as the topology coordinator computes it.
+            stats.tables[t.id].size_in_bytes = double(size) / replicas * t.tablets.size();
+        }
+    }
+    return stats;
+}
+
+} // namespace service
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
+
+#include "locator/abstract_replication_strategy.hh"
+#include "locator/tablets.hh"
+#include "locator/token_metadata.hh"
+#include "replica/database_fwd.hh"
+#include "utils/rjson.hh"
+
+namespace service {
+
+/// The state the tablet load balancer works on: the token owners, the
+/// replication of the keyspaces using tablets, their tablet maps, and the
+/// sizes and request rates of the tablet replicas.
+///
+/// A snapshot of a live cluster can be taken through the REST API and
+/// replayed offline by perf-load-balancing, which rebuilds an equivalent
+/// cluster from it and runs the balancer until it converges.
+/// Tablet transitions and resize decisions in progress are not captured.
+struct tablet_balancer_snapshot {
+    // Version of the JSON format, bumped on incompatible changes.
+    static constexpr int format_version = 1;
+
+    struct node {
+        locator::host_id id;
+        locator::endpoint_dc_rack dc_rack;
+        unsigned shard_count = 0;
+        sstring state;
+        // The balancer is moving the replicas away from the node.
+        bool draining = false;
+        std::optional<uint64_t> capacity;
+        std::optional<uint64_t> effective_capacity;
+    };
+
+    struct keyspace {
+        sstring name;
+        locator::replication_strategy_config_options replication;
+    };
+
+    struct replica {
+        locator::tablet_replica replica;
+        std::optional<uint64_t> size;
+        std::optional<locator::tablet_request_rate> rate;
+    };
+
+    struct tablet {
+        dht::token last_token;
+        std::vector<replica> replicas;
+    };
+
+    struct table {
+        table_id id;
+        sstring keyspace;
+        sstring name;
+        // Set for the tables which share the tablet map of a base table.
+        std::optional<table_id> base_table;
+        std::vector<tablet> tablets;
+    };
+
+    std::vector<node> nodes;
+    std::vector<keyspace> keyspaces;
+    std::vector<table> tables;
+};
+
+/// Takes a snapshot of the tablets of `tm`, with the tablet sizes and request
+/// rates of `stats`, for the tables of `db` which use tablets.
+future<tablet_balancer_snapshot> make_tablet_balancer_snapshot(const locator::token_metadata& tm, const locator::load_stats& stats, const replica::database& db);
+
+future<rjson::value> tablet_balancer_snapshot_to_json(const tablet_balancer_snapshot&);
+
+/// Throws std::runtime_error if `v` is not a snapshot in a supported format.
+tablet_balancer_snapshot tablet_balancer_snapshot_from_json(const rjson::value& v);
+
+/// Returns the load_stats which the snapshot was taken with.
+locator::load_stats tablet_balancer_snapshot_load_stats(const tablet_balancer_snapshot&);
+
+} // namespace service
@@ -6,14 +6,18 @@
  * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
  */
 
+#include <deque>
 #include <stdexcept>
 #include <cstdlib>
 
 #include <seastar/core/align.hh>
 #include <seastar/core/bitops.hh>
 #include <seastar/core/byteorder.hh>
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/fstream.hh>
 #include <seastar/core/on_internal_error.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/smp.hh>
 
 #include "compress.hh"
 #include "compressor.hh"
@@ -600,37 +604,72 @@ inline input_stream<char> make_compressed_file_input_stream(sstables::stream_cre
 // compressed_file_data_sink_impl works as a filter for a file output stream,
 // where the buffer flushed will be compressed and its checksum computed, then
 // the result passed to a regular output stream.
+//
+// If helper shards are given, the chunks are compressed on them, in batches,
+// while the owning shard keeps producing data. The batches are appended to
+// the output in order, as they come back. All memory of a batch is allocated
+// on the owning shard and the batch travels wrapped in a foreign_ptr, so it's
+// always freed there. Compressors keep their contexts in thread-local state,
+// so the compressor of the sstable can be used from other shards.
 template <typename ChecksumType, compressed_checksum_mode mode>
 requires ChecksumUtils<ChecksumType>
 class compressed_file_data_sink_impl : public data_sink_impl {
+    struct chunk {
+        temporary_buffer<char> data;
+        // Room for compressed data and the checksum following it.
+        temporary_buffer<char> compressed;
+        size_t len = 0;
+    };
+    using batch = std::vector<chunk>;
+    using foreign_batch = foreign_ptr<std::unique_ptr<batch>>;
+
+    // Uncompressed size of a batch sent to a helper shard. Large enough to
+    // amortize the cost of the cross-shard round trip.
+    static constexpr size_t batch_size = 128 * 1024;
+    // Batches in flight per helper shard.
+    static constexpr size_t batches_per_helper = 2;
+
     output_stream<char> _out;
     sstables::compression* _compression_metadata;
     sstables::compression::segmented_offsets::writer _offsets;
     size_t _pos = 0;
     uint32_t _full_checksum;
+    std::vector<shard_id> _helper_shards;
+    size_t _next_helper = 0;
+    std::unique_ptr<batch> _batch;
+    size_t _batch_bytes = 0;
+    std::deque<future<foreign_batch>> _in_flight;
 public:
-    compressed_file_data_sink_impl(output_stream<char> out, sstables::compression* cm)
+    compressed_file_data_sink_impl(output_stream<char> out, sstables::compression* cm, std::vector<shard_id> helper_shards)
             : _out(std::move(out))
             , _compression_metadata(cm)
             , _offsets(_compression_metadata->offsets.get_writer())
             , _full_checksum(ChecksumType::init_checksum())
+            , _helper_shards(std::move(helper_shards))
     {}
 
 private:
-    future<> do_put(temporary_buffer<char> buf) {
-        auto output_len = _compression_metadata->get_compressor().compress_max_size(buf.size());
+    static size_t compress_chunk(const compressor& c, chunk& ch) {
+        auto output_len = ch.compressed.size() - 4;
+        auto len = c.compress(ch.data.get(), ch.data.size(), ch.compressed.get_write(), output_len);
+        if (len > output_len) {
+            throw std::runtime_error("possible overflow during compression");
+        }
+        return len;
+    }
 
+    chunk make_chunk(temporary_buffer<char> buf) const {
+        auto output_len = _compression_metadata->get_compressor().compress_max_size(buf.size());
         // account space for checksum that goes after compressed data.
-        temporary_buffer<char> compressed(output_len + 4);
+        return chunk{std::move(buf), temporary_buffer<char>(output_len + 4)};
+    }
 
-        // compress flushed data.
-        auto len = _compression_metadata->get_compressor().compress(buf.get(), buf.size(), compressed.get_write(), output_len);
-        if (len > output_len) {
-            return make_exception_future(std::runtime_error("possible overflow during compression"));
-        }
+    future<> append(chunk& ch) {
+        auto& compressed = ch.compressed;
+        auto len = ch.len;
 
         // total length of the uncompressed data.
-        _compression_metadata->set_uncompressed_file_length(_compression_metadata->uncompressed_file_length() + buf.size());
+        _compression_metadata->set_uncompressed_file_length(_compression_metadata->uncompressed_file_length() + ch.data.size());
 
         _offsets.push_back(_pos);
         // account compressed data + 32-bit checksum.
@@ -657,15 +696,97 @@ class compressed_file_data_sink_impl : public data_sink_impl {
         auto f = _out.write(compressed.get(), compressed.size());
         return f.then([compressed = std::move(compressed)] {});
     }
+
+    future<> do_put(temporary_buffer<char> buf) {
+        auto ch = make_chunk(std::move(buf));
+        try {
+            ch.len = compress_chunk(_compression_metadata->get_compressor(), ch);
+        } catch (...) {
+            return current_exception_as_future();
+        }
+        return do_with(std::move(ch), [this] (chunk& ch) {
+            return append(ch);
+        });
+    }
+
+    void submit_batch() {
+        auto shard = _helper_shards[_next_helper++ % _helper_shards.size()];
+        const auto& c = _compression_metadata->get_compressor();
+        _batch_bytes = 0;
+        _in_flight.push_back(smp::submit_to(shard, [&c, b = make_foreign(std::move(_batch))] () mutable {
+            for (auto& ch : *b) {
+                ch.len = compress_chunk(c, ch);
+            }
+            return std::move(b);
+        }));
+    }
+
+    future<> append_oldest_batch() {
+        auto f = std::move(_in_flight.front());
+        _in_flight.pop_front();
+        auto b = co_await std::move(f);
+        for (auto& ch : *b) {
+            co_await append(ch);
+        }
+    }
+
+    future<> do_put_offloaded(temporary_buffer<char> buf) {
+        if (!_batch) {
+            _batch = std::make_unique<batch>();
+        }
+        _batch_bytes += buf.size();
+        _batch->push_back(make_chunk(std::move(buf)));
+        if (_batch_bytes >= batch_size) {
+            submit_batch();
+        }
+        if (_in_flight.size() > _helper_shards.size() * batches_per_helper) {
+            co_await append_oldest_batch();
+        }
+    }
+
+    // Appends the remaining batches, in order. Waits for all of them to come
+    // back even if appending fails, so that no compression is left running.
+    future<> flush_batches() {
+        if (_batch) {
+            submit_batch();
+        }
+        std::exception_ptr ex;
+        while (!_in_flight.empty()) {
+            if (ex) {
+                auto f = std::move(_in_flight.front());
+                _in_flight.pop_front();
+                co_await std::move(f).then_wrapped([] (future<foreign_batch> f) { f.ignore_ready_future(); });
+                continue;
+            }
+            try {
+                co_await append_oldest_batch();
+            } catch (...) {
+                ex = std::current_exception();
+            }
+        }
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+    }
 public:
     virtual future<> put(std::span<temporary_buffer<char>> bufs) override {
+        if (!_helper_shards.empty()) {
+            return data_sink_impl::fallback_put(bufs, [this] (temporary_buffer<char>&& buf) {
+                return do_put_offloaded(std::move(buf));
+            });
+        }
         return data_sink_impl::fallback_put(bufs, [this] (temporary_buffer<char>&& buf) {
             return do_put(std::move(buf));
         });
     }
 
     virtual future<> close() override {
-        return _out.close();
+        if (_helper_shards.empty()) {
+            return _out.close();
+        }
+        return flush_batches().finally([this] {
+            return _out.close();
+        });
     }
 
     virtual size_t buffer_size() const noexcept override {
@@ -677,9 +798,9 @@ template <typename ChecksumType, compressed_checksum_mode mode>
 requires ChecksumUtils<ChecksumType>
 class compressed_file_data_sink : public data_sink {
 public:
-    compressed_file_data_sink(output_stream<char> out, sstables::compression* cm)
+    compressed_file_data_sink(output_stream<char> out, sstables::compression* cm, std::vector<shard_id> helper_shards)
         : data_sink(std::make_unique<compressed_file_data_sink_impl<ChecksumType, mode>>(
-                std::move(out), cm)) {}
+                std::move(out), cm, std::move(helper_shards))) {}
 };
 
 template <typename ChecksumType, compressed_checksum_mode mode>
@@ -687,7 +808,8 @@ requires ChecksumUtils<ChecksumType>
 inline output_stream<char> make_compressed_file_output_stream(output_stream<char> out,
          sstables::compression* cm,
          const compression_parameters& cp,
-         compressor_ptr p) {
+         compressor_ptr p,
+         unsigned helper_shards) {
     cm->set_compressor(std::move(p));
     // buffer of output stream is set to chunk length, because flush must
     // happen every time a chunk was filled up.
@@ -697,7 +819,12 @@ inline output_stream<char> make_compressed_file_output_stream(output_stream<char
     // defaults to 1.0.
     cm->options.elements.push_back({{"crc_check_chance"}, {"1.0"}});
 
-    return output_stream<char>(compressed_file_data_sink<ChecksumType, mode>(std::move(out), cm));
+    // Use the shards following this one as helpers.
+    std::vector<shard_id> helpers;
+    for (unsigned i = 1; i <= std::min(helper_shards, smp::count - 1); ++i) {
+        helpers.push_back((this_shard_id() + i) % smp::count);
+    }
+    return output_stream<char>(compressed_file_data_sink<ChecksumType, mode>(std::move(out), cm, std::move(helpers)));
 }
 
 input_stream<char> sstables::make_compressed_file_k_l_format_input_stream(stream_creator_fn stream_creator,
@@ -720,9 +847,10 @@ input_stream<char> sstables::make_compressed_file_m_format_input_stream(stream_c
 output_stream<char> sstables::make_compressed_file_m_format_output_stream(output_stream<char> out,
         sstables::compression* cm,
         const compression_parameters& cp,
-        compressor_ptr p) {
+        compressor_ptr p,
+        unsigned helper_shards) {
     return make_compressed_file_output_stream<crc32_utils, compressed_checksum_mode::checksum_all>(
-            std::move(out), cm, cp, std::move(p));
+            std::move(out), cm, cp, std::move(p), helper_shards);
 }
 
 input_stream<char> sstables::make_compressed_raw_file_input_stream(sstables::stream_creator_fn stream_creator, sstables::compression *cm,
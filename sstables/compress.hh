@@ -385,10 +385,13 @@ input_stream<char> make_compressed_file_m_format_input_stream(stream_creator_fn
 input_stream<char> make_compressed_raw_file_input_stream(sstables::stream_creator_fn stream_creator, sstables::compression *cm,
         file_input_stream_options options, reader_permit permit, std::optional<uint32_t> digest);
 
+// If helper_shards is non-zero, the chunks are compressed on up to that many
+// other shards, in parallel with the calling shard.
 output_stream<char> make_compressed_file_m_format_output_stream(output_stream<char> out,
                 sstables::compression* cm,
                 const compression_parameters& cp,
-                compressor_ptr);
+                compressor_ptr,
+                unsigned helper_shards = 0);
 
 
 std::map<sstring, sstring> options_from_compression(const compression& c);
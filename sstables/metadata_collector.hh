@@ -19,6 +19,7 @@
 #include "db/commitlog/replay_position.hh"
 #include "mutation/position_in_partition.hh"
 #include "locator/host_id.hh"
+#include "dht/token.hh"
 
 
 namespace sstables {
@@ -55,6 +56,10 @@ struct column_stats {
     min_max_tracker<int32_t> ttl_tracker;
     /** histogram of tombstone drop time */
     utils::streaming_histogram tombstone_histogram;
+    /** how many tombstones (including expiring cells) are there in the partition */
+    uint64_t tombstones_count = 0;
+    /** the largest local deletion time of the tombstones in the partition */
+    int32_t max_tombstone_deletion_time = std::numeric_limits<int32_t>::min();
 
     bool has_legacy_counter_shards;
     bool capped_local_deletion_time = false;
@@ -97,6 +102,8 @@ struct column_stats {
         int32_t ldt = adjusted_local_deletion_time(value, capped);
         local_deletion_time_tracker.update(ldt);
         tombstone_histogram.update(ldt);
+        ++tombstones_count;
+        max_tombstone_deletion_time = std::max(max_tombstone_deletion_time, ldt);
         capped_local_deletion_time |= capped;
     }
     void update_ttl(int32_t value) {
@@ -116,6 +123,143 @@ struct column_stats {
     }
 };
 
+/**
+ * Splits the partitions of an sstable, in token order, into a bounded number
+ * of segments and tracks statistics about each of them.
+ *
+ * Segments start with a single partition each. When there are too many of
+ * them, adjacent segments are merged pairwise and the number of partitions
+ * per segment is doubled, so all but the last segment cover the same number
+ * of partitions.
+ *
+ * Tracker starts a new segment at a partition with Tracker::make_segment(token)
+ * and merges two adjacent segments with Tracker::merge(a, b).
+ */
+template <typename Segment, typename Tracker>
+class segment_tracker {
+public:
+    static constexpr size_t max_segments = 128;
+    static_assert(max_segments % 2 == 0);
+protected:
+    utils::chunked_vector<Segment> _segments;
+private:
+    uint64_t _partitions_per_segment = 1;
+    // Partitions in the last segment.
+    uint64_t _last_segment_partitions = 0;
+private:
+    void merge_adjacent_segments() {
+        for (size_t i = 0; i < _segments.size() / 2; ++i) {
+            _segments[i] = Tracker::merge(_segments[2 * i], _segments[2 * i + 1]);
+        }
+        _segments.resize(_segments.size() / 2);
+        _partitions_per_segment *= 2;
+    }
+protected:
+    // Returns the segment of the partition with the given token, which must
+    // not be smaller than the tokens of the partitions seen so far.
+    Segment& segment_for(dht::token token) {
+        if (_segments.empty() || _last_segment_partitions >= _partitions_per_segment) {
+            if (_segments.size() == max_segments) {
+                merge_adjacent_segments();
+                // The last segment is now full, as are all the others.
+            }
+            _segments.push_back(Tracker::make_segment(token));
+            _last_segment_partitions = 0;
+        }
+        ++_last_segment_partitions;
+        auto& s = _segments.back();
+        s.last_token = token.raw();
+        return s;
+    }
+};
+
+/**
+ * Tracks how many tombstones each segment of the sstable contains.
+ */
+class tombstone_density_tracker : public segment_tracker<tombstone_density_segment, tombstone_density_tracker> {
+    friend class segment_tracker<tombstone_density_segment, tombstone_density_tracker>;
+
+    uint64_t _tombstones = 0;
+private:
+    static tombstone_density_segment make_segment(dht::token token) {
+        return tombstone_density_segment{
+            .first_token = token.raw(),
+            .last_token = token.raw(),
+            .partitions = 0,
+            .cells = 0,
+            .tombstones = 0,
+            .max_local_deletion_time = std::numeric_limits<int32_t>::min(),
+        };
+    }
+
+    static tombstone_density_segment merge(const tombstone_density_segment& a, const tombstone_density_segment& b) {
+        return tombstone_density_segment{
+            .first_token = a.first_token,
+            .last_token = b.last_token,
+            .partitions = a.partitions + b.partitions,
+            .cells = a.cells + b.cells,
+            .tombstones = a.tombstones + b.tombstones,
+            .max_local_deletion_time = std::max(a.max_local_deletion_time, b.max_local_deletion_time),
+        };
+    }
+public:
+    void update(dht::token token, const column_stats& stats) {
+        auto& s = segment_for(token);
+        ++s.partitions;
+        s.cells += stats.cells_count;
+        s.tombstones += stats.tombstones_count;
+        s.max_local_deletion_time = std::max(s.max_local_deletion_time, stats.max_tombstone_deletion_time);
+        _tombstones += stats.tombstones_count;
+    }
+
+    // Returns a disengaged optional if the sstable has no tombstones.
+    std::optional<scylla_metadata::tombstone_density> get() && {
+        if (!_tombstones) {
+            return std::nullopt;
+        }
+        return scylla_metadata::tombstone_density{.elements = std::move(_segments)};
+    }
+};
+
+/**
+ * Tracks the minimum live timestamps of each segment of the sstable.
+ */
+class timestamp_index_tracker : public segment_tracker<timestamp_index_segment, timestamp_index_tracker> {
+    friend class segment_tracker<timestamp_index_segment, timestamp_index_tracker>;
+private:
+    static timestamp_index_segment make_segment(dht::token token) {
+        return timestamp_index_segment{
+            .first_token = token.raw(),
+            .last_token = token.raw(),
+            .min_live_timestamp = api::max_timestamp,
+            .min_live_row_marker_timestamp = api::max_timestamp,
+        };
+    }
+
+    static timestamp_index_segment merge(const timestamp_index_segment& a, const timestamp_index_segment& b) {
+        return timestamp_index_segment{
+            .first_token = a.first_token,
+            .last_token = b.last_token,
+            .min_live_timestamp = std::min(a.min_live_timestamp, b.min_live_timestamp),
+            .min_live_row_marker_timestamp = std::min(a.min_live_row_marker_timestamp, b.min_live_row_marker_timestamp),
+        };
+    }
+public:
+    void update(dht::token token, const column_stats& stats) {
+        auto& s = segment_for(token);
+        s.min_live_timestamp = std::min(s.min_live_timestamp, stats.min_live_timestamp_tracker.get());
+        s.min_live_row_marker_timestamp = std::min(s.min_live_row_marker_timestamp, stats.min_live_row_marker_timestamp_tracker.get());
+    }
+
+    // Returns a disengaged optional if the sstable has no partitions.
+    std::optional<scylla_metadata::timestamp_index> get() && {
+        if (_segments.empty()) {
+            return std::nullopt;
+        }
+        return scylla_metadata::timestamp_index{.elements = std::move(_segments)};
+    }
+};
+
 class metadata_collector {
 public:
     static constexpr double NO_COMPRESSION_RATIO = -1.0;
@@ -147,6 +291,8 @@ class metadata_collector {
     bool _has_legacy_counter_shards = false;
     uint64_t _columns_count = 0;
     uint64_t _rows_count = 0;
+    tombstone_density_tracker _tombstone_density;
+    timestamp_index_tracker _timestamp_index;
 
     /**
      * Default cardinality estimation method is to use HyperLogLog++.
@@ -219,6 +365,12 @@ class metadata_collector {
     // pos must be in the clustered region
     void update_min_max_components(position_in_partition_view pos);
 
+    // Updates the per token range statistics with those of the partition with the given token.
+    void update_token_range_stats(dht::token token, const column_stats& stats) {
+        _tombstone_density.update(token, stats);
+        _timestamp_index.update(token, stats);
+    }
+
     void update(column_stats&& stats) {
         _timestamp_tracker.update(stats.timestamp_tracker);
         _min_live_timestamp_tracker.update(stats.min_live_timestamp_tracker);
@@ -266,6 +418,14 @@ class metadata_collector {
             { ext_timestamp_stats_type::min_live_row_marker_timestamp, _min_live_row_marker_timestamp_tracker.get() },
         };
     }
+
+    std::optional<scylla_metadata::tombstone_density> get_tombstone_density() {
+        return std::move(_tombstone_density).get();
+    }
+
+    std::optional<scylla_metadata::timestamp_index> get_timestamp_index() {
+        return std::move(_timestamp_index).get();
+    }
 };
 
 }
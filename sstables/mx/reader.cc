@@ -13,6 +13,7 @@
 #include "sstables/mutation_fragment_filter.hh"
 #include "sstables/m_format_read_helpers.hh"
 #include "sstables/sstable_mutation_reader.hh"
+#include "sstables/resume_hints.hh"
 #include "sstables/processing_result_generator.hh"
 #include "utils/to_string.hh"
 #include "utils/value_or_reference.hh"
@@ -695,6 +696,7 @@ class data_consume_rows_context_m : public data_consumer::continuous_data_consum
     // becomes false when we yield in the main coroutine, although we don't need to consume
     // more data buffers to continue, switch back to true afterwards
     bool _consuming = true;
+    uint64_t _partition_start_position = 0;
     Consumer& _consumer;
     shared_sstable _sst;
     const serialization_header& _header;
@@ -841,6 +843,7 @@ class data_consume_rows_context_m : public data_consumer::continuous_data_consum
             goto flags_label;
         }
         partition_start_label: {
+            _partition_start_position = this->position() - _processing_data->size();
             _is_first_unfiltered = true;
             _state = state::DELETION_TIME;
             co_yield this->read_short_length_bytes(*_processing_data, _pk);
@@ -1249,6 +1252,11 @@ class data_consume_rows_context_m : public data_consumer::continuous_data_consum
     reader_permit& permit() {
         return _consumer.permit();
     }
+
+    // Data file offset of the partition whose header was parsed last.
+    uint64_t partition_start_position() const {
+        return _partition_start_position;
+    }
 };
 
 class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
@@ -1276,6 +1284,15 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
     // of the reversing data source used underneath (see `partition_reversing_data_source`).
     // Engaged after `_context` is engaged, i.e. after `initialize()`.
     const uint64_t* _reversed_read_sstable_position;
+
+    // For range reads, logs the partitions read, so the read of the next page
+    // of the query can resume without an index lookup, see resume_hints.
+    std::unique_ptr<resume_hints::partition_log> _partition_log;
+    // When resuming, the start of the partition following the first one, to
+    // skip the latter without the index if it is before the range.
+    std::optional<uint64_t> _resume_skip_position;
+    // Start of the current partition, if it was read from the index.
+    std::optional<uint64_t> _partition_start_from_index;
 public:
     mx_sstable_mutation_reader(shared_sstable sst,
                             schema_ptr schema,
@@ -1347,6 +1364,10 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
             _index_in_current_partition = false;
             return make_ready_future<>();
         }
+        if (auto pos = std::exchange(_resume_skip_position, std::nullopt)) {
+            sstlog.trace("reader {}: skipping to the next resumed partition at {}", fmt::ptr(this), *pos);
+            return skip_to(indexable_element::partition, *pos);
+        }
         return (_index_in_current_partition
                 ? _index_reader->advance_to_next_partition()
                 : get_index_reader().advance_past_definitely_present_partition(*_current_partition_key))
@@ -1377,6 +1398,7 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
         }
         auto key = dht::decorate_key(*_schema, std::move(*pk));
         _consumer.setup_for_partition(key.key());
+        _partition_start_from_index = _index_reader->data_file_positions().start;
         on_next_partition(std::move(key), tombstone(*tomb));
         return make_ready_future<>();
     }
@@ -1522,6 +1544,7 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
         }
 
         _will_likely_slice = will_likely_slice(_slice);
+        std::optional<resume_hints::resume_position> resume_position;
 
         if (_single_partition_read) {
             _sst->get_stats().on_single_partition_read();
@@ -1563,10 +1586,24 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
             }
         } else {
             _sst->get_stats().on_range_partition_read();
-            co_await get_index_reader().advance_to(_pr);
+            if (!_integrity) {
+                _partition_log = std::make_unique<resume_hints::partition_log>();
+                if (const auto& hints = _permit.resume_hints()) {
+                    resume_position = find_resume_position(*hints);
+                }
+            }
+            if (resume_position) {
+                sstlog.trace("sstable_reader: {}: resuming at data file position {}", fmt::ptr(this), resume_position->start);
+                _resume_skip_position = resume_position->next;
+                _sst->get_stats().on_range_read_resumed();
+            } else {
+                co_await get_index_reader().advance_to(_pr);
+            }
         }
 
-        auto [begin, end] = _index_reader->data_file_positions();
+        auto [begin, end] = resume_position
+                ? data_file_positions_range{resume_position->start, _sst->data_size()}
+                : _index_reader->data_file_positions();
         parse_assert(bool(end), _sst->get_filename());
 
         sstlog.trace("sstable_reader: {}: data file range [{}, {})", fmt::ptr(this), begin, *end);
@@ -1601,9 +1638,22 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
         }
 
         _monitor.on_read_started(_context->reader_position());
-        _index_in_current_partition = true;
+        // When resuming, the index is not positioned at all. It is advanced
+        // to the current partition lazily, if needed.
+        _index_in_current_partition = !resume_position;
         co_return true;
     }
+    // The data file position of the first partition in the read range, if it
+    // can be determined from the partitions read by the previous page, and
+    // the range extends past the end of the sstable, so the index doesn't
+    // need to be consulted at all.
+    std::optional<resume_hints::resume_position> find_resume_position(const resume_hints& hints) const {
+        if (!_pr.get().start() || _pr.get().after(_sst->get_last_decorated_key(), dht::ring_position_comparator(*_schema))) {
+            return std::nullopt;
+        }
+        auto log = hints.find(_sst->generation());
+        return log ? log->find_start(_pr.get()) : std::nullopt;
+    }
     future<> skip_to(indexable_element el, uint64_t begin) {
         sstlog.trace("sstable_reader: {}: skip_to({} -> {}, el={})", fmt::ptr(_context.get()), _context->position(), begin, static_cast<int>(el));
         if (begin <= _context->position()) {
@@ -1654,6 +1704,11 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
                 _partition_finished = true;
                 _before_partition = true;
                 _end_of_stream = false;
+                if (_partition_log) {
+                    // The partitions of the new range are not consecutive with the ones read so far.
+                    _partition_log->reset();
+                }
+                _resume_skip_position.reset();
                 parse_assert(bool(_index_reader), _sst->get_filename());
                 auto f1 = _index_reader->advance_to(pr);
                 return f1.then([this] {
@@ -1796,6 +1851,15 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
         }
     }
     virtual future<> close() noexcept override {
+        // The querier of the read was evicted, save the partitions read for
+        // the next page, see resume_hints.
+        if (_partition_log && _permit.resume_hints()) {
+            try {
+                _permit.resume_hints()->save(_sst->generation(), *_partition_log);
+            } catch (...) {
+                // The hints are only an optimization.
+            }
+        }
         auto close_context = make_ready_future<>();
         if (_context) {
             _monitor.on_read_completed();
@@ -1817,6 +1881,7 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
 
     data_consumer::proceed on_next_partition(dht::decorated_key key, tombstone tomb) override {
         if (_pr.get().before(key, dht::ring_position_comparator(*_schema))) {
+            _partition_start_from_index.reset();
             sstlog.trace("mp_row_consumer_reader_mx {}: on_next_partition({}), _pr={}, skipping key before range", fmt::ptr(this), key, _pr.get());
             // If we got here, then the index returned a Data file range which
             // includes some partitions before the queried range.
@@ -1844,6 +1909,7 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
             // The read is over. The new key and everything after it should be ignored.
             sstlog.trace("mp_row_consumer_reader_mx {}: on_next_partition({}), _pr={}, skipping key after range", fmt::ptr(this), key, _pr.get());
             _end_of_stream = true;
+            _partition_start_from_index.reset();
             // The read is over for now, but the reader can be later forwarded to the key we just read.
             // The parser can't move backwards, so we have to remember the key and tombstone
             // to handle that case.
@@ -1853,6 +1919,11 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
         } else {
             // This is the normal path.
             sstlog.trace("mp_row_consumer_reader_mx {}: on_next_partition({}), _pr={}, consuming key in range", fmt::ptr(this), key, _pr.get());
+            if (_partition_log) {
+                _partition_log->record(key.token(), _partition_start_from_index.value_or(_context->partition_start_position()));
+            }
+            _partition_start_from_index.reset();
+            _resume_skip_position.reset();
             return mp_row_consumer_reader_mx::on_next_partition(std::move(key), tomb);
         }
     }
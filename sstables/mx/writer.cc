@@ -14,7 +14,9 @@
 #include "mutation/mutation_fragment.hh"
 #include "vint-serialization.hh"
 #include "sstables/types.hh"
+#include "sstables/repair_hash_summary.hh"
 #include "sstables/mx/types.hh"
+#include "sstables/exceptions.hh"
 #include "mutation/atomic_cell.hh"
 #include "utils/assert.hh"
 #include "utils/exceptions.hh"
@@ -22,8 +24,10 @@
 #include "db/corrupt_data_handler.hh"
 #include "keys/keys.hh"
 
+#include <cmath>
 #include <functional>
 #include <queue>
+#include <seastar/core/byteorder.hh>
 #include <boost/iterator/iterator_facade.hpp>
 #include <boost/container/static_vector.hpp>
 
@@ -566,11 +570,18 @@ class writer : public sstable_writer::writer_impl {
     uint64_t _partition_header_length = 0;
     uint64_t _prev_row_start = 0;
     std::optional<key> _partition_key;
+    // Token of `_partition_key`.
+    dht::token _partition_token;
     utils::hashed_key _current_murmur_hash{{0, 0}};
     std::optional<key> _first_key, _last_key;
     index_sampling_state _index_sampling_state;
     bytes_ostream _tmp_bufs;
     uint64_t _num_partitions_consumed = 0;
+    // The sstable the last partition passed to consume_raw_partition() was
+    // copied from. Its sstable-wide statistics were merged into _collector.
+    const sstable* _raw_partitions_source = nullptr;
+    // Engaged when sstable_writer_config::write_repair_hash_summary is set.
+    std::optional<repair_hash_summary_tracker> _repair_hash_summary;
 
     const sstable_schema _sst_schema;
 
@@ -817,6 +828,10 @@ class writer : public sstable_writer::writer_impl {
     }
     void write_promoted_index();
     void consume(rt_marker&& marker, tombstone preceding_range_tombstone);
+    // Adds the partition key to the index, summary and filter, and the
+    // collected statistics, at the current position of the data file.
+    void add_partition_key(const dht::decorated_key& dk);
+    void merge_raw_partitions_source(const sstable& src);
 
     // Must be called in a seastar thread.
     void flush_tmp_bufs(file_writer& writer) {
@@ -888,6 +903,9 @@ class writer : public sstable_writer::writer_impl {
         _pi_write_m.promoted_index_auto_scale_threshold = cfg.promoted_index_auto_scale_threshold;
         _index_sampling_state.summary_byte_cost = _cfg.summary_byte_cost;
         _index_sampling_state.max_partitions_per_page = _cfg.summary_max_partitions_per_page;
+        if (_cfg.write_repair_hash_summary) {
+            _repair_hash_summary.emplace(_schema);
+        }
       if (_index_writer) {
         prepare_summary(_sst._components->summary, estimated_partitions, _schema.min_index_interval());
       }
@@ -901,6 +919,7 @@ class writer : public sstable_writer::writer_impl {
     stop_iteration consume(range_tombstone_change&& rtc) override;
     stop_iteration consume_end_of_partition() override;
     void consume_end_of_stream() override;
+    void consume_raw_partition(const sstable& src, const dht::decorated_key& dk, temporary_buffer<char> data) override;
     uint64_t data_file_position_for_tests() const override;
 };
 
@@ -990,7 +1009,8 @@ void writer::init_file_writers() {
                 output_stream<char>(std::move(out)),
                 &_sst._components->compression,
                 _sst._schema->get_compressor_params(),
-                std::move(compressor)), _sst.get_filename());
+                std::move(compressor),
+                _cfg.compression_helper_shards), _sst.get_filename());
     }
 
     if (_sst.has_component(component_type::Index)) {
@@ -1064,11 +1084,9 @@ void writer::close_rows_writer() {
     }
 }
 
-void writer::consume_new_partition(const dht::decorated_key& dk) {
-    _c_stats.start_offset = _data_writer->offset();
-    _prev_row_start = _data_writer->offset();
-
+void writer::add_partition_key(const dht::decorated_key& dk) {
     _partition_key = key::from_partition_key(_schema, dk.key());
+    _partition_token = dk.token();
     maybe_add_summary_entry(dk.token(), bytes_view(*_partition_key));
 
     _current_murmur_hash = utils::make_hashed_key(bytes_view(*_partition_key));
@@ -1097,6 +1115,16 @@ void writer::consume_new_partition(const dht::decorated_key& dk) {
   }
     _current_dk_for_bti = dk;
     _current_partition_position = _data_writer->offset();
+}
+
+void writer::consume_new_partition(const dht::decorated_key& dk) {
+    _c_stats.start_offset = _data_writer->offset();
+    _prev_row_start = _data_writer->offset();
+
+    add_partition_key(dk);
+    if (_repair_hash_summary) {
+        _repair_hash_summary->on_new_partition(dk);
+    }
 
     _pi_write_m.first_entry.reset();
     _pi_write_m.blocks.clear();
@@ -1108,6 +1136,8 @@ void writer::consume_new_partition(const dht::decorated_key& dk) {
     _pi_write_m.desired_block_size = _pi_write_m.promoted_index_block_size;
     _pi_write_m.auto_scale_threshold = _pi_write_m.promoted_index_auto_scale_threshold;
 
+    auto p_key = disk_string_view<uint16_t>();
+    p_key.value = bytes_view(*_partition_key);
     write(_sst.get_version(), *_data_writer, p_key);
     _partition_header_length = _data_writer->offset() - _c_stats.start_offset;
 
@@ -1126,6 +1156,9 @@ void writer::consume(tombstone t) {
 
     _tombstone_written = true;
 
+    if (_repair_hash_summary) {
+        _repair_hash_summary->on_partition_tombstone(t);
+    }
     if (t) {
         _collector.update_min_max_components(position_in_partition_view::before_all_clustered_rows());
         _collector.update_min_max_components(position_in_partition_view::after_all_clustered_rows());
@@ -1512,6 +1545,9 @@ void writer::write_static_row(const row& static_row, column_kind kind) {
 
 stop_iteration writer::consume(static_row&& sr) {
     ensure_tombstone_is_written();
+    if (_repair_hash_summary) {
+        _repair_hash_summary->on_static_row(sr);
+    }
     write_static_row(sr.cells(), column_kind::static_column);
     return stop_iteration::no;
 }
@@ -1591,6 +1627,9 @@ void writer::record_corrupt_row(clustering_row&& clustered_row) {
 stop_iteration writer::consume(clustering_row&& cr) {
     if (_write_regular_as_static) {
         ensure_tombstone_is_written();
+        if (_repair_hash_summary) {
+            _repair_hash_summary->on_clustering_row(cr);
+        }
         write_static_row(cr.cells(), column_kind::regular_column);
         return stop_iteration::no;
     }
@@ -1598,6 +1637,9 @@ stop_iteration writer::consume(clustering_row&& cr) {
         record_corrupt_row(std::move(cr));
         return stop_iteration::no;
     }
+    if (_repair_hash_summary) {
+        _repair_hash_summary->on_clustering_row(cr);
+    }
 
     ensure_tombstone_is_written();
     ensure_static_row_is_written_if_needed();
@@ -1716,6 +1758,9 @@ stop_iteration writer::consume(range_tombstone_change&& rtc) {
     if (!_current_tombstone && !rtc.tombstone()) {
         return stop_iteration::no;
     }
+    if (_repair_hash_summary) {
+        _repair_hash_summary->on_range_tombstone_change(rtc);
+    }
     tombstone prev_tombstone = std::exchange(_current_tombstone, rtc.tombstone());
     if (!prev_tombstone) { // start bound
         auto bv = pos.as_start_bound_view();
@@ -1787,6 +1832,7 @@ stop_iteration writer::consume_end_of_partition() {
     maybe_record_large_partitions(_sst, *_partition_key, _c_stats.partition_size, _c_stats.rows_count, _c_stats.range_tombstones_count, _c_stats.dead_rows_count);
 
     // update is about merging column_stats with the data being stored by collector.
+    _collector.update_token_range_stats(_partition_token, _c_stats);
     _collector.update(std::move(_c_stats));
     _c_stats.reset();
 
@@ -1798,6 +1844,153 @@ stop_iteration writer::consume_end_of_partition() {
     return get_data_offset() < _cfg.max_sstable_size ? stop_iteration::no : stop_iteration::yes;
 }
 
+// The segment of the TombstoneDensity of `src` holding the partitions with `token`, if any.
+static const tombstone_density_segment* find_tombstone_density_segment(const sstable& src, dht::token token) {
+    const auto* sm = src.get_scylla_metadata();
+    const auto* density = sm ? sm->get_tombstone_density() : nullptr;
+    if (!density) {
+        return nullptr;
+    }
+    const auto t = token.raw();
+    auto it = std::ranges::lower_bound(density->elements, t, std::less<>(), std::mem_fn(&tombstone_density_segment::last_token));
+    return it != density->elements.end() && it->first_token <= t ? &*it : nullptr;
+}
+
+void writer::merge_raw_partitions_source(const sstable& src) {
+    _raw_partitions_source = &src;
+    const auto& stats = src.get_stats_metadata();
+    auto tombstone_histogram = stats.estimated_tombstone_drop_time;
+    _collector.merge_tombstone_histogram(tombstone_histogram);
+    _collector.update_has_legacy_counter_shards(stats.has_legacy_counter_shards);
+    _collector.update_min_max_components(src.min_position());
+    _collector.update_min_max_components(src.max_position());
+}
+
+void writer::consume_raw_partition(const sstable& src, const dht::decorated_key& dk, temporary_buffer<char> data) {
+    if (_raw_partitions_source != &src) {
+        merge_raw_partitions_source(src);
+    }
+    if (_repair_hash_summary) {
+        _repair_hash_summary->on_raw_partition();
+    }
+    _c_stats.start_offset = _data_writer->offset();
+
+    add_partition_key(dk);
+    if (_index_writer) {
+        // Partitions are only copied if they are too small to have a promoted index.
+        write_vint(*_index_writer, uint64_t(0));
+    }
+
+    // The partition deletion follows the partition key.
+    auto deletion_offset = sizeof(uint16_t) + bytes_view(*_partition_key).size();
+    if (data.size() < deletion_offset + sizeof(int32_t) + sizeof(int64_t) + 1) {
+        throw malformed_sstable_exception(format("Partition of size {} is too short to copy", data.size()), src.get_filename());
+    }
+    deletion_time partition_tombstone;
+    partition_tombstone.local_deletion_time = read_be<int32_t>(data.get() + deletion_offset);
+    partition_tombstone.marked_for_delete_at = read_be<int64_t>(data.get() + deletion_offset + sizeof(int32_t));
+
+    _data_writer->write(data.get(), data.size());
+
+    if (_bti_partition_index_writer) {
+        auto partitions_db_payload = _bti_row_index_writer->finish(
+            _sst.get_version(),
+            _schema,
+            _current_partition_position,
+            _data_writer->offset() - 1,
+            *_partition_key,
+            partition_tombstone
+        );
+        _bti_partition_index_writer->add(
+            _schema,
+            *std::exchange(_current_dk_for_bti, std::nullopt),
+            _current_murmur_hash,
+            partitions_db_payload
+        );
+    }
+
+    // The cells of the partition aren't decoded, so its statistics are
+    // approximated by those of the whole source sstable. The minimum live
+    // timestamps are taken from the source's timestamp index when present,
+    // so tombstone garbage collection isn't held back by the other partitions.
+    const auto& stats = src.get_stats_metadata();
+    auto min_live_timestamp = [&] (ext_timestamp_stats_type type) {
+        if (auto ts = src.get_min_timestamp_for_token(dk.token(), type)) {
+            return *ts;
+        }
+        auto ext_stats = src.get_ext_timestamp_stats();
+        auto it = ext_stats.find(type);
+        return it != ext_stats.end() ? it->second : stats.min_timestamp;
+    };
+    _c_stats.partition_size = data.size();
+    _c_stats.timestamp_tracker.update(stats.min_timestamp);
+    _c_stats.timestamp_tracker.update(stats.max_timestamp);
+    _c_stats.min_live_timestamp_tracker.update(min_live_timestamp(ext_timestamp_stats_type::min_live_timestamp));
+    _c_stats.min_live_row_marker_timestamp_tracker.update(min_live_timestamp(ext_timestamp_stats_type::min_live_row_marker_timestamp));
+    _c_stats.local_deletion_time_tracker.update(stats.min_local_deletion_time);
+    _c_stats.local_deletion_time_tracker.update(stats.max_local_deletion_time);
+    _c_stats.ttl_tracker.update(stats.min_ttl);
+    _c_stats.ttl_tracker.update(stats.max_ttl);
+
+    // The counts of the partition are estimated from those of the source.
+    // The rows and cells are spread over the partitions of the source in
+    // proportion to their size. The tombstones are taken from the source's
+    // TombstoneDensity segment holding the partition, or spread evenly over
+    // the partitions of the source when it has none. They are rounded up, so
+    // partitions with tombstones aren't reported as tombstone-free.
+    auto per_byte = [&] (uint64_t count) {
+        return uint64_t(std::ceil(double(count) * _c_stats.partition_size / std::max(src.data_size(), uint64_t(1))));
+    };
+    auto per_partition = [] (uint64_t count, uint64_t partitions) {
+        return (count + partitions - 1) / std::max(partitions, uint64_t(1));
+    };
+    _c_stats.rows_count = per_byte(stats.rows_count);
+    _c_stats.column_count = per_byte(stats.columns_count);
+    _c_stats.cells_count = per_byte(stats.estimated_cells_count.mean() * src.get_estimated_key_count());
+    if (auto* segment = find_tombstone_density_segment(src, dk.token())) {
+        _c_stats.tombstones_count = per_partition(segment->tombstones, segment->partitions);
+        if (segment->tombstones) {
+            _c_stats.max_tombstone_deletion_time = segment->max_local_deletion_time;
+        }
+    } else {
+        uint64_t tombstones = 0;
+        for (const auto& [_, count] : stats.estimated_tombstone_drop_time.bin) {
+            tombstones += count;
+        }
+        _c_stats.tombstones_count = per_partition(tombstones, src.get_estimated_key_count());
+        if (tombstones) {
+            _c_stats.max_tombstone_deletion_time = stats.max_local_deletion_time;
+        }
+    }
+
+    // The source's large data records are exact, for the partitions they cover.
+    uint64_t range_tombstones = 0;
+    uint64_t dead_rows = 0;
+    if (const auto& records = src.get_large_data_records()) {
+        const auto& key_bytes = _partition_key->get_bytes();
+        for (const auto& r : records->elements) {
+            if ((r.type == large_data_type::partition_size || r.type == large_data_type::rows_in_partition) && r.partition_key.value == key_bytes) {
+                _c_stats.rows_count = r.elements_count;
+                range_tombstones = r.range_tombstones;
+                dead_rows = r.dead_rows;
+                break;
+            }
+        }
+    }
+
+    maybe_record_large_partitions(_sst, *_partition_key, _c_stats.partition_size, _c_stats.rows_count, range_tombstones, dead_rows);
+
+    _collector.update_token_range_stats(_partition_token, _c_stats);
+    _collector.update(std::move(_c_stats));
+    _c_stats.reset();
+
+    if (!_first_key) {
+        _first_key = *_partition_key;
+    }
+    _last_key = std::move(*_partition_key);
+    _partition_key = std::nullopt;
+}
+
 void writer::consume_end_of_stream() {
     _cfg.monitor->on_data_write_completed();
 
@@ -1883,7 +2076,9 @@ void writer::consume_end_of_stream() {
             ld_records = scylla_metadata::large_data_records{.elements = std::move(records)};
         }
     }
-    _sst.write_scylla_metadata(_shard, std::move(identifier), std::move(ld_stats), std::move(ts_stats), std::move(ld_records));
+    _sst.write_scylla_metadata(_shard, std::move(identifier), std::move(ld_stats), std::move(ts_stats), std::move(ld_records),
+            _collector.get_tombstone_density(), _collector.get_timestamp_index(),
+            _repair_hash_summary ? std::move(*_repair_hash_summary).get() : std::nullopt);
     if (!_cfg.leave_unsealed) {
         _sst.seal_sstable(_cfg.backup).get();
     }
@@ -1893,6 +2088,44 @@ uint64_t writer::data_file_position_for_tests() const {
     return _data_writer->offset();
 }
 
+encoding_stats encoding_stats_for_raw_copy(const sstable& src) {
+    const auto& header = src.get_serialization_header();
+    encoding_stats enc_stats;
+    enc_stats.min_timestamp = header.get_min_timestamp();
+    enc_stats.min_local_deletion_time = gc_clock::time_point(gc_clock::duration(header.get_min_local_deletion_time()));
+    enc_stats.min_ttl = gc_clock::duration(header.get_min_ttl());
+    return enc_stats;
+}
+
+bool can_copy_raw_partitions(const sstable& src, const schema& s, const sstable_writer_config& cfg, sstable_version_types v) {
+    if (src.get_version() != v) {
+        return false;
+    }
+    // Copied partitions have no promoted index, so the width of its last block doesn't matter.
+    auto required_features = sstable_enabled_features::all();
+    required_features.disable(CorrectLastPiBlockWidth);
+    if ((src.features().enabled_features & required_features.enabled_features) != required_features.enabled_features) {
+        return false;
+    }
+    // Cells are delta-encoded against the bases of the serialization header,
+    // and columns are referred to by their index in it, so the headers have
+    // to be identical.
+    const auto& src_header = src.get_serialization_header();
+    const auto header = make_sstable_schema(s, encoding_stats_for_raw_copy(src), cfg).header;
+    auto same_columns = [] (const auto& a, const auto& b) {
+        return std::ranges::equal(a.elements, b.elements, [] (const serialization_header::column_desc& x, const serialization_header::column_desc& y) {
+            return x.name == y.name && x.type_name == y.type_name;
+        });
+    };
+    return header.min_timestamp_base.value == src_header.min_timestamp_base.value
+        && header.min_local_deletion_time_base.value == src_header.min_local_deletion_time_base.value
+        && header.min_ttl_base.value == src_header.min_ttl_base.value
+        && header.pk_type_name == src_header.pk_type_name
+        && std::ranges::equal(header.clustering_key_types_names.elements, src_header.clustering_key_types_names.elements)
+        && same_columns(header.static_columns, src_header.static_columns)
+        && same_columns(header.regular_columns, src_header.regular_columns);
+}
+
 std::unique_ptr<sstable_writer::writer_impl> make_writer(sstable& sst,
         const schema& s,
         uint64_t estimated_partitions,
@@ -22,5 +22,13 @@ std::unique_ptr<sstable_writer::writer_impl> make_writer(sstable& sst,
     encoding_stats enc_stats,
     shard_id shard);
 
+// The encoding stats an sstable has to be written with, for partitions of
+// `src` to be copied into it with sstable_writer::consume_raw_partition().
+encoding_stats encoding_stats_for_raw_copy(const sstable& src);
+
+// Whether partitions of `src` can be copied verbatim into an sstable of
+// version `v`, written for schema `s` with encoding_stats_for_raw_copy(src).
+bool can_copy_raw_partitions(const sstable& src, const schema& s, const sstable_writer_config& cfg, sstable_version_types v);
+
 }
 }
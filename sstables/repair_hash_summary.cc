@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#include "sstables/repair_hash_summary.hh"
+#include "sstables/sstables.hh"
+#include "dht/i_partitioner.hh"
+#include "mutation/atomic_cell_hash.hh"
+#include "utils/hashing.hh"
+#include "utils/xx_hasher.hh"
+
+namespace sstables {
+
+namespace {
+
+enum class fragment_kind : uint8_t {
+    partition_tombstone,
+    static_row,
+    clustering_row,
+    range_tombstone,
+};
+
+template <typename Func>
+uint64_t hash_fragment(uint64_t partition_key_hash, fragment_kind kind, Func&& feed) {
+    xx_hasher h;
+    feed_hash(h, partition_key_hash);
+    feed_hash(h, static_cast<uint8_t>(kind));
+    feed(h);
+    return h.finalize_uint64();
+}
+
+void feed_cells(xx_hasher& h, const row& cells, const schema& s, column_kind kind) {
+    cells.for_each_cell([&] (column_id id, const atomic_cell_or_collection& cell) {
+        feed_hash(h, id);
+        feed_hash(h, cell, s.column_at(kind, id));
+    });
+}
+
+bool is_key(const dht::token& t) noexcept {
+    return t._kind == dht::token::kind::key;
+}
+
+// Returns the level and the bucket of the token ring which `range` is equal
+// to, if any.
+std::optional<std::pair<unsigned, uint64_t>> bucket_of_range(const dht::token_range& range) {
+    const bool starts_at_min = !range.start() || range.start()->value()._kind == dht::token::kind::before_all_keys;
+    const bool ends_at_max = !range.end() || range.end()->value()._kind == dht::token::kind::after_all_keys;
+    if ((!starts_at_min && (range.start()->is_inclusive() || !is_key(range.start()->value())))
+            || (!ends_at_max && !range.end()->is_inclusive())) {
+        return std::nullopt;
+    }
+    for (unsigned level = 0; level <= repair_hash_summary_tracker::max_level; ++level) {
+        const uint64_t bucket = ends_at_max ? (uint64_t(1) << level) - 1 : dht::compaction_group_of(level, range.end()->value());
+        if (!ends_at_max && dht::last_token_of_compaction_group(level, bucket) != range.end()->value()) {
+            continue;
+        }
+        if (bucket == 0 ? starts_at_min : !starts_at_min && dht::last_token_of_compaction_group(level, bucket - 1) == range.start()->value()) {
+            return std::make_pair(level, bucket);
+        }
+    }
+    return std::nullopt;
+}
+
+} // anonymous namespace
+
+uint64_t repair_hash_summary_columns_digest(const schema& s) {
+    xx_hasher h;
+    for (const auto& col : s.all_columns()) {
+        feed_hash(h, static_cast<uint8_t>(col.kind));
+        feed_hash(h, col.id);
+        feed_hash(h, col.name());
+        feed_hash(h, col.type->name());
+    }
+    return h.finalize_uint64();
+}
+
+void repair_hash_summary_tracker::merge_buckets() {
+    size_t n = 0;
+    for (const auto& b : _buckets) {
+        const auto parent = b.bucket >> 1;
+        if (n && _buckets[n - 1].bucket == parent) {
+            _buckets[n - 1].hash += b.hash;
+            _buckets[n - 1].fragments += b.fragments;
+        } else {
+            _buckets[n++] = repair_hash_summary_bucket{.bucket = parent, .hash = b.hash, .fragments = b.fragments};
+        }
+    }
+    _buckets.resize(n);
+    --_level;
+}
+
+void repair_hash_summary_tracker::on_new_partition(const dht::decorated_key& dk) {
+    xx_hasher h;
+    feed_hash(h, dk.key(), _schema);
+    _partition_key_hash = h.finalize_uint64();
+    _range_tombstone = {};
+    const auto bucket = dht::compaction_group_of(_level, dk.token());
+    if (_buckets.empty() || _buckets.back().bucket != bucket) {
+        _buckets.push_back(repair_hash_summary_bucket{.bucket = bucket, .hash = 0, .fragments = 0});
+        while (_buckets.size() > max_buckets) {
+            merge_buckets();
+        }
+    }
+}
+
+void repair_hash_summary_tracker::on_partition_tombstone(tombstone t) {
+    if (!t) {
+        return;
+    }
+    add(hash_fragment(_partition_key_hash, fragment_kind::partition_tombstone, [&] (xx_hasher& h) {
+        feed_hash(h, t);
+    }));
+}
+
+void repair_hash_summary_tracker::on_static_row(const static_row& sr) {
+    if (sr.empty()) {
+        return;
+    }
+    add(hash_fragment(_partition_key_hash, fragment_kind::static_row, [&] (xx_hasher& h) {
+        feed_cells(h, sr.cells(), _schema, column_kind::static_column);
+    }));
+}
+
+void repair_hash_summary_tracker::on_clustering_row(const clustering_row& cr) {
+    add(hash_fragment(_partition_key_hash, fragment_kind::clustering_row, [&] (xx_hasher& h) {
+        feed_hash(h, cr.key(), _schema);
+        feed_hash(h, cr.tomb());
+        feed_hash(h, cr.marker());
+        feed_cells(h, cr.cells(), _schema, column_kind::regular_column);
+    }));
+}
+
+void repair_hash_summary_tracker::on_range_tombstone_change(const range_tombstone_change& rtc) {
+    if (_range_tombstone) {
+        add(hash_fragment(_partition_key_hash, fragment_kind::range_tombstone, [&] (xx_hasher& h) {
+            _range_tombstone_start.feed_hash(h, _schema);
+            rtc.position().feed_hash(h, _schema);
+            feed_hash(h, _range_tombstone);
+        }));
+    }
+    _range_tombstone_start = rtc.position();
+    _range_tombstone = rtc.tombstone();
+}
+
+std::optional<scylla_metadata::repair_hash_summary> repair_hash_summary_tracker::get() && {
+    if (_incomplete) {
+        return std::nullopt;
+    }
+    scylla_metadata::repair_hash_summary summary;
+    summary.level = _level;
+    summary.columns_digest = repair_hash_summary_columns_digest(_schema);
+    summary.buckets.elements = utils::chunked_vector<repair_hash_summary_bucket>(_buckets.begin(), _buckets.end());
+    return summary;
+}
+
+std::optional<repair_hash_digest> get_repair_hash_digest(const std::vector<shared_sstable>& sstables, const dht::token_range& range, const schema& s) {
+    const auto range_bucket = bucket_of_range(range);
+    if (!range_bucket) {
+        return std::nullopt;
+    }
+    const auto [level, bucket] = *range_bucket;
+    const auto columns_digest = repair_hash_summary_columns_digest(s);
+    repair_hash_digest digest;
+    for (const auto& sst : sstables) {
+        const auto first = dht::compaction_group_of(level, sst->get_first_decorated_key().token());
+        const auto last = dht::compaction_group_of(level, sst->get_last_decorated_key().token());
+        if (last < bucket || first > bucket) {
+            continue;
+        }
+        const auto* sm = sst->get_scylla_metadata();
+        const auto* summary = sm ? sm->get_repair_hash_summary() : nullptr;
+        if (!summary || summary->columns_digest != columns_digest) {
+            return std::nullopt;
+        }
+        if (first == bucket && last == bucket) {
+            // All the partitions of the sstable are in the range.
+            for (const auto& b : summary->buckets.elements) {
+                digest.add(b.hash, b.fragments);
+            }
+            continue;
+        }
+        if (summary->level < level) {
+            return std::nullopt;
+        }
+        const auto shift = summary->level - level;
+        for (const auto& b : summary->buckets.elements) {
+            if ((b.bucket >> shift) == bucket) {
+                digest.add(b.hash, b.fragments);
+            }
+        }
+    }
+    return digest;
+}
+
+} // namespace sstables
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "dht/i_partitioner_fwd.hh"
+#include "mutation/mutation_fragment.hh"
+#include "mutation/mutation_fragment_v2.hh"
+#include "sstables/shared_sstable.hh"
+#include "sstables/types.hh"
+
+namespace sstables {
+
+/// An order-independent digest of a collection of mutation fragments: the
+/// sum of their hashes and their number. Equal collections of fragments have
+/// equal digests, however they are split into sstables.
+struct repair_hash_digest {
+    uint64_t hash = 0;
+    uint64_t fragments = 0;
+
+    void add(uint64_t h, uint64_t n) noexcept {
+        hash += h;
+        fragments += n;
+    }
+
+    bool operator==(const repair_hash_digest&) const = default;
+};
+
+/// Digest of the columns of a schema, see repair_hash_summary_type::columns_digest.
+uint64_t repair_hash_summary_columns_digest(const schema& s);
+
+/// Hashes the fragments written to an sstable into the buckets of its
+/// RepairHashSummary.
+///
+/// Each fragment is hashed with xxhash, together with its partition key, as
+/// repair_hasher does for repair rows. Range tombstones are hashed whole, with
+/// both their bounds, rather than as the changes they are written as, since
+/// the sum of the hashes of the changes of range tombstones written to
+/// different sstables doesn't tell which bounds belong together. The buckets start at max_level and are
+/// merged into their parents whenever there are more than max_buckets of them,
+/// which is exact since the partitions are written in token order, and the
+/// hashes are summed.
+class repair_hash_summary_tracker {
+public:
+    static constexpr unsigned max_level = 32;
+    static constexpr size_t max_buckets = 64;
+private:
+    const schema& _schema;
+    unsigned _level = max_level;
+    std::vector<repair_hash_summary_bucket> _buckets;
+    uint64_t _partition_key_hash = 0;
+    // The range tombstone opened by the last range tombstone change, hashed
+    // when the next change closes it.
+    position_in_partition _range_tombstone_start = position_in_partition::before_all_clustered_rows();
+    tombstone _range_tombstone;
+    // Set when partitions are written without their fragments being seen.
+    bool _incomplete = false;
+private:
+    void merge_buckets();
+    void add(uint64_t hash) noexcept {
+        _buckets.back().hash += hash;
+        _buckets.back().fragments++;
+    }
+public:
+    explicit repair_hash_summary_tracker(const schema& s) : _schema(s) {}
+
+    void on_new_partition(const dht::decorated_key& dk);
+    void on_partition_tombstone(tombstone t);
+    void on_static_row(const static_row& sr);
+    void on_clustering_row(const clustering_row& cr);
+    void on_range_tombstone_change(const range_tombstone_change& rtc);
+    // A partition was copied from another sstable without being decoded.
+    void on_raw_partition() noexcept {
+        _incomplete = true;
+    }
+
+    // Returns a disengaged optional if the sstable has partitions which were not hashed.
+    std::optional<scylla_metadata::repair_hash_summary> get() &&;
+};
+
+/// Returns the digest of the data that `sstables` hold in `range`, according
+/// to their RepairHashSummary, or a disengaged optional if it cannot be
+/// computed without reading the sstables: when `range` is not a bucket of
+/// the token ring at some level, or when one of the sstables overlapping it
+/// has no summary for the columns of `s`, or a summary with buckets which
+/// straddle the bounds of `range`.
+std::optional<repair_hash_digest> get_repair_hash_digest(const std::vector<shared_sstable>& sstables, const dht::token_range& range, const schema& s);
+
+} // namespace sstables
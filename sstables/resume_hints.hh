@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <unordered_map>
+
+#include "dht/i_partitioner.hh"
+#include "sstables/generation_type.hh"
+
+namespace sstables {
+
+/// Hints allowing a paged range scan to resume reading sstables where the
+/// previous page left off, without looking up the start of the page in the
+/// sstables' index.
+///
+/// Range readers log the tokens and data file offsets of the last few
+/// consecutive partitions they started to read, see partition_log. Readers
+/// read ahead of where the page ends, so several partitions are logged.
+/// Logging copies no keys and allocates nothing beyond the log itself.
+///
+/// When the querier of a page is evicted from the querier cache to free up
+/// resources, a resume_hints object is attached to its permit (see
+/// reader_permit::resume_hints()) and kept by the querier cache, keyed by the
+/// query id of the paging state. The readers of the evicted querier save
+/// their logs into it when they are closed. If the next page has to recreate
+/// its readers, their permit picks the hints up, and each reader can start
+/// reading the data file at the first logged partition of the page, provided
+/// the partition preceding it was logged too.
+class resume_hints {
+public:
+    static constexpr size_t max_partitions_per_sstable = 32;
+
+    // Where a resumed read starts in the data file.
+    struct resume_position {
+        // The first logged partition which is not known to be before the
+        // start of the read range.
+        uint64_t start;
+        // The partition following it, if logged. Allows skipping the first
+        // partition without the index, if it turns out to be before the
+        // range, which is the case when it has the same token as the start
+        // of the range.
+        std::optional<uint64_t> next;
+    };
+
+    // The last few consecutive partitions read from an sstable, in data file
+    // order. Only their tokens are logged, so the log is cheap to maintain,
+    // even if the hints are never used.
+    class partition_log {
+        struct partition_start {
+            dht::token token;
+            uint64_t offset;
+        };
+        std::array<partition_start, max_partitions_per_sstable> _partitions;
+        // The number of partitions logged since the last reset.
+        size_t _logged = 0;
+
+        const partition_start& at(size_t i) const noexcept {
+            return _partitions[(_logged - size() + i) % max_partitions_per_sstable];
+        }
+    public:
+        void reset() noexcept {
+            _logged = 0;
+        }
+
+        void record(dht::token token, uint64_t offset) noexcept {
+            _partitions[_logged++ % max_partitions_per_sstable] = partition_start{token, offset};
+        }
+
+        size_t size() const noexcept {
+            return std::min(_logged, max_partitions_per_sstable);
+        }
+
+        /// The position to start reading the sstable at, for a range
+        /// starting at `pr`, if known.
+        std::optional<resume_position> find_start(const dht::partition_range& pr) const {
+            const auto& t = pr.start()->value().token();
+            for (size_t i = 1; i < size(); ++i) {
+                if (at(i).token >= t) {
+                    // Partitions with the same token as the start of the range
+                    // may be before it, so the preceding partition has to be
+                    // strictly before the range to know nothing is missed.
+                    if (at(i - 1).token < t) {
+                        return resume_position{at(i).offset, i + 1 < size() ? std::make_optional(at(i + 1).offset) : std::nullopt};
+                    }
+                    break;
+                }
+            }
+            return std::nullopt;
+        }
+    };
+
+private:
+    std::unordered_map<generation_type, partition_log> _logs;
+
+public:
+    void save(generation_type gen, const partition_log& log) {
+        if (log.size()) {
+            _logs.insert_or_assign(gen, log);
+        }
+    }
+
+    const partition_log* find(generation_type gen) const {
+        auto it = _logs.find(gen);
+        return it == _logs.end() ? nullptr : &it->second;
+    }
+
+    bool empty() const noexcept {
+        return _logs.empty();
+    }
+};
+
+} // namespace sstables
@@ -1002,6 +1002,7 @@ sstable_set_impl::create_single_key_sstable_reader(
         readers.push_back(make_mutation_reader_from_mutations(schema, permit, mutation(schema, *pos.key()), slice, fwd));
     }
     sstable_histogram.add(num_readers);
+    cf->note_read_fanout(pos.token(), num_readers);
     return make_combined_reader(schema, std::move(permit), std::move(readers), fwd, fwd_mr);
 }
 
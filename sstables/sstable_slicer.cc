@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#include <algorithm>
+#include <map>
+
+#include <seastar/core/byteorder.hh>
+#include <seastar/core/thread.hh>
+#include <seastar/util/closeable.hh>
+
+#include "sstables/sstable_slicer.hh"
+#include "sstables/sstables.hh"
+#include "sstables/abstract_index_reader.hh"
+#include "sstables/exceptions.hh"
+#include "sstables/key.hh"
+#include "sstables/mx/writer.hh"
+#include "dht/i_partitioner.hh"
+#include "readers/mutation_reader.hh"
+
+namespace sstables {
+
+extern logging::logger sstlog;
+
+namespace {
+
+// Forwards the fragments of a single partition to a writer, which is left
+// open for the next partitions.
+class partition_forwarder {
+    sstable_writer& _writer;
+public:
+    explicit partition_forwarder(sstable_writer& writer) : _writer(writer) {}
+
+    void consume_new_partition(const dht::decorated_key& dk) {
+        _writer.consume_new_partition(dk);
+    }
+    void consume(tombstone t) {
+        _writer.consume(t);
+    }
+    stop_iteration consume(static_row&& sr) {
+        _writer.consume(std::move(sr));
+        return stop_iteration::no;
+    }
+    stop_iteration consume(clustering_row&& cr) {
+        _writer.consume(std::move(cr));
+        return stop_iteration::no;
+    }
+    stop_iteration consume(range_tombstone_change&& rtc) {
+        _writer.consume(std::move(rtc));
+        return stop_iteration::no;
+    }
+    stop_iteration consume_end_of_partition() {
+        _writer.consume_end_of_partition();
+        return stop_iteration::no;
+    }
+    void consume_end_of_stream() {
+    }
+};
+
+struct slice_writer {
+    shared_sstable sst;
+    sstable_writer writer;
+    bool copy_raw_partitions;
+};
+
+temporary_buffer<char> read_exactly(input_stream<char>& in, size_t n, const sstable& sst) {
+    auto buf = in.read_exactly(n).get();
+    if (buf.size() != n) {
+        throw malformed_sstable_exception(format("Unexpected end of data file, expected {} bytes, got {}", n, buf.size()), sst.get_filename());
+    }
+    return buf;
+}
+
+} // anonymous namespace
+
+bool can_slice_sstable(const sstable& sst, const sstable_writer_config& cfg, sstable_version_types v) {
+    return mc::can_copy_raw_partitions(sst, *sst.get_schema(), cfg, v);
+}
+
+future<sstable_slices> slice_sstable(shared_sstable sst, reader_permit permit, sstable_slice_classifier classify,
+        noncopyable_function<shared_sstable()> creator, const sstable_writer_config& cfg, abort_source& as) {
+    return seastar::async([sst = std::move(sst), permit = std::move(permit), classify = std::move(classify), creator = std::move(creator), &cfg, &as] () mutable {
+        const auto schema = sst->get_schema();
+        const auto enc_stats = mc::encoding_stats_for_raw_copy(*sst);
+        const auto data_size = sst->data_size();
+        // The slices are the same data as `sst`, so they have the same origin.
+        auto out_cfg = cfg;
+        out_cfg.origin = sst->get_origin();
+        sstable_slices slices;
+        std::map<size_t, slice_writer> writers;
+
+        auto writer_for = [&] (size_t slice) -> slice_writer& {
+            auto it = writers.find(slice);
+            if (it == writers.end()) {
+                auto out = creator();
+                slices.sstables.push_back(out);
+                out->add_ancestor(sst->generation());
+                auto writer = out->get_writer(*schema, sst->get_estimated_key_count(), out_cfg, enc_stats);
+                bool copy_raw_partitions = mc::can_copy_raw_partitions(*sst, *schema, out_cfg, out->get_version());
+                it = writers.emplace(slice, slice_writer{out, std::move(writer), copy_raw_partitions}).first;
+            }
+            return it->second;
+        };
+
+        try {
+            auto index = sst->make_index_reader(permit, {}, use_caching::no);
+            auto close_index = deferred_close(*index);
+            auto data = sst->data_stream(0, data_size, permit, {}, {}).get();
+            auto close_data = deferred_close(data);
+
+            // The partitions are delimited by the data file positions of
+            // consecutive index entries.
+            auto next_partition_start = [&] {
+                if (index->eof()) {
+                    return data_size;
+                }
+                index->read_partition_data().get();
+                return index->data_file_positions().start;
+            };
+
+            auto start = next_partition_start();
+            while (start < data_size) {
+                as.check();
+                index->advance_to_next_partition().get();
+                const auto end = next_partition_start();
+
+                auto key_size = read_exactly(data, sizeof(uint16_t), *sst);
+                auto key_bytes = read_exactly(data, read_be<uint16_t>(key_size.get()), *sst);
+                const auto header_size = key_size.size() + key_bytes.size();
+                if (end - start < header_size) {
+                    throw malformed_sstable_exception(format("Partition at {} overlaps the next one at {}", start, end), sst->get_filename());
+                }
+                const auto rest_size = end - start - header_size;
+                auto dk = dht::decorate_key(*schema, key_view(bytes_view(reinterpret_cast<const int8_t*>(key_bytes.get()), key_bytes.size())).to_partition_key(*schema));
+
+                auto slice = classify(dk.token());
+                if (!slice) {
+                    data.skip(rest_size).get();
+                    ++slices.stats.dropped_partitions;
+                } else if (auto& w = writer_for(*slice); w.copy_raw_partitions && end - start < out_cfg.promoted_index_block_size) {
+                    auto rest = read_exactly(data, rest_size, *sst);
+                    temporary_buffer<char> partition(end - start);
+                    auto out = std::copy_n(key_size.get(), key_size.size(), partition.get_write());
+                    out = std::copy_n(key_bytes.get(), key_bytes.size(), out);
+                    std::copy_n(rest.get(), rest.size(), out);
+                    w.writer.consume_raw_partition(*sst, dk, std::move(partition));
+                    ++slices.stats.copied_partitions;
+                } else {
+                    data.skip(rest_size).get();
+                    auto pr = dht::partition_range::make_singular(dk);
+                    auto reader = sst->make_reader(schema, permit, pr, schema->full_slice(), {},
+                            streamed_mutation::forwarding::no, mutation_reader::forwarding::no);
+                    auto close_reader = deferred_close(reader);
+                    reader.consume_in_thread(partition_forwarder(w.writer));
+                    ++slices.stats.rewritten_partitions;
+                }
+                start = end;
+            }
+
+            for (auto& [_, w] : writers) {
+                w.writer.set_repaired_at(sst->get_stats_metadata().repaired_at);
+                w.writer.consume_end_of_stream();
+                w.sst->open_data().get();
+            }
+        } catch (...) {
+            auto ex = std::current_exception();
+            writers.clear();
+            for (auto& out : slices.sstables) {
+                out->unlink().get();
+            }
+            std::rethrow_exception(std::move(ex));
+        }
+
+        sstlog.debug("Sliced {} into {} sstables: copied {} partitions, rewrote {} and dropped {}", sst->get_filename(), slices.sstables.size(),
+                slices.stats.copied_partitions, slices.stats.rewritten_partitions, slices.stats.dropped_partitions);
+        return slices;
+    });
+}
+
+} // namespace sstables
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/future.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include "dht/token.hh"
+#include "reader_permit.hh"
+#include "sstables/shared_sstable.hh"
+#include "sstables/version.hh"
+
+namespace sstables {
+
+struct sstable_writer_config;
+
+struct sstable_slicing_stats {
+    // Partitions copied from the data file of the source without being decoded.
+    uint64_t copied_partitions = 0;
+    // Partitions too large to be copied, which were re-encoded.
+    uint64_t rewritten_partitions = 0;
+    // Partitions which don't belong to any of the slices.
+    uint64_t dropped_partitions = 0;
+};
+
+struct sstable_slices {
+    std::vector<shared_sstable> sstables;
+    sstable_slicing_stats stats;
+};
+
+// Returns the slice a token belongs to, or std::nullopt if the partitions
+// with this token are to be dropped.
+using sstable_slice_classifier = noncopyable_function<std::optional<size_t>(dht::token)>;
+
+// Whether `sst` can be sliced into sstables of version `v`, written with
+// `cfg` for the schema of `sst`. See slice_sstable().
+bool can_slice_sstable(const sstable& sst, const sstable_writer_config& cfg, sstable_version_types v);
+
+// Slices `sst` into one sstable per slice returned by `classify` for the
+// tokens of its partitions, created with `creator`.
+//
+// Unlike compaction, slicing doesn't decode the partitions: they are copied
+// from the data file of `sst` as they are, and only the index, summary,
+// filter and statistics of the slices are generated anew. Partitions large
+// enough to need a promoted index in the slices are the exception, they are
+// read and written again. The statistics of the slices are those of `sst`,
+// except for the partition sizes and counts, so they may be wider than
+// necessary. The per-partition cell, row and tombstone counts are estimated
+// from the statistics of `sst`. The slices keep the repair time and origin
+// of `sst`, and have it as their ancestor.
+//
+// The sstables are sliced one partition at a time, so memory usage is bounded
+// by the size of the largest copied partition, itself bounded by the
+// promoted index block size.
+//
+// Slicing is only possible if can_slice_sstable() returned true for `sst`.
+// The returned sstables are sealed, and are deleted if slicing fails.
+future<sstable_slices> slice_sstable(shared_sstable sst, reader_permit permit, sstable_slice_classifier classify,
+        noncopyable_function<shared_sstable()> creator, const sstable_writer_config& cfg, abort_source& as);
+
+} // namespace sstables
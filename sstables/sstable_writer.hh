@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <seastar/core/smp.hh>
+#include <seastar/core/temporary_buffer.hh>
 #include "schema/schema_fwd.hh"
 #include "mutation/mutation_fragment.hh"
 #include "mutation/mutation_fragment_v2.hh"
@@ -43,6 +44,11 @@ class sstable_writer {
     stop_iteration consume(range_tombstone_change&& rtc);
     stop_iteration consume_end_of_partition();
     void consume_end_of_stream();
+    // Appends a whole partition, copied verbatim from the data file of `src`
+    // (from its partition key up to and including its end-of-partition flag).
+    // The partition must not need a promoted index and `src` must be
+    // compatible, see mc::can_copy_raw_partitions().
+    void consume_raw_partition(const sstable& src, const dht::decorated_key& dk, temporary_buffer<char> data);
     void set_repaired_at(int64_t repaired_at);
     uint64_t data_file_position_for_tests() const;
 };
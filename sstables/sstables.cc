@@ -981,10 +981,11 @@ void sstable::generate_toc() {
     _recognized_components.insert(component_type::Scylla);
 }
 
-future<std::unordered_map<component_type, file>> sstable::readable_file_for_all_components() const {
+future<std::unordered_map<component_type, file>> sstable::readable_file_for_all_components(bool unsealed) const {
     std::unordered_map<component_type, file> files;
     for (auto c : _recognized_components) {
-        files.emplace(c, co_await open_file(c, open_flags::ro));
+        auto on_disk = unsealed && c == component_type::TOC ? component_type::TemporaryTOC : c;
+        files.emplace(c, co_await open_file(on_disk, open_flags::ro));
     }
     co_return std::move(files);
 }
@@ -1601,7 +1602,8 @@ bool sstable::should_update_repaired_at(int64_t repaired_at) const {
 // 4. Apply the modifier function to the new SSTable's components
 // 5. Re-read the Scylla metadata from disk
 //    - Ensures we have the latest on-disk metadata (not potentially modified in-memory state)
-// 6. If update_sstable_id is true, update the Scylla metadata's sstable identifier to a new value
+// 6. If update_sstable_id is true, update the Scylla metadata's sstable identifier to a new value,
+//    and if new_run_id is engaged, replace the Scylla metadata's run identifier with it
 // 7. Write the component with updated Scylla metadata
 //    - Uses write_component_with_metadata() which handles digest calculation and metadata updates
 // 8. Finalize the new SSTable
@@ -1609,7 +1611,8 @@ bool sstable::should_update_repaired_at(int64_t repaired_at) const {
 future<shared_sstable> sstable::link_with_rewritten_component(std::function<shared_sstable(shared_sstable)> sstable_creator,
         component_type component,
         std::function<void(sstable&)> modifier,
-        update_sstable_id update_id) {
+        update_sstable_id update_id,
+        std::optional<run_id> new_run_id) {
     if (!is_component_rewrite_supported(component)) {
         on_internal_error(sstlog, "Only Statistics component can be rewritten.");
     }
@@ -1626,7 +1629,7 @@ future<shared_sstable> sstable::link_with_rewritten_component(std::function<shar
         on_internal_error(sstlog, "Cannot keep sstable id when rewriting object-storage sstable component");
     }
 
-    return seastar::async([this, creator = std::move(sstable_creator), component, modifier = std::move(modifier), update_id] {
+    return seastar::async([this, creator = std::move(sstable_creator), component, modifier = std::move(modifier), update_id, new_run_id] {
         auto new_sst = creator(shared_from_this());
         auto generation = new_sst->generation();
 
@@ -1642,6 +1645,9 @@ future<shared_sstable> sstable::link_with_rewritten_component(std::function<shar
         if (update_id) {
             metadata.set_sstable_identifier();
         }
+        if (new_run_id) {
+            metadata.data.set<scylla_metadata_type::RunIdentifier>(sstables::run_identifier{*new_run_id});
+        }
 
         new_sst->write_component_with_metadata(component, std::move(metadata));
 
@@ -2388,7 +2394,10 @@ static sstable_column_kind to_sstable_column_kind(column_kind k) {
 void
 sstable::write_scylla_metadata(shard_id shard, struct run_identifier identifier,
         std::optional<scylla_metadata::large_data_stats> ld_stats, std::optional<scylla_metadata::ext_timestamp_stats> ts_stats,
-        std::optional<scylla_metadata::large_data_records> ld_records) {
+        std::optional<scylla_metadata::large_data_records> ld_records,
+        std::optional<scylla_metadata::tombstone_density> tombstone_density,
+        std::optional<scylla_metadata::timestamp_index> timestamp_index,
+        std::optional<scylla_metadata::repair_hash_summary> repair_hash_summary) {
     auto&& first_key = get_first_decorated_key();
     auto&& last_key = get_last_decorated_key();
 
@@ -2414,6 +2423,15 @@ sstable::write_scylla_metadata(shard_id shard, struct run_identifier identifier,
     if (ld_records) {
         _components->scylla_metadata->data.set<scylla_metadata_type::LargeDataRecords>(std::move(*ld_records));
     }
+    if (tombstone_density) {
+        _components->scylla_metadata->data.set<scylla_metadata_type::TombstoneDensity>(std::move(*tombstone_density));
+    }
+    if (timestamp_index) {
+        _components->scylla_metadata->data.set<scylla_metadata_type::TimestampIndex>(std::move(*timestamp_index));
+    }
+    if (repair_hash_summary) {
+        _components->scylla_metadata->data.set<scylla_metadata_type::RepairHashSummary>(std::move(*repair_hash_summary));
+    }
     if (!_origin.empty()) {
         scylla_metadata::sstable_origin o;
         o.value = bytes(to_bytes_view(std::string_view(_origin)));
@@ -3947,6 +3965,8 @@ future<> init_metrics() {
             sm::description("Number of single partition flat mutation reads")),
         sm::make_counter("range_partition_reads", [] { return sstables_stats::get_shard_stats().range_partition_reads; },
             sm::description("Number of partition range flat mutation reads")),
+        sm::make_counter("resumed_range_partition_reads", [] { return sstables_stats::get_shard_stats().resumed_range_partition_reads; },
+            sm::description("Number of partition range flat mutation reads which resumed where the previous page of the query left off, without an index lookup")),
         sm::make_counter("partition_reads", [] { return sstables_stats::get_shard_stats().partition_reads; },
             sm::description("Number of partitions read")),
         sm::make_counter("partition_seeks", [] { return sstables_stats::get_shard_stats().partition_seeks; },
@@ -4085,6 +4105,25 @@ scylla_metadata::ext_timestamp_stats::map_type sstable::get_ext_timestamp_stats(
     return scylla_metadata::ext_timestamp_stats::map_type{};
 }
 
+std::optional<api::timestamp_type> sstable::get_min_timestamp_for_token(dht::token token, ext_timestamp_stats_type stat) const noexcept {
+    const auto* sm = get_scylla_metadata();
+    const auto* index = sm ? sm->get_timestamp_index() : nullptr;
+    if (!index || index->elements.empty()) {
+        return std::nullopt;
+    }
+    const auto& segments = index->elements;
+    const auto t = token.raw();
+    // Partitions with the same token may span several consecutive segments.
+    auto it = std::ranges::lower_bound(segments, t, std::less<>(), std::mem_fn(&timestamp_index_segment::last_token));
+    auto min_timestamp = api::max_timestamp;
+    for (; it != segments.end() && it->first_token <= t; ++it) {
+        min_timestamp = std::min(min_timestamp, stat == ext_timestamp_stats_type::min_live_row_marker_timestamp
+                ? it->min_live_row_marker_timestamp
+                : it->min_live_timestamp);
+    }
+    return min_timestamp;
+}
+
 // The gc_before returned by the function can only be used to estimate if the
 // sstable is worth dropping some tombstones. We only return the maximum
 // gc_before for all the partitions that have record in repair history map. It
@@ -127,6 +127,10 @@ struct sstable_writer_config {
     sstring origin;
     bool correct_pi_block_width = true;
     uint32_t large_data_records_per_sstable = 10;
+    // Number of other shards compressing the data file in parallel with this one.
+    unsigned compression_helper_shards = 0;
+    // Write the RepairHashSummary scylla metadata component.
+    bool write_repair_hash_summary = false;
 
 private:
     explicit sstable_writer_config() {}
@@ -718,7 +722,10 @@ class sstable : public enable_lw_shared_from_this<sstable> {
                                run_identifier identifier,
                                std::optional<scylla_metadata::large_data_stats> ld_stats,
                                std::optional<scylla_metadata::ext_timestamp_stats> ts_stats,
-                               std::optional<scylla_metadata::large_data_records> ld_records = std::nullopt);
+                               std::optional<scylla_metadata::large_data_records> ld_records = std::nullopt,
+                               std::optional<scylla_metadata::tombstone_density> tombstone_density = std::nullopt,
+                               std::optional<scylla_metadata::timestamp_index> timestamp_index = std::nullopt,
+                               std::optional<scylla_metadata::repair_hash_summary> repair_hash_summary = std::nullopt);
 
     future<> read_filter(sstable_open_config cfg = {});
 
@@ -1117,6 +1124,12 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     // Some or all entries may be missing if not present in scylla_metadata
     scylla_metadata::ext_timestamp_stats::map_type get_ext_timestamp_stats() const noexcept;
 
+    // Returns the minimum of the given timestamp statistic over the partitions
+    // of the sstable close to `token` in token order, according to the
+    // TimestampIndex, or a disengaged optional if the sstable has no such index.
+    // Returns api::max_timestamp if the sstable has no partition with `token`.
+    std::optional<api::timestamp_type> get_min_timestamp_for_token(dht::token token, ext_timestamp_stats_type stat) const noexcept;
+
     const sstring& get_origin() const noexcept {
         return _origin;
     }
@@ -1133,8 +1146,10 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     // Drops all evictable in-memory caches of on-disk content.
     future<> drop_caches();
 
-    // Returns a read-only file for all existing components of the sstable
-    future<std::unordered_map<component_type, file>> readable_file_for_all_components() const;
+    // Returns a read-only file for all existing components of the sstable.
+    // The TOC of an sstable which was written with leave_unsealed is still temporary,
+    // so `unsealed` makes its TemporaryTOC be returned as the TOC.
+    future<std::unordered_map<component_type, file>> readable_file_for_all_components(bool unsealed = false) const;
 
     // Clones this sstable with a new generation, under the same location as the original one.
     // If leave_unsealed is true, the destination sstable is left unsealed.
@@ -1192,11 +1207,13 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     // Creates a new sstable by linking all sstable components except for the specified component,
     // which is created by calling the provided sstable_creator function and then written to the disc.
     // The modifier function is called on the new sstable before writing the component
+    // If new_run_id is engaged, the new sstable is made part of that run.
     // Returns the newly created and sealed sstable.
     future<shared_sstable> link_with_rewritten_component(std::function<shared_sstable(shared_sstable)> sstable_creator,
             component_type component,
             std::function<void(sstable&)> modifier,
-            update_sstable_id);
+            update_sstable_id,
+            std::optional<run_id> new_run_id = std::nullopt);
     // Must be called in a seastar thread
     void write_component_with_metadata(component_type type, scylla_metadata metadata);
 };
@@ -8,6 +8,7 @@
 
 #include <seastar/coroutine/parallel_for_each.hh>
 #include <seastar/coroutine/switch_to.hh>
+#include <fmt/ranges.h>
 #include <unordered_map>
 #include <unordered_set>
 #include "utils/log.hh"
@@ -265,6 +266,7 @@ sstable_writer_config sstables_manager::configure_writer(sstring origin) const {
 
     cfg.origin = std::move(origin);
     cfg.large_data_records_per_sstable = _config.large_data_records_per_sstable();
+    cfg.write_repair_hash_summary = _config.write_repair_hash_summary();
 
     return cfg;
 }
@@ -414,10 +416,17 @@ future<> sstables_manager::delete_atomically(std::vector<shared_sstable> ssts) {
         co_return;
     }
 
-    // All sstables here belong to the same table, thus they do live
-    // in the same storage so it's OK to get the deleter from _signal_mana
-    // front element. The deleter implementation is welcome to check
-    // that sstables from the vector really live in it.
+    // All sstables here belong to the same table, thus they live in the
+    // table's storage, except for the windows TWCS offloaded to object
+    // storage. Deletion is only atomic within a storage, so compaction never
+    // mixes offloaded and local sstables, see compaction_task_executor::compact_sstables().
+    const bool object_storage = ssts.front()->get_storage().is_object_storage();
+    if (std::ranges::any_of(ssts, [object_storage] (const shared_sstable& sst) { return sst->get_storage().is_object_storage() != object_storage; })) {
+        on_internal_error(smlogger, fmt::format("Cannot delete sstables of several storages atomically: {}", ssts));
+    }
+
+    // The deleter implementation is welcome to check that sstables
+    // from the vector really live in it.
     auto& storage = ssts.front()->get_storage();
     auto ctx = co_await storage.atomic_delete_prepare(ssts);
 
@@ -124,6 +124,8 @@ class sstables_manager {
         const std::vector<sstring>& data_file_directories;
         utils::updateable_value<sstring> format = utils::updateable_value<sstring>(fmt::to_string(sstable_version_types::me));
         utils::updateable_value<uint32_t> large_data_records_per_sstable = utils::updateable_value<uint32_t>(10);
+        utils::updateable_value<uint32_t> compaction_compression_helper_shards = utils::updateable_value<uint32_t>(0);
+        utils::updateable_value<bool> write_repair_hash_summary = utils::updateable_value<bool>(false);
         bool ignore_component_digest_mismatch = false;
         bool enable_dangerous_direct_import_of_cassandra_counters = false;
     };
@@ -25,6 +25,7 @@ class sstables_stats {
         uint64_t cell_tombstone_writes = 0;
         uint64_t single_partition_reads = 0;
         uint64_t range_partition_reads = 0;
+        uint64_t resumed_range_partition_reads = 0;
         uint64_t partition_reads = 0;
         uint64_t partition_seeks = 0;
         uint64_t row_reads = 0;
@@ -89,6 +90,10 @@ class sstables_stats {
         ++_stats.range_partition_reads;
     }
 
+    inline void on_range_read_resumed() noexcept {
+        ++_stats.resumed_range_partition_reads;
+    }
+
     inline void on_partition_read() noexcept {
         ++_stats.partition_reads;
     }
@@ -557,6 +557,9 @@ enum class scylla_metadata_type : uint32_t {
     Schema = 11,
     ComponentsDigests = 12,
     LargeDataRecords = 13,
+    TombstoneDensity = 14,
+    TimestampIndex = 15,
+    RepairHashSummary = 16,
 };
 
 // UUID is used for uniqueness across nodes, such that an imported sstable
@@ -634,6 +637,85 @@ struct large_data_record {
     }
 };
 
+// Statistics about the tombstones of a contiguous range of the sstable's
+// partitions, in token order. The sstable writer splits the partitions into
+// at most tombstone_density_tracker::max_segments such ranges, so compaction
+// strategies can find token ranges with a high density of tombstones even
+// when the sstable as a whole has few of them.
+//
+// Tombstones include expiring cells, which become tombstones once they expire.
+struct tombstone_density_segment {
+    int64_t first_token;              // token of the first partition of the segment
+    int64_t last_token;               // token of the last partition of the segment
+    uint64_t partitions;              // number of partitions in the segment
+    uint64_t cells;                   // number of cells in the segment
+    uint64_t tombstones;              // number of tombstones in the segment
+    int32_t max_local_deletion_time;  // local deletion time of the last tombstone to expire
+
+    template <typename Describer>
+    auto describe_type(sstable_version_types v, Describer f) {
+        return f(first_token, last_token, partitions, cells, tombstones, max_local_deletion_time);
+    }
+};
+
+// The minimum live timestamps of a contiguous range of the sstable's
+// partitions, in token order. The sstable writer splits the partitions into
+// at most timestamp_index_tracker::max_segments such ranges, so the minimum
+// timestamp of the data an sstable may hold for a given key is known more
+// precisely than by the sstable-wide ext_timestamp_stats. Used to decide
+// whether tombstones shadowing the key in other sstables can be purged.
+//
+// Keys with a token between the last_token of a segment and the first_token
+// of the next one are not in the sstable.
+struct timestamp_index_segment {
+    int64_t first_token;                    // token of the first partition of the segment
+    int64_t last_token;                     // token of the last partition of the segment
+    int64_t min_live_timestamp;             // see ext_timestamp_stats_type::min_live_timestamp
+    int64_t min_live_row_marker_timestamp;  // see ext_timestamp_stats_type::min_live_row_marker_timestamp
+
+    template <typename Describer>
+    auto describe_type(sstable_version_types v, Describer f) {
+        return f(first_token, last_token, min_live_timestamp, min_live_row_marker_timestamp);
+    }
+};
+
+// The hashes of the mutation fragments of the sstable's partitions whose
+// tokens fall into one bucket of the token ring, see repair_hash_summary_type.
+struct repair_hash_summary_bucket {
+    uint64_t bucket;     // the bucket, as in dht::compaction_group_of(level, token)
+    uint64_t hash;       // sum of the hashes of the fragments
+    uint64_t fragments;  // number of fragments
+
+    template <typename Describer>
+    auto describe_type(sstable_version_types v, Describer f) {
+        return f(bucket, hash, fragments);
+    }
+};
+
+// Hashes of the content of the sstable, per bucket of the token ring, which
+// repair uses to find token ranges with identical data on all replicas
+// without reading it. The ring is split into 2^level equal buckets, like the
+// compaction groups of a table with 2^level tablets. The sstable writer picks
+// the deepest level at which the sstable's partitions fall into at most
+// repair_hash_summary_tracker::max_buckets buckets.
+//
+// The hash of a bucket is the sum of the hashes of its fragments, so it does
+// not depend on how the data is split into sstables: the sums of the buckets
+// of several sstables describe the data they hold together.
+struct repair_hash_summary_type {
+    uint32_t level;
+    // Digest of the columns of the schema the fragments were hashed with.
+    // The hashes depend on the ids of the columns, so they are only comparable
+    // under the same columns.
+    uint64_t columns_digest;
+    disk_array<uint32_t, repair_hash_summary_bucket> buckets;
+
+    template <typename Describer>
+    auto describe_type(sstable_version_types v, Describer f) {
+        return f(level, columns_digest, buckets);
+    }
+};
+
 // Types of extended timestamp statistics.
 //
 // Note: For extensibility, never reuse an identifier,
@@ -686,6 +768,9 @@ struct scylla_metadata {
     using sstable_identifier = sstable_identifier_type;
     using sstable_schema = sstable_schema_type;
     using components_digests = disk_hash<uint32_t, component_type, uint32_t>;
+    using tombstone_density = disk_array<uint32_t, tombstone_density_segment>;
+    using timestamp_index = disk_array<uint32_t, timestamp_index_segment>;
+    using repair_hash_summary = repair_hash_summary_type;
 
     disk_set_of_tagged_union<scylla_metadata_type,
             disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::Sharding, sharding_metadata>,
@@ -700,7 +785,10 @@ struct scylla_metadata {
             disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::SSTableIdentifier, sstable_identifier>,
             disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::Schema, sstable_schema>,
             disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::ComponentsDigests, components_digests>,
-            disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::LargeDataRecords, large_data_records>
+            disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::LargeDataRecords, large_data_records>,
+            disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::TombstoneDensity, tombstone_density>,
+            disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::TimestampIndex, timestamp_index>,
+            disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::RepairHashSummary, repair_hash_summary>
             > data;
     std::optional<uint32_t> digest;
 
@@ -750,6 +838,22 @@ struct scylla_metadata {
     const components_digests* get_components_digests() const {
         return data.get<scylla_metadata_type::ComponentsDigests, components_digests>();
     }
+    // Absent on sstables without tombstones, and on sstables written before
+    // TombstoneDensity was introduced.
+    const tombstone_density* get_tombstone_density() const {
+        return data.get<scylla_metadata_type::TombstoneDensity, tombstone_density>();
+    }
+    // Absent on empty sstables, and on sstables written before TimestampIndex
+    // was introduced.
+    const timestamp_index* get_timestamp_index() const {
+        return data.get<scylla_metadata_type::TimestampIndex, timestamp_index>();
+    }
+    // Absent unless the sstable was written with repair hash summaries
+    // enabled, and on sstables with partitions copied from other sstables
+    // without being decoded.
+    const repair_hash_summary* get_repair_hash_summary() const {
+        return data.get<scylla_metadata_type::RepairHashSummary, repair_hash_summary>();
+    }
 };
 
 static constexpr int DEFAULT_CHUNK_SIZE = 65536;
@@ -73,6 +73,14 @@ void sstable_writer::consume_end_of_stream() {
     return _impl->consume_end_of_stream();
 }
 
+void sstable_writer::consume_raw_partition(const sstable& src, const dht::decorated_key& dk, temporary_buffer<char> data) {
+    _impl->_validator(dk);
+    _impl->_validator(mutation_fragment_v2::kind::partition_start, position_in_partition_view::for_partition_start(), {});
+    _impl->_validator.on_end_of_partition();
+    _impl->_sst.get_stats().on_partition_write();
+    _impl->consume_raw_partition(src, dk, std::move(data));
+}
+
 void sstable_writer::set_repaired_at(int64_t repaired_at) {
     _impl->set_repaired_at(repaired_at);
 }
@@ -48,6 +48,7 @@ struct sstable_writer::writer_impl {
     virtual stop_iteration consume(range_tombstone_change&& rtc) = 0;
     virtual stop_iteration consume_end_of_partition() = 0;
     virtual void consume_end_of_stream() = 0;
+    virtual void consume_raw_partition(const sstable& src, const dht::decorated_key& dk, temporary_buffer<char> data) = 0;
     virtual ~writer_impl() {}
     void set_repaired_at(uint64_t repaired_at) {
         _collector.set_repaired_at(repaired_at);
@@ -17,6 +17,7 @@
 #include "replica/database.hh"
 #include "sstables/sstables.hh"
 #include "sstables/sstables_manager.hh"
+#include "sstables/sstable_slicer.hh"
 #include "sstables/storage.hh"
 #include "sstables/open_info.hh"
 #include "sstables/sstable_version.hh"
@@ -90,6 +91,52 @@ static future<> load_sstable_for_tablet(const file_stream_id& ops_id, replica::d
     });
 }
 
+// Returns true if the sstable also has partitions outside of `range`, and
+// can be trimmed to it by trim_sstable_to_range().
+static bool needs_trimming(replica::table& table, const sstables::sstable& sst, const dht::token_range& range) {
+    const auto cmp = dht::token_comparator();
+    if (range.contains(sst.get_first_decorated_key().token(), cmp) && range.contains(sst.get_last_decorated_key().token(), cmp)) {
+        return false;
+    }
+    auto cfg = table.get_sstables_manager().configure_writer(sst.get_origin());
+    return sstables::can_slice_sstable(sst, cfg, sst.get_version());
+}
+
+// Replaces the sstable of `snapshot` by a copy of its partitions in `range`,
+// so that only the data of the range is streamed. The partitions are copied
+// without being decoded, see sstables::slice_sstable().
+// The copy is left unsealed, so it is removed on startup if the node crashes
+// before it was streamed, and it is deleted once it was streamed.
+// Slicing is aborted if the topology guard of the streaming is invalidated.
+// Returns false if the sstable has no partitions in the range.
+static future<bool> trim_sstable_to_range(const file_stream_id& ops_id, replica::table& table, service::topology_guard& guard,
+        sstables::sstable_files_snapshot& snapshot, const dht::token_range& range, reader_permit permit) {
+    const auto sst = snapshot.sst;
+    const auto cmp = dht::token_comparator();
+    auto cfg = table.get_sstables_manager().configure_writer(sst->get_origin());
+    cfg.leave_unsealed = true;
+    abort_source as;
+    auto slices = co_await sstables::slice_sstable(sst, std::move(permit),
+            [&range, &guard, cmp] (dht::token t) {
+                guard.check();
+                return range.contains(t, cmp) ? std::make_optional<size_t>(0) : std::nullopt;
+            },
+            [&table, state = sst->state(), version = sst->get_version()] { return table.make_sstable(state, version); },
+            cfg, as);
+    blogger.debug("fstream[{}] Trimmed sstable {} to range={}: copied {} partitions, rewrote {} and dropped {}", ops_id, sst->get_filename(), range,
+            slices.stats.copied_partitions, slices.stats.rewritten_partitions, slices.stats.dropped_partitions);
+    if (slices.sstables.empty()) {
+        co_return false;
+    }
+    auto trimmed = std::move(slices.sstables.front());
+    trimmed->mark_for_deletion();
+    snapshot = sstables::sstable_files_snapshot{
+        .sst = trimmed,
+        .files = co_await trimmed->readable_file_for_all_components(true),
+    };
+    co_return true;
+}
+
 static utils::pretty_printed_throughput get_bw(size_t total_size, std::chrono::steady_clock::time_point start_time) {
     auto duration = std::chrono::steady_clock::now() - start_time;
     return utils::pretty_printed_throughput(total_size, duration);
@@ -763,6 +810,17 @@ future<stream_files_response> tablet_stream_files_handler(replica::database& db,
     auto table_stream_op = table.stream_in_progress();
     auto files = std::list<stream_blob_info>();
     size_t sstable_nr = 0;
+    size_t files_nr = 0;
+    auto ops_start_time = std::chrono::steady_clock::now();
+
+    // Sends the files gathered so far.
+    auto stream_files = [&] () -> future<> {
+        if (files.empty()) {
+            co_return;
+        }
+        files_nr += files.size();
+        resp.stream_bytes += co_await tablet_stream_files(ms, std::exchange(files, {}), req.targets, req.table, req.ops_id, req.topo_guard);
+    };
 
     auto reader = co_await db.obtain_reader_permit(table, "tablet_file_streaming", db::no_timeout, {});
     bool is_logstor_table = table.uses_logstor();
@@ -794,6 +852,8 @@ future<stream_files_response> tablet_stream_files_handler(replica::database& db,
         }
 
         auto& sst_gen = table.get_sstable_generation_generator();
+        const bool trim_sstables = db.get_config().file_stream_trim_sstables();
+        auto guard = service::topology_guard(req.topo_guard);
 
         for (auto& sst_snapshot : sstables) {
             auto& sst = sst_snapshot.sst;
@@ -836,6 +896,22 @@ future<stream_files_response> tablet_stream_files_handler(replica::database& db,
                 }
             } else {
                 // Byte-streaming path for local-filesystem SSTables.
+                if (trim_sstables && needs_trimming(table, *sst, req.range)) {
+                    // The sstable is trimmed while the files gathered so far are
+                    // streamed, so that at most two trimmed copies exist at a time:
+                    // the one being streamed and the one being made.
+                    bool has_partitions_in_range = true;
+                    co_await coroutine::all(
+                        [&] () -> future<> {
+                            has_partitions_in_range = co_await trim_sstable_to_range(req.ops_id, table, guard, sst_snapshot, req.range, reader);
+                        },
+                        stream_files);
+                    if (!has_partitions_in_range) {
+                        sst_snapshot = {};
+                        continue;
+                    }
+                }
+                sst_id = sst->sstable_identifier();
                 auto sources = co_await create_stream_sources(sst_snapshot, reader);
                 auto newgen = fmt::to_string(sst_gen());
 
@@ -857,6 +933,9 @@ future<stream_files_response> tablet_stream_files_handler(replica::database& db,
                 if (!files.empty()) {
                     files.back().fops = file_ops::load_sstables;
                 }
+                // The files hold the sstable from now on, so that a trimmed copy
+                // is deleted as soon as it was streamed.
+                sst_snapshot = {};
             }
         }
         sstable_nr = sstables.size();
@@ -871,21 +950,18 @@ future<stream_files_response> tablet_stream_files_handler(replica::database& db,
         blogger.debug("stream_sstables[{}] Started sending sstable_nr={} files_nr={} files={} range={}",
                 req.ops_id, sstable_nr, files.size(), files, req.range);
     }
-    if (files.empty()) {
+    co_await stream_files();
+    if (!files_nr) {
         if (sstable_nr > 0) {
             blogger.info("stream_sstables[{}] Finished cloning sstable_nr={} range={} (object-storage clone path, zero wire bytes)",
                     req.ops_id, sstable_nr, req.range);
         }
         co_return resp;
     }
-    auto ops_start_time = std::chrono::steady_clock::now();
-    auto files_nr = files.size();
-    size_t stream_bytes = co_await tablet_stream_files(ms, std::move(files), req.targets, req.table, req.ops_id, req.topo_guard);
-    resp.stream_bytes = stream_bytes;
     auto duration = std::chrono::steady_clock::now() - ops_start_time;
     blogger.info("stream_{}[{}] Finished sending files_nr={} range={} stream_bytes={} stream_time={} stream_bw={}",
             is_logstor_table ? "logstor_segments" : "sstables",
-            req.ops_id, files_nr, req.range, stream_bytes, duration, get_bw(stream_bytes, ops_start_time));
+            req.ops_id, files_nr, req.range, resp.stream_bytes, duration, get_bw(resp.stream_bytes, ops_start_time));
 
     co_return resp;
 }
@@ -216,7 +216,20 @@ void stream_manager::init_messaging_service_handler(abort_source& as) {
             auto op = table.stream_in_progress();
             auto sharder_ptr = std::make_unique<dht::auto_refreshing_sharder>(table.shared_from_this());
             auto& sharder = *sharder_ptr;
-            auto result_handling_cont = [this, s, plan_id, from, sink, estimated_partitions, log_done, cf_id, sh_ptr = std::move(sharder_ptr)] (future<uint64_t> f) mutable -> future<> {
+            // The buffers of all shards live on this shard. Their memory is
+            // taken from the streaming read semaphore, if it is available there,
+            // otherwise the stream gets the default buffer size.
+            auto shard_buffer_size = size_t(_db.local().get_config().stream_receive_shard_buffer_size_in_kb()) * 1024;
+            auto& streaming_semaphore = table.streaming_read_concurrency_semaphore();
+            const auto buffer_memory = shard_buffer_size * smp::count;
+            const bool buffer_memory_available = streaming_semaphore.available_resources().memory >= ssize_t(buffer_memory);
+            if (!buffer_memory_available) {
+                shard_buffer_size = mutation_reader::default_max_buffer_size_in_bytes();
+            }
+            auto buffer_units = streaming_semaphore.make_tracking_only_permit(s, "stream-receive-buffers", db::no_timeout, {})
+                    .consume_memory(buffer_memory_available ? buffer_memory : 0);
+            auto result_handling_cont = [this, s, plan_id, from, sink, estimated_partitions, log_done, cf_id, sh_ptr = std::move(sharder_ptr),
+                    buffer_units = std::move(buffer_units)] (future<uint64_t> f) mutable -> future<> {
                 auto& db = _db;
                 auto& mm = _mm;
                 int32_t status = 0;
@@ -267,7 +280,8 @@ void stream_manager::init_messaging_service_handler(abort_source& as) {
                 return mutation_writer::distribute_reader_and_consume_on_shards(s, sharder,
                     make_generating_reader_v1(s, permit, std::move(get_next_mutation_fragment)),
                     make_streaming_consumer(estimated_partitions, reason, topo_guard),
-                    std::move(op)
+                    std::move(op),
+                    shard_buffer_size
                 ).then_wrapped(std::ref(result_handling)).handle_exception([s, plan_id, from, sink] (std::exception_ptr ep) mutable -> future<> {
                     auto level = seastar::log_level::error;
                     if (try_catch<seastar::rpc::closed_error>(ep)) {
@@ -33,6 +33,7 @@
 #include "streaming/table_check.hh"
 #include "gms/feature_service.hh"
 #include "utils/error_injection.hh"
+#include "db/config.hh"
 #include "idl/streaming.dist.hh"
 #include <seastar/coroutine/maybe_yield.hh>
 
@@ -202,6 +203,24 @@ future<> send_mutation_fragments(lw_shared_ptr<send_info> si) {
  });
 }
 
+std::vector<dht::token_range_vector> split_ranges_into_streams(dht::token_range_vector ranges, unsigned n) {
+    std::vector<dht::token_range_vector> groups;
+    n = std::min<size_t>(n, ranges.size());
+    if (n <= 1) {
+        groups.push_back(std::move(ranges));
+        return groups;
+    }
+    groups.reserve(n);
+    auto it = std::make_move_iterator(ranges.begin());
+    for (unsigned i = 0; i < n; ++i) {
+        // Spread the remainder over the first groups.
+        auto count = ranges.size() / n + (i < ranges.size() % n);
+        groups.emplace_back(it, it + count);
+        it += count;
+    }
+    return groups;
+}
+
 future<> stream_transfer_task::execute() {
     auto plan_id = session->plan_id();
     auto cf_id = this->cf_id;
@@ -215,20 +234,26 @@ future<> stream_transfer_task::execute() {
         auto topo_guard = session->topo_guard();
         return sm.container().invoke_on_all([plan_id, cf_id, id, dst_cpu_id, ranges=this->_ranges, reason, topo_guard] (stream_manager& sm) mutable {
             auto tbl = sm.db().find_column_family(cf_id).shared_from_this();
-            return sm.db().obtain_reader_permit(*tbl, "stream-transfer-task", db::no_timeout, {}).then([&sm, tbl, plan_id, cf_id, id, dst_cpu_id, ranges=std::move(ranges), reason, topo_guard] (reader_permit permit) mutable {
-                auto si = make_lw_shared<send_info>(sm.ms(), plan_id, tbl, std::move(permit), std::move(ranges), id, dst_cpu_id, reason, topo_guard, [&sm, plan_id, id] (size_t sz) {
-                    sm.update_progress(plan_id, id, streaming::progress_info::direction::OUT, sz);
-                });
-                return si->has_relevant_range_on_this_shard().then([si, plan_id, cf_id] (bool has_relevant_range_on_this_shard) {
-                    if (!has_relevant_range_on_this_shard) {
-                        sslog.debug("[Stream #{}] stream_transfer_task: cf_id={}: ignore ranges on shard={}",
-                                plan_id, cf_id, this_shard_id());
-                        return make_ready_future<>();
-                    }
-                    return send_mutation_fragments(std::move(si));
-                }).finally([si] {
-                    return si->reader.close();
+            auto concurrency = std::max(sm.db().get_config().stream_transfer_concurrency_per_peer(), uint32_t(1));
+            auto groups = split_ranges_into_streams(std::move(ranges), concurrency);
+            return do_with(std::move(groups), [&sm, tbl, plan_id, cf_id, id, dst_cpu_id, reason, topo_guard] (std::vector<dht::token_range_vector>& groups) {
+              return parallel_for_each(groups, [&sm, tbl, plan_id, cf_id, id, dst_cpu_id, reason, topo_guard] (dht::token_range_vector& ranges) {
+                return sm.db().obtain_reader_permit(*tbl, "stream-transfer-task", db::no_timeout, {}).then([&sm, tbl, plan_id, cf_id, id, dst_cpu_id, ranges=std::move(ranges), reason, topo_guard] (reader_permit permit) mutable {
+                    auto si = make_lw_shared<send_info>(sm.ms(), plan_id, tbl, std::move(permit), std::move(ranges), id, dst_cpu_id, reason, topo_guard, [&sm, plan_id, id] (size_t sz) {
+                        sm.update_progress(plan_id, id, streaming::progress_info::direction::OUT, sz);
+                    });
+                    return si->has_relevant_range_on_this_shard().then([si, plan_id, cf_id] (bool has_relevant_range_on_this_shard) {
+                        if (!has_relevant_range_on_this_shard) {
+                            sslog.debug("[Stream #{}] stream_transfer_task: cf_id={}: ignore ranges on shard={}",
+                                    plan_id, cf_id, this_shard_id());
+                            return make_ready_future<>();
+                        }
+                        return send_mutation_fragments(std::move(si));
+                    }).finally([si] {
+                        return si->reader.close();
+                    });
                 });
+              });
             });
         }).then([this, plan_id, cf_id, id, &sm] {
             sslog.debug("[Stream #{}] SEND STREAM_MUTATION_DONE to {}, cf_id={}", plan_id, id, cf_id);
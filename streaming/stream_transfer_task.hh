@@ -51,4 +51,9 @@ class stream_transfer_task : public stream_task {
     void sort_and_merge_ranges();
 };
 
+// Splits the sorted and merged ranges into at most n groups of contiguous
+// ranges of about the same count. Every group is sent over its own stream, so
+// the peer writes the groups in parallel.
+std::vector<dht::token_range_vector> split_ranges_into_streams(dht::token_range_vector ranges, unsigned n);
+
 } // namespace streaming
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#define BOOST_TEST_MODULE core
+
+#include <algorithm>
+#include <numeric>
+#include <ranges>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include "utils/cow_chunked_vector.hh"
+
+using cow_vector = utils::cow_chunked_vector<int, 4 * sizeof(int)>;
+
+static_assert(cow_vector::max_chunk_capacity() == 4);
+static_assert(std::random_access_iterator<cow_vector::const_iterator>);
+
+BOOST_AUTO_TEST_CASE(test_push_back_and_resize) {
+    cow_vector v;
+    BOOST_REQUIRE(v.empty());
+    for (int i = 0; i < 10; ++i) {
+        v.push_back(i);
+    }
+    BOOST_REQUIRE_EQUAL(v.size(), 10);
+    v.resize(13);
+    BOOST_REQUIRE_EQUAL(v.size(), 13);
+    for (int i = 0; i < 10; ++i) {
+        BOOST_REQUIRE_EQUAL(v[i], i);
+    }
+    for (int i = 10; i < 13; ++i) {
+        BOOST_REQUIRE_EQUAL(v[i], 0);
+    }
+    BOOST_REQUIRE_EQUAL(v.front(), 0);
+    BOOST_REQUIRE_EQUAL(v.back(), 0);
+    BOOST_REQUIRE_THROW(v.resize(1), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_iterators) {
+    cow_vector v;
+    for (int i = 0; i < 11; ++i) {
+        v.push_back(i);
+    }
+    BOOST_REQUIRE_EQUAL(std::accumulate(v.begin(), v.end(), 0), 55);
+    BOOST_REQUIRE_EQUAL(v.end() - v.begin(), 11);
+    BOOST_REQUIRE(std::ranges::is_sorted(v));
+    BOOST_REQUIRE_EQUAL(*std::ranges::lower_bound(v, 7), 7);
+    BOOST_REQUIRE_EQUAL(v.begin()[5], 5);
+
+    std::vector<int> reversed(v.begin(), v.end());
+    std::ranges::reverse(reversed);
+    BOOST_REQUIRE(std::ranges::equal(std::views::reverse(v), reversed));
+}
+
+BOOST_AUTO_TEST_CASE(test_copy_on_write) {
+    cow_vector v;
+    for (int i = 0; i < 10; ++i) {
+        v.push_back(i);
+    }
+
+    auto copy = v;
+    BOOST_REQUIRE(copy == v);
+    BOOST_REQUIRE_EQUAL(copy.shared_chunks(v), 3);
+
+    // Modifying an item copies only the chunk which holds it.
+    copy.mutable_at(5) = 50;
+    BOOST_REQUIRE_EQUAL(copy[5], 50);
+    BOOST_REQUIRE_EQUAL(v[5], 5);
+    BOOST_REQUIRE_EQUAL(copy.shared_chunks(v), 2);
+    BOOST_REQUIRE(copy != v);
+
+    // The chunk is not shared anymore, so it isn't copied again.
+    auto* item = &copy[5];
+    copy.mutable_at(4) = 40;
+    BOOST_REQUIRE_EQUAL(item, &copy[5]);
+    BOOST_REQUIRE_EQUAL(v[4], 4);
+
+    // Appending to a shared last chunk copies it too.
+    copy.push_back(10);
+    BOOST_REQUIRE_EQUAL(copy.size(), 11);
+    BOOST_REQUIRE_EQUAL(v.size(), 10);
+    BOOST_REQUIRE_EQUAL(copy.shared_chunks(v), 1);
+    for (int i = 0; i < 10; ++i) {
+        BOOST_REQUIRE_EQUAL(v[i], i);
+    }
+
+    // Equal contents compare equal, even if the chunks are not shared.
+    copy.mutable_at(4) = 4;
+    copy.mutable_at(5) = 5;
+    cow_vector v2;
+    for (int i = 0; i < 11; ++i) {
+        v2.push_back(i);
+    }
+    BOOST_REQUIRE(copy == v2);
+    BOOST_REQUIRE_EQUAL(copy.shared_chunks(v2), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_random_modifications_of_copies) {
+    auto rand = std::default_random_engine();
+    std::vector<std::vector<int>> expected;
+    std::vector<cow_vector> copies;
+
+    cow_vector v;
+    std::vector<int> e;
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(i);
+        e.push_back(i);
+    }
+    expected.push_back(e);
+    copies.push_back(v);
+
+    for (int i = 0; i < 1000; ++i) {
+        auto src = std::uniform_int_distribution<size_t>(0, copies.size() - 1)(rand);
+        auto copy = copies[src];
+        auto e = expected[src];
+        auto idx = std::uniform_int_distribution<size_t>(0, e.size() - 1)(rand);
+        copy.mutable_at(idx) = i;
+        e[idx] = i;
+        copies.push_back(std::move(copy));
+        expected.push_back(std::move(e));
+    }
+
+    for (size_t i = 0; i < copies.size(); ++i) {
+        BOOST_REQUIRE(std::ranges::equal(copies[i], expected[i]));
+    }
+}
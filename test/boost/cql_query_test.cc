@@ -3862,6 +3862,61 @@ SEASTAR_TEST_CASE(test_cache_bypass) {
     });
 }
 
+SEASTAR_TEST_CASE(test_query_result_cache) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        e.execute_cql("CREATE TABLE t (pk int, ck int, v int, PRIMARY KEY (pk, ck)) WITH caching = {'keys': 'ALL', 'rows_per_partition': 'ALL', 'query_results': 'true'}").get();
+        auto& table = e.local_db().find_column_family("ks", "t");
+        auto s = table.schema();
+
+        // The cache is only used for partitions owned by this shard.
+        int32_t pk = 0;
+        while (table.shard_for_reads(dht::get_token(*s, partition_key::from_singular(*s, pk))) != this_shard_id()) {
+            ++pk;
+        }
+        e.execute_cql(format("INSERT INTO t (pk, ck, v) VALUES ({}, 0, 0)", pk)).get();
+
+        auto id = e.prepare("SELECT ck, v FROM t WHERE pk = ?").get();
+        auto select = [&] {
+            return e.execute_prepared(id, {cql3::raw_value::make_value(int32_type->decompose(pk))}).get();
+        };
+        auto& stats = e.local_db().get_query_result_cache().get_stats();
+
+        assert_that(select()).is_rows().with_rows({{int32_type->decompose(0), int32_type->decompose(0)}});
+        BOOST_REQUIRE_EQUAL(stats.inserts, 1);
+        const auto hits = stats.hits;
+        assert_that(select()).is_rows().with_rows({{int32_type->decompose(0), int32_type->decompose(0)}});
+        BOOST_REQUIRE_EQUAL(stats.hits, hits + 1);
+
+        // A write to the partition invalidates the cached result.
+        e.execute_cql(format("UPDATE t SET v = 1 WHERE pk = {} AND ck = 0", pk)).get();
+        BOOST_REQUIRE_EQUAL(stats.population, 0);
+        assert_that(select()).is_rows().with_rows({{int32_type->decompose(0), int32_type->decompose(1)}});
+        BOOST_REQUIRE_EQUAL(stats.hits, hits + 1);
+
+        // So does truncating the table.
+        e.execute_cql("TRUNCATE t").get();
+        BOOST_REQUIRE_EQUAL(stats.population, 0);
+        assert_that(select()).is_rows().is_empty();
+
+        // Reads not at CL=ONE/LOCAL_ONE bypass the cache.
+        const auto lookups = stats.lookups;
+        e.execute_prepared(id, {cql3::raw_value::make_value(int32_type->decompose(pk))}, db::consistency_level::QUORUM).get();
+        BOOST_REQUIRE_EQUAL(stats.lookups, lookups);
+    });
+}
+
+SEASTAR_TEST_CASE(test_query_result_cache_requires_feature) {
+    cql_test_config cfg;
+    cfg.disabled_features.insert("QUERY_RESULT_CACHE");
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        BOOST_REQUIRE_THROW(e.execute_cql("CREATE TABLE t (pk int PRIMARY KEY, v int) WITH caching = {'query_results': 'true'}").get(),
+                exceptions::configuration_exception);
+        e.execute_cql("CREATE TABLE t (pk int PRIMARY KEY, v int) WITH caching = {'keys': 'ALL', 'rows_per_partition': 'ALL'}").get();
+        BOOST_REQUIRE_THROW(e.execute_cql("ALTER TABLE t WITH caching = {'query_results': 'true'}").get(),
+                exceptions::configuration_exception);
+    }, std::move(cfg));
+}
+
 SEASTAR_TEST_CASE(test_describe_varchar) {
    // Test that, like cassandra, a varchar column is represented as a text column.
    return do_with_cql_env_thread([] (cql_test_env& e) {
@@ -9,12 +9,14 @@
 #include "test/lib/cql_test_env.hh"
 #include "test/lib/cql_assertions.hh"
 #include "streaming/stream_blob.hh"
+#include "streaming/stream_transfer_task.hh"
 #include "message/messaging_service.hh"
 #include "test/lib/log.hh"
 #include "test/lib/sstable_utils.hh"
 #include "sstables/exceptions.hh"
 #include "sstables/open_info.hh"
 #include "sstables/sstables.hh"
+#include "readers/mutation_reader.hh"
 #include "utils/overloaded_functor.hh"
 #include "schema/schema_builder.hh"
 #include "test/lib/random_utils.hh"
@@ -27,6 +29,8 @@
 #include <seastar/testing/test_fixture.hh>
 #include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/short_streams.hh>
+#include <seastar/util/closeable.hh>
+#include <seastar/util/defer.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/core/future.hh>
@@ -766,6 +770,104 @@ SEASTAR_FIXTURE_TEST_CASE(test_clone_path_stream_uncompressed_gcs, gcs_fixture,
 
 // tests that a ranged_source counts any skipped data into
 // remaining "len" (available data)
+// Streams the first half of the token range of a tablet, so that the sender
+// trims the sstable of the tablet, which also has partitions in the second
+// half, to the streamed range before sending it.
+SEASTAR_THREAD_TEST_CASE(test_tablet_stream_trimmed_sstable) {
+    cql_test_config cfg;
+    cfg.ms_listen = true;
+    cfg.initial_tablets = 1;
+    do_with_cql_env_thread([] (cql_test_env& env) {
+        auto& global_db = env.local_db().container();
+        auto& global_ms = env.get_messaging_service();
+        auto& global_vbw = env.view_building_worker();
+        smp::invoke_on_all([&] {
+            return global_ms.local().register_stream_blob([&] (const rpc::client_info& cinfo, streaming::stream_blob_meta meta, rpc::source<streaming::stream_blob_cmd_data> source) {
+                const auto& from = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
+                auto sink = global_ms.local().make_sink_for_stream_blob(source);
+                (void)stream_blob_handler(global_db.local(), global_vbw.local(), global_ms.local(), from, meta, sink, source).handle_exception([] (std::exception_ptr eptr) {
+                    testlog.warn("Failed to run stream blob handler: {}", eptr);
+                });
+                return make_ready_future<rpc::sink<streaming::stream_blob_cmd_data>>(sink);
+            });
+        }).get();
+        auto unregister = defer([&] () noexcept {
+            smp::invoke_on_all([&] { return global_ms.local().unregister_stream_blob(); }).get();
+        });
+
+        env.execute_cql("CREATE KEYSPACE ks_trim WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 1} AND tablets = {'initial': 1};").get();
+        env.execute_cql("CREATE TABLE ks_trim.cf (pk int PRIMARY KEY, v int);").get();
+        const size_t nr_keys = 100;
+        for (size_t i = 0; i < nr_keys; i++) {
+            env.execute_cql(format("INSERT INTO ks_trim.cf (pk, v) VALUES ({}, {});", i, i)).get();
+        }
+        const auto range = dht::token_range::make_ending_with({dht::token::from_int64(0), true});
+
+        global_db.invoke_on_all([&] (replica::database& db) {
+            return seastar::async([&] {
+                auto& table = db.find_column_family("ks_trim", "cf");
+                table.flush().get();
+                auto old_sstables = table.get_sstables();
+                if (old_sstables->empty()) {
+                    // The tablet is on another shard.
+                    return;
+                }
+                BOOST_REQUIRE_EQUAL(old_sstables->size(), 1);
+                auto schema = table.schema();
+                auto sst = *old_sstables->begin();
+                sst->update_repaired_at(42);
+
+                std::set<int32_t> expected_keys;
+                for (size_t i = 0; i < nr_keys; i++) {
+                    auto dk = dht::decorate_key(*schema, partition_key::from_singular(*schema, int32_t(i)));
+                    if (range.contains(dk.token(), dht::token_comparator())) {
+                        expected_keys.insert(i);
+                    }
+                }
+                BOOST_REQUIRE(!expected_keys.empty());
+                BOOST_REQUIRE_LT(expected_keys.size(), nr_keys);
+
+                streaming::stream_files_request req;
+                req.ops_id = streaming::file_stream_id::create_random_id();
+                req.keyspace_name = schema->ks_name();
+                req.table_name = schema->cf_name();
+                req.table = schema->id();
+                req.range = range;
+                req.targets = {streaming::node_and_shard{db.get_token_metadata().get_my_id(), this_shard_id()}};
+                req.topo_guard = service::null_topology_guard;
+
+                streaming::mark_tablet_stream_start(req.ops_id).get();
+                auto resp = streaming::tablet_stream_files_handler(db, global_vbw.local(), global_ms.local(), req).get();
+                streaming::mark_tablet_stream_done(req.ops_id).get();
+                BOOST_REQUIRE_GT(resp.stream_bytes, 0);
+
+                std::vector<sstables::shared_sstable> received;
+                for (const auto& s : *table.get_sstables()) {
+                    if (!old_sstables->contains(s)) {
+                        received.push_back(s);
+                    }
+                }
+                BOOST_REQUIRE_EQUAL(received.size(), 1);
+                auto trimmed = received.front();
+                BOOST_REQUIRE_LT(trimmed->data_size(), sst->data_size());
+                BOOST_REQUIRE_EQUAL(trimmed->get_stats_metadata().repaired_at, 42);
+
+                auto permit = db.obtain_reader_permit(table, "test_tablet_stream_trimmed_sstable", db::no_timeout, {}).get();
+                auto reader = trimmed->make_reader(schema, permit, query::full_partition_range, schema->full_slice());
+                auto close_reader = deferred_close(reader);
+                std::set<int32_t> keys;
+                while (auto m = read_mutation_from_mutation_reader(reader).get()) {
+                    keys.insert(value_cast<int32_t>(int32_type->deserialize(m->key().explode().front())));
+                }
+                BOOST_REQUIRE(keys == expected_keys);
+            });
+        }).get();
+
+        auto result = env.execute_cql("SELECT COUNT(*) FROM ks_trim.cf;").get();
+        assert_that(result).is_rows().with_size(1).with_row({{long_type->decompose(int64_t(nr_keys))}});
+    }, cfg).get();
+}
+
 SEASTAR_TEST_CASE(test_ranged_data_source_skip) {
 
     constexpr size_t n_bufs = 30;
@@ -796,3 +898,27 @@ SEASTAR_TEST_CASE(test_ranged_data_source_skip) {
     BOOST_REQUIRE_LT(buf.size(), len);
     BOOST_REQUIRE_EQUAL(buf.size(), len - off);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_split_ranges_into_streams) {
+    dht::token_range_vector ranges;
+    for (int64_t i = 0; i < 10; ++i) {
+        ranges.push_back(dht::token_range::make(dht::token(i * 10), dht::token(i * 10 + 5)));
+    }
+    auto split = [&] (unsigned n) {
+        auto groups = streaming::split_ranges_into_streams(ranges, n);
+        // The groups are contiguous and keep the order of the ranges.
+        BOOST_REQUIRE(std::ranges::equal(groups | std::views::join, ranges));
+        return groups | std::views::transform(std::ranges::size) | std::ranges::to<std::vector<size_t>>();
+    };
+
+    BOOST_REQUIRE(split(0) == std::vector<size_t>({10}));
+    BOOST_REQUIRE(split(1) == std::vector<size_t>({10}));
+    BOOST_REQUIRE(split(2) == std::vector<size_t>({5, 5}));
+    // The remainder is spread over the first groups.
+    BOOST_REQUIRE(split(3) == std::vector<size_t>({4, 3, 3}));
+    BOOST_REQUIRE(split(4) == std::vector<size_t>({3, 3, 2, 2}));
+    // There are never more groups than ranges.
+    BOOST_REQUIRE(split(20) == std::vector<size_t>(10, 1));
+
+    BOOST_REQUIRE_EQUAL(streaming::split_ranges_into_streams({}, 2).size(), 1);
+}
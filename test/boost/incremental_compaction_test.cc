@@ -61,6 +61,9 @@ class strategy_control_for_test : public compaction::strategy_control {
         auto main_set = co_await t.main_sstable_set();
         co_return main_set->all_sstable_runs();
     }
+    virtual std::optional<dht::token_range> take_hot_read_range(compaction::compaction_group_view& t) const override {
+        return std::nullopt;
+    }
 };
 
 static std::unique_ptr<compaction::strategy_control> make_strategy_control_for_test(bool has_ongoing_compaction) {
@@ -15,6 +15,7 @@
 #include "serializer_impl.hh"
 #include "query/query-result-set.hh"
 #include "mutation_query.hh"
+#include "sstables/stats.hh"
 #include "test/lib/cql_test_env.hh"
 #include "test/lib/eventually.hh"
 #include "test/lib/mutation_assertions.hh"
@@ -780,6 +781,57 @@ SEASTAR_THREAD_TEST_CASE(test_evict_a_shard_reader_on_each_page) {
     }, cql_config_with_extensions()).get();
 }
 
+static uint64_t aggregate_resumed_range_partition_reads() {
+    return smp::map_reduce(std::views::iota(0u, this_smp_shard_count()), [] (unsigned shard) {
+        return smp::submit_to(shard, [] {
+            return sstables::sstables_stats::get_shard_stats().resumed_range_partition_reads;
+        });
+    }, uint64_t(0), std::plus<uint64_t>()).get();
+}
+
+// Best run with SMP>=2
+SEASTAR_THREAD_TEST_CASE(test_resume_sstable_reads_after_eviction) {
+    do_with_cql_env_thread([] (cql_test_env& env) -> future<> {
+        using namespace std::chrono_literals;
+
+        env.db().invoke_on_all([] (replica::database& db) {
+            db.set_querier_cache_entry_ttl(60s);
+        }).get();
+
+        const auto ks = create_vnodes_keyspace(env);
+
+        auto [s, pkeys] = create_test_table(env, ks, get_name(), 16 * this_smp_shard_count(), 1);
+
+        // Resume hints are only used by sstable readers.
+        env.db().invoke_on_all([s] (replica::database& db) {
+            return db.find_column_family(s).flush();
+        }).get();
+
+        auto results1 = read_all_partitions_one_by_one(env.db(), s, pkeys);
+
+        const auto resumed_reads = aggregate_resumed_range_partition_reads();
+
+        // Evict all the queriers after each page, so each page has to
+        // recreate its readers.
+        auto [results2, npages] = read_all_partitions_with_paged_scan(env.db(), s, 4, stateful_query::yes, [&] (size_t) {
+            env.db().invoke_on_all([] (replica::database& db) -> future<> {
+                while (co_await db.get_querier_cache().evict_one()) {
+                }
+            }).get();
+        });
+
+        check_results_are_equal(results1, results2);
+
+        tests::require_greater(npages, 2u);
+        tests::require_greater(aggregate_resumed_range_partition_reads(), resumed_reads);
+        tests::require_greater(aggregate_querier_cache_stat(env.db(), &replica::querier_cache::stats::resource_based_evictions), 0u);
+
+        require_eventually_empty_caches(env.db());
+
+        return make_ready_future<>();
+    }, cql_config_with_extensions()).get();
+}
+
 // Best run with SMP>=2
 SEASTAR_THREAD_TEST_CASE(test_read_reversed) {
     do_with_cql_env_thread([] (cql_test_env& env) -> future<> {
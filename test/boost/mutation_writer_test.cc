@@ -7,6 +7,7 @@
  */
 
 #include <fmt/ranges.h>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
 #undef SEASTAR_TESTING_MAIN
 #include <seastar/testing/test_case.hh>
@@ -176,6 +177,93 @@ SEASTAR_TEST_CASE(test_multishard_writer_producer_aborts) {
     });
 }
 
+// A shard which is slow to consume its partitions must not stop the other
+// shards from consuming theirs, as long as the shard buffer can hold them.
+SEASTAR_TEST_CASE(test_multishard_writer_slow_shard) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        if (smp::count < 2) {
+            testlog.info("Skipping test, it needs at least 2 shards");
+            return;
+        }
+        random_mutation_generator gen(random_mutation_generator::generate_counters::no, local_shard_only::no);
+        auto muts = gen(many_partitions());
+        schema_ptr s = gen.schema();
+        auto& sharder = s->get_sharder();
+
+        std::set<unsigned> other_shards;
+        utils::chunked_vector<mutation> shard0_muts;
+        for (auto& m : muts) {
+            if (auto shard = sharder.shard_for_reads(m.token()); shard != 0) {
+                other_shards.insert(shard);
+            } else {
+                shard0_muts.push_back(m);
+            }
+        }
+        if (shard0_muts.empty() || other_shards.empty()) {
+            testlog.info("Skipping test, the partitions don't span shard 0 and other shards");
+            return;
+        }
+
+        // The memory the queue of shard 0 takes to hold all of its fragments.
+        size_t shard0_memory = 0;
+        {
+            auto reader = make_mutation_reader_from_mutations(s, make_reader_permit(e), shard0_muts);
+            auto close_reader = deferred_close(reader);
+            while (auto mf = reader().get()) {
+                shard0_memory += mf->memory_usage();
+            }
+        }
+        testlog.info("Shard 0 has {} partitions taking {} bytes", shard0_muts.size(), shard0_memory);
+
+        // Distributes the partitions, with shard 0 consuming nothing until the other
+        // shards are done. Fails if they aren't done by the timeout, which happens
+        // when the buffer of shard 0 blocks the producer.
+        auto distribute = [&] (size_t shard_buffer_size, std::chrono::seconds timeout) {
+            const size_t other_shards_nr = other_shards.size();
+            std::atomic<size_t> other_shards_done = 0;
+            std::atomic<size_t> partitions_consumed = 0;
+            auto deadline = lowres_clock::now() + timeout;
+
+            auto source_reader = make_mutation_reader_from_mutations(s, make_reader_permit(e), muts);
+            auto close_source_reader = deferred_close(source_reader);
+            size_t partitions_received = distribute_reader_and_consume_on_shards(s, sharder,
+                std::move(source_reader),
+                [&] (mutation_reader reader) {
+                    return seastar::async([&, reader = std::move(reader)] () mutable {
+                        auto close_reader = deferred_close(reader);
+                        if (this_shard_id() == 0) {
+                            while (other_shards_done.load() < other_shards_nr) {
+                                if (lowres_clock::now() > deadline) {
+                                    throw std::runtime_error("the other shards are blocked by shard 0");
+                                }
+                                seastar::sleep(std::chrono::milliseconds(1)).get();
+                            }
+                        }
+                        while (auto mf = reader().get()) {
+                            if (mf->is_partition_start()) {
+                                partitions_consumed++;
+                            }
+                        }
+                        if (this_shard_id() != 0) {
+                            other_shards_done++;
+                        }
+                    });
+                },
+                {},
+                shard_buffer_size
+            ).get();
+            BOOST_REQUIRE_EQUAL(partitions_received, muts.size());
+            BOOST_REQUIRE_EQUAL(partitions_consumed.load(), muts.size());
+        };
+
+        // A buffer holding all fragments of shard 0 lets the other shards finish.
+        distribute(shard0_memory + mutation_reader::default_max_buffer_size_in_bytes(), std::chrono::seconds(60));
+
+        // A buffer too small for them blocks the producer until shard 0 gives up.
+        BOOST_REQUIRE_THROW(distribute(shard0_memory / 2, std::chrono::seconds(1)), std::runtime_error);
+    });
+}
+
 namespace {
 
 using classify_by_var_t = std::variant<classify_by_timestamp, classify_by_token_group>;
@@ -205,6 +205,10 @@ class test_querier_cache {
         return _cache.get_stats();
     }
 
+    replica::querier_cache& get_cache() {
+        return _cache;
+    }
+
     dht::partition_range make_partition_range(bound begin, bound end) const {
         return dht::partition_range::make({_mutations.at(begin.value()).decorated_key(), begin.is_inclusive()},
                 {_mutations.at(end.value()).decorated_key(), end.is_inclusive()});
@@ -916,4 +920,74 @@ SEASTAR_THREAD_TEST_CASE(test_timeout_is_applied_on_lookup) {
     BOOST_REQUIRE_THROW(std::rethrow_exception(entry.permit.get_abort_exception()), seastar::named_semaphore_timed_out);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_resume_hints_find_start) {
+    simple_schema s;
+    const auto pkeys = s.make_pkeys(5);
+
+    sstables::resume_hints::partition_log log;
+    for (size_t i = 0; i < 4; ++i) {
+        log.record(pkeys[i].token(), i * 100);
+    }
+    BOOST_REQUIRE_EQUAL(log.size(), 4);
+
+    auto range_from = [&] (size_t i, bool inclusive) {
+        return dht::partition_range::make_starting_with({pkeys[i], inclusive});
+    };
+    auto start_of = [&] (const dht::partition_range& pr) {
+        auto pos = log.find_start(pr);
+        return pos ? std::make_optional(pos->start) : std::nullopt;
+    };
+    BOOST_REQUIRE(start_of(range_from(2, true)) == 200);
+    BOOST_REQUIRE(log.find_start(range_from(2, true))->next == 300);
+    // Only the token is logged, so the partition which the range starts
+    // after is not known to be before the range, but it can be skipped
+    // without the index.
+    BOOST_REQUIRE(start_of(range_from(1, false)) == 100);
+    BOOST_REQUIRE(log.find_start(range_from(1, false))->next == 200);
+    BOOST_REQUIRE(!log.find_start(range_from(3, true))->next);
+    // The partition preceding the start is not known.
+    BOOST_REQUIRE(!log.find_start(range_from(0, true)));
+    // The start is past the logged partitions.
+    BOOST_REQUIRE(!log.find_start(range_from(4, true)));
+
+    // Only the last partitions are kept.
+    for (size_t i = 0; i < sstables::resume_hints::max_partitions_per_sstable; ++i) {
+        log.record(pkeys[4].token(), 1000 + i);
+    }
+    BOOST_REQUIRE_EQUAL(log.size(), sstables::resume_hints::max_partitions_per_sstable);
+    BOOST_REQUIRE(!log.find_start(range_from(2, true)));
+
+    log.reset();
+    BOOST_REQUIRE_EQUAL(log.size(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_resume_hints_survive_resource_based_eviction) {
+    test_querier_cache t;
+
+    auto permit = t.get_semaphore().make_tracking_only_permit(t.get_schema(), get_name(), db::no_timeout, {});
+    const auto entry = t.produce_first_page_and_save_data_querier();
+    const auto key = query_id(utils::UUID{entry.key, 1});
+
+    // Nothing is attached unless a querier was evicted.
+    t.get_cache().attach_resume_hints(key, permit);
+    BOOST_REQUIRE(!permit.resume_hints());
+
+    BOOST_REQUIRE(t.get_cache().evict_one().get());
+
+    // The evicted querier's readers save their logs when closed.
+    auto hints = entry.permit.resume_hints();
+    BOOST_REQUIRE(hints);
+    sstables::resume_hints::partition_log log;
+    log.record(dht::token(1), 0);
+    hints->save(sstables::generation_type(1), log);
+
+    t.get_cache().attach_resume_hints(key, permit);
+    BOOST_REQUIRE_EQUAL(permit.resume_hints().get(), hints.get());
+
+    // The saved hints are handed out only once.
+    auto other_permit = t.get_semaphore().make_tracking_only_permit(t.get_schema(), get_name(), db::no_timeout, {});
+    t.get_cache().attach_resume_hints(key, other_permit);
+    BOOST_REQUIRE(!other_permit.resume_hints());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
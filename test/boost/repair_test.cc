@@ -9,6 +9,7 @@
 #include "replica/memtable.hh"
 #include "readers/from_fragments.hh"
 #include "repair/hash.hh"
+#include "repair/hash_tree.hh"
 #include "repair/row.hh"
 #include "repair/writer.hh"
 #include "repair/reader.hh"
@@ -21,6 +22,7 @@
 #include <boost/lexical_cast.hpp>
 #undef SEASTAR_TESTING_MAIN
 #include <seastar/testing/test_case.hh>
+#include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/short_streams.hh>
 #include "test/lib/sstable_utils.hh"
 #include "readers/mutation_fragment_v1_stream.hh"
@@ -408,4 +410,110 @@ SEASTAR_TEST_CASE(test_tablet_token_range_count) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(test_repair_row_hash_tree) {
+    auto reconcile = [] (const repair_hash_set& local, const repair_hash_set& peer) {
+        repair_row_hash_tree_reconciler reconciler(local);
+        size_t hashes_sent = 0;
+        while (!reconciler.done()) {
+            auto resp = repair_row_hash_tree::respond(peer, reconciler.next_request());
+            hashes_sent += resp.hashes.size();
+            reconciler.apply(std::move(resp));
+        }
+        BOOST_REQUIRE(std::move(reconciler).get_peer_hashes() == peer);
+        return hashes_sent;
+    };
+
+    repair_hash_set common;
+    while (common.size() < 10000) {
+        common.emplace(tests::random::get_int<uint64_t>());
+    }
+
+    // Identical sets are reconciled with the summaries of the root's children alone.
+    BOOST_REQUIRE_EQUAL(reconcile(common, common), 0u);
+
+    // A few rows missing on either side only ship the hashes of their leaf buckets.
+    auto local = common;
+    auto peer = common;
+    for (int i = 0; i < 5; ++i) {
+        peer.erase(std::next(peer.begin(), tests::random::get_int<size_t>(0, peer.size() - 1)));
+        local.erase(std::next(local.begin(), tests::random::get_int<size_t>(0, local.size() - 1)));
+        peer.emplace(tests::random::get_int<uint64_t>());
+    }
+    auto hashes_sent = reconcile(local, peer);
+    BOOST_REQUIRE_GT(hashes_sent, 0u);
+    BOOST_REQUIRE_LE(hashes_sent, 15 * repair_row_hash_tree::max_leaf_rows);
+
+    // Hashes sharing most of their bits share buckets down to the last levels.
+    repair_hash_set close_local;
+    repair_hash_set close_peer;
+    for (uint64_t h = 0; h < 100; ++h) {
+        close_local.emplace(h);
+        close_peer.emplace(h == 50 ? 200 : h);
+    }
+    BOOST_REQUIRE_LE(reconcile(close_local, close_peer), 2 * repair_row_hash_tree::fanout);
+
+    // Empty sides.
+    reconcile(repair_hash_set(), common);
+    BOOST_REQUIRE_EQUAL(reconcile(common, repair_hash_set()), 0u);
+
+    BOOST_REQUIRE_EQUAL(repair_row_hash_tree::first_hash(0, 0).hash, 0u);
+    BOOST_REQUIRE_EQUAL(repair_row_hash_tree::last_hash(0, 0).hash, ~uint64_t(0));
+    BOOST_REQUIRE_EQUAL(repair_row_hash_tree::last_hash(repair_row_hash_tree::max_level, 42).hash, 42u);
+    BOOST_REQUIRE_EQUAL(repair_row_hash_tree::bucket_of(repair_hash(~uint64_t(0)), 1), repair_row_hash_tree::fanout - 1);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_repair_bandwidth_scheduler) {
+    using namespace std::chrono_literals;
+    using clock = repair_bandwidth_scheduler::clock;
+    repair_bandwidth_scheduler scheduler(utils::updateable_value<uint32_t>(16));
+    auto busy = locator::host_id::create_random_id();
+    auto idle = locator::host_id::create_random_id();
+    auto now = clock::now();
+
+    // Followers which didn't report are assumed to be idle, and so are those
+    // whose report is stale.
+    BOOST_REQUIRE_EQUAL(scheduler.headroom(busy, now), 1.0);
+    scheduler.report_headroom(busy, 0.5, now);
+    BOOST_REQUIRE_EQUAL(scheduler.headroom(busy, now), 0.5);
+    BOOST_REQUIRE_EQUAL(scheduler.headroom(busy, now + repair_bandwidth_scheduler::headroom_ttl + 1s), 1.0);
+    std::vector<locator::host_id> nodes{busy, idle};
+    BOOST_REQUIRE_EQUAL(scheduler.min_headroom_of(nodes, now), 0.5);
+
+    // The ranges in parallel and the row buf are scaled by the headroom.
+    BOOST_REQUIRE_EQUAL(scheduler.ranges_in_parallel(10, nodes, now), 5u);
+    BOOST_REQUIRE_EQUAL(scheduler.ranges_in_parallel(1, nodes, now), 1u);
+    BOOST_REQUIRE_EQUAL(scheduler.row_buf_size(32 << 20, nodes, now), size_t(16 << 20));
+    BOOST_REQUIRE_EQUAL(scheduler.row_buf_size(128 << 10, nodes, now), size_t(128 << 10));
+
+    // A follower with no headroom still gets the minimal share.
+    scheduler.report_headroom(busy, 0, now);
+    BOOST_REQUIRE_EQUAL(scheduler.headroom(busy, now), repair_bandwidth_scheduler::min_headroom);
+    BOOST_REQUIRE_EQUAL(scheduler.row_buf_size(1 << 20, nodes, now), repair_bandwidth_scheduler::min_row_buf_size);
+
+    // The bucket starts full, reading more than it holds has to be waited for.
+    auto rate = scheduler.rate(idle, now);
+    BOOST_REQUIRE_EQUAL(rate, 16.0 * 1024 * 1024 / smp::count);
+    BOOST_REQUIRE(scheduler.charge(idle, rate, now) == clock::duration::zero());
+    auto delay = scheduler.charge(idle, rate / 2, now);
+    BOOST_REQUIRE(delay > 400ms && delay < 600ms);
+    // The debt is paid off over time.
+    BOOST_REQUIRE(scheduler.charge(idle, 0, now + 1s) == clock::duration::zero());
+
+    // Unlimited bandwidth.
+    repair_bandwidth_scheduler unlimited(utils::updateable_value<uint32_t>(0));
+    BOOST_REQUIRE(unlimited.charge(idle, 1ul << 40, now) == clock::duration::zero());
+
+    // Ranges wait for admission while the limit is reached.
+    scheduler.report_headroom(busy, 0.5);
+    auto first = scheduler.admit_range(2, nodes, [] {}).get();
+    auto second = scheduler.admit_range(2, nodes, [] {});
+    BOOST_REQUIRE(!second.available());
+    BOOST_REQUIRE_EQUAL(scheduler.ranges_in_flight(), 1u);
+    first.release();
+    auto units = second.get();
+    BOOST_REQUIRE_EQUAL(scheduler.ranges_in_flight(), 1u);
+    units.release();
+    BOOST_REQUIRE_EQUAL(scheduler.ranges_in_flight(), 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
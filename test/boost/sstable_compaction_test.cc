@@ -28,6 +28,7 @@
 #include "replica/database.hh"
 #include "compaction/leveled_manifest.hh"
 #include "sstables/metadata_collector.hh"
+#include "sstables/repair_hash_summary.hh"
 #include "sstables/sstable_writer.hh"
 #include <memory>
 #include "test/boost/sstable_test.hh"
@@ -71,6 +72,10 @@
 #include "utils/assert.hh"
 #include "utils/pretty_printers.hh"
 #include "sstables/exceptions.hh"
+#include "compaction/read_fanout_tracker.hh"
+#include "compaction/compaction_planner.hh"
+#include "sstables/sstable_slicer.hh"
+#include "sstables/mx/writer.hh"
 
 BOOST_AUTO_TEST_SUITE(sstable_compaction_test)
 
@@ -141,10 +146,13 @@ static mutation_reader sstable_reader(shared_sstable sst, schema_ptr s, reader_p
 class strategy_control_for_test : public compaction::strategy_control {
     bool _has_ongoing_compaction;
     std::optional<std::vector<shared_sstable>> _candidates_opt;
+    mutable std::optional<dht::token_range> _hot_read_range;
 public:
-    explicit strategy_control_for_test(bool has_ongoing_compaction, std::optional<std::vector<shared_sstable>> candidates) noexcept
+    explicit strategy_control_for_test(bool has_ongoing_compaction, std::optional<std::vector<shared_sstable>> candidates,
+            std::optional<dht::token_range> hot_read_range = std::nullopt) noexcept
         : _has_ongoing_compaction(has_ongoing_compaction)
-        , _candidates_opt(candidates) {}
+        , _candidates_opt(candidates)
+        , _hot_read_range(std::move(hot_read_range)) {}
 
     bool has_ongoing_compaction(compaction::compaction_group_view& table_s) const noexcept override {
         return _has_ongoing_compaction;
@@ -159,6 +167,10 @@ class strategy_control_for_test : public compaction::strategy_control {
         auto main_set = co_await t.main_sstable_set();
         co_return main_set->all_sstable_runs();
     }
+
+    std::optional<dht::token_range> take_hot_read_range(compaction::compaction_group_view& t) const override {
+        return std::exchange(_hot_read_range, std::nullopt);
+    }
 };
 
 static std::unique_ptr<compaction::strategy_control> make_strategy_control_for_test(bool has_ongoing_compaction, std::optional<std::vector<shared_sstable>> candidates = std::nullopt) {
@@ -2280,6 +2292,71 @@ SEASTAR_FIXTURE_TEST_CASE(time_window_strategy_size_tiered_behavior_correctness_
                                    test_env_config{.storage = make_test_object_storage_options("GS")});
 }
 
+// Check that TWCS offloads windows older than offload_after_windows, oldest first,
+// by compacting them into sstables written to the offload storage.
+SEASTAR_TEST_CASE(time_window_strategy_offload_cold_windows) {
+    return test_env::do_with_async([] (test_env& env) {
+        using namespace std::chrono;
+        std::map<sstring, sstring> options = {
+            {"compaction_window_unit", "HOURS"},
+            {"compaction_window_size", "1"},
+            {"offload_after_windows", "2"},
+            {"offload_storage_endpoint", "localhost"},
+            {"offload_storage_bucket", "cold"},
+        };
+        auto builder = schema_builder("tests", "time_window_strategy_offload")
+                .with_column("id", utf8_type, column_kind::partition_key)
+                .with_column("value", int32_type);
+        builder.set_compaction_strategy(compaction::compaction_strategy_type::time_window);
+        builder.set_compaction_strategy_options(std::map<sstring, sstring>(options));
+        auto s = builder.build();
+
+        auto offload_storage = compaction::time_window_compaction_strategy::offload_storage_options(*s);
+        BOOST_REQUIRE(offload_storage);
+        BOOST_REQUIRE(offload_storage->is_s3_type());
+
+        auto sst_gen = env.make_sst_factory(s);
+        auto cf = env.make_table_for_tests(s);
+        auto close_cf = deferred_stop(cf);
+        compaction::time_window_compaction_strategy twcs(options);
+
+        // One sstable in each of the 4 most recent windows.
+        api::timestamp_type now = api::timestamp_clock::now().time_since_epoch().count();
+        std::vector<shared_sstable> sstables;
+        for (int window = 3; window >= 0; --window) {
+            auto ts = now - duration_cast<microseconds>(hours(window)).count();
+            mutation m(s, partition_key::from_exploded(*s, {to_bytes(fmt::format("key{}", window))}));
+            m.set_clustered_cell(clustering_key::make_empty(), bytes("value"), data_value(int32_t(1)), ts);
+            sstables.push_back(make_sstable_containing(sst_gen, {std::move(m)}).get());
+        }
+
+        auto desc = get_sstables_for_compaction(twcs, cf.as_compaction_group_view(), sstables).get();
+        BOOST_REQUIRE_EQUAL(desc.sstables.size(), 1u);
+        BOOST_REQUIRE(desc.sstables.front() == sstables[0]);
+        BOOST_REQUIRE(desc.output_storage);
+        BOOST_REQUIRE(desc.output_storage->value == offload_storage->value);
+
+        // The second oldest window is offloaded next, the 2 most recent ones are kept.
+        desc = get_sstables_for_compaction(twcs, cf.as_compaction_group_view(), {sstables[1], sstables[2], sstables[3]}).get();
+        BOOST_REQUIRE_EQUAL(desc.sstables.size(), 1u);
+        BOOST_REQUIRE(desc.sstables.front() == sstables[1]);
+        BOOST_REQUIRE(desc.output_storage);
+
+        desc = get_sstables_for_compaction(twcs, cf.as_compaction_group_view(), {sstables[2], sstables[3]}).get();
+        BOOST_REQUIRE(desc.sstables.empty());
+
+        // Offloading requires the storage to be configured.
+        options.erase("offload_storage_bucket");
+        BOOST_REQUIRE_THROW(compaction::time_window_compaction_strategy{options}, exceptions::configuration_exception);
+        // The storage can be configured without offloading, to keep already offloaded windows.
+        options["offload_storage_bucket"] = "cold";
+        options["offload_after_windows"] = "0";
+        compaction::time_window_compaction_strategy twcs_no_offload(options);
+        desc = get_sstables_for_compaction(twcs_no_offload, cf.as_compaction_group_view(), sstables).get();
+        BOOST_REQUIRE(desc.sstables.empty());
+    });
+}
+
 static void check_min_max_column_names(const sstable_ptr& sst, std::vector<bytes> min_components, std::vector<bytes> max_components) {
     const auto& st = sst->get_stats_metadata();
     BOOST_TEST_MESSAGE(fmt::format("min {}/{} max {}/{}", st.min_column_names.elements.size(), min_components.size(), st.max_column_names.elements.size(), max_components.size()));
@@ -6263,6 +6340,77 @@ SEASTAR_FIXTURE_TEST_CASE(simple_backlog_controller_test_incremental_gcs, gcs_fi
     return run_controller_test(compaction::compaction_strategy_type::incremental, test_env_config{.storage = make_test_object_storage_options("GS")});
 }
 
+SEASTAR_TEST_CASE(compaction_shares_autotuner_test) {
+    using autotuner = compaction_shares_autotuner;
+    const float min_shares = 10;
+    const float max_shares = 1000;
+    auto make_sample = [] (double backlog, uint64_t requests, std::chrono::microseconds p99, uint64_t compacted_bytes = 0) {
+        return autotuner::sample{
+            .target = std::chrono::microseconds(1000),
+            .backlog = backlog,
+            .compacted_bytes = compacted_bytes,
+            .interval = std::chrono::seconds(1),
+            .foreground_requests = requests,
+            .foreground_p99 = p99,
+        };
+    };
+
+    // Too few foreground requests to judge their latency: the curve is followed.
+    {
+        autotuner t;
+        BOOST_REQUIRE_EQUAL(t.adjust(100, make_sample(10, autotuner::min_foreground_requests - 1, 5000us), min_shares, max_shares), 100);
+        BOOST_REQUIRE_EQUAL(t.get_stats().gain, 1.0f);
+        BOOST_REQUIRE_EQUAL(t.get_stats().latency_throttles, 0u);
+    }
+
+    // Latency above the target throttles compaction, down to the minimum gain.
+    {
+        autotuner t;
+        auto shares = t.adjust(100, make_sample(10, 100, 1500us), min_shares, max_shares);
+        BOOST_REQUIRE_LT(shares, 100);
+        BOOST_REQUIRE_EQUAL(t.get_stats().latency_throttles, 1u);
+        for (int i = 0; i < 20; ++i) {
+            shares = t.adjust(100, make_sample(10, 100, 10000us), min_shares, max_shares);
+        }
+        BOOST_REQUIRE_EQUAL(t.get_stats().gain, autotuner::min_gain);
+        BOOST_REQUIRE_EQUAL(shares, min_shares);
+    }
+
+    // Latency headroom with a growing backlog boosts compaction, up to the maximum gain and shares.
+    {
+        autotuner t;
+        float shares = 0;
+        for (int i = 1; i <= 50; ++i) {
+            shares = t.adjust(100, make_sample(10 * i, 100, 100us), min_shares, max_shares);
+        }
+        BOOST_REQUIRE_EQUAL(t.get_stats().gain, autotuner::max_gain);
+        BOOST_REQUIRE_EQUAL(shares, 100 * autotuner::max_gain);
+        BOOST_REQUIRE_EQUAL(t.get_stats().backlog_boosts, 50u);
+        BOOST_REQUIRE_EQUAL(t.adjust(500, make_sample(1000, 100, 100us), min_shares, max_shares), max_shares);
+
+        // Headroom with a shrinking backlog leaves the gain alone.
+        t.adjust(100, make_sample(1, 100, 100us), min_shares, max_shares);
+        BOOST_REQUIRE_EQUAL(t.get_stats().backlog_boosts, 51u);
+    }
+
+    // Once throughput is known, shares never drop below what drains the backlog in time.
+    {
+        autotuner t;
+        // 1000 bytes/s with 100 shares: 10 bytes/s/share.
+        t.adjust(100, make_sample(0, 0, 0us), min_shares, max_shares);
+        t.adjust(100, make_sample(0, 0, 0us, 1000), min_shares, max_shares);
+        BOOST_REQUIRE_EQUAL(t.get_stats().throughput_per_share, 10);
+        for (int i = 0; i < 20; ++i) {
+            t.adjust(100, make_sample(0, 100, 10000us), min_shares, max_shares);
+        }
+        BOOST_REQUIRE_EQUAL(t.get_stats().gain, autotuner::min_gain);
+        const double backlog = 500 * 10 * autotuner::max_backlog_drain_time.count();
+        BOOST_REQUIRE_EQUAL(t.adjust(100, make_sample(backlog, 100, 10000us), min_shares, max_shares), 500);
+    }
+
+    return make_ready_future<>();
+}
+
 void test_compaction_strategy_cleanup_method_fn(test_env& env, size_t all_files = 64) {
 
     auto get_cleanup_jobs = [&env, all_files] (compaction::compaction_strategy_type compaction_strategy_type,
@@ -7297,6 +7445,126 @@ SEASTAR_FIXTURE_TEST_CASE(splitting_compaction_test_gcs, gcs_fixture, *tests::ch
     return test_env::do_with_async([](test_env& env) { splitting_compaction_fn(env); }, test_env_config{.storage = make_test_object_storage_options("GS")});
 }
 
+SEASTAR_TEST_CASE(sstable_slicing_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        auto s = schema_builder("tests", "sstable_slicing")
+                .with_column("id", utf8_type, column_kind::partition_key)
+                .with_column("cl", int32_type, column_kind::clustering_key)
+                .with_column("value", bytes_type)
+                .build();
+        auto sst_gen = env.make_sst_factory(s);
+        auto cfg = env.manager().configure_writer();
+
+        // Every tenth partition is too large to be copied without a promoted index.
+        auto keys = tests::generate_partition_keys(100, s);
+        utils::chunked_vector<mutation> muts;
+        std::unordered_set<dht::token> large_partitions;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            mutation m(s, keys[i]);
+            if (i % 7 == 0) {
+                m.partition().apply(tombstone(api::new_timestamp(), gc_clock::now()));
+            }
+            const int rows = i % 10 ? 2 : 1000;
+            for (int ck = 0; ck < rows; ++ck) {
+                m.set_clustered_cell(clustering_key::from_single_value(*s, int32_type->decompose(ck)), "value",
+                        data_value(bytes(512, int8_t(ck))), api::new_timestamp());
+            }
+            if (rows > 2) {
+                large_partitions.insert(m.token());
+            }
+            muts.push_back(std::move(m));
+        }
+        auto input = make_sstable_containing(sst_gen, muts).get();
+        input->update_repaired_at(42);
+        BOOST_REQUIRE(sstables::can_slice_sstable(*input, cfg, input->get_version()));
+
+        auto group_of = [] (dht::token t) -> size_t {
+            return dht::compaction_group_of(1, t);
+        };
+        auto verify_slices = [&] (const sstables::sstable_slices& slices, std::function<bool(size_t)> is_kept) {
+            std::map<size_t, utils::chunked_vector<mutation>> expected;
+            for (const auto& m : muts) {
+                if (is_kept(group_of(m.token()))) {
+                    expected[group_of(m.token())].push_back(m);
+                }
+            }
+            BOOST_REQUIRE_EQUAL(slices.sstables.size(), expected.size());
+            BOOST_REQUIRE_EQUAL(slices.stats.rewritten_partitions, uint64_t(std::ranges::count_if(muts, [&] (const mutation& m) {
+                return is_kept(group_of(m.token())) && large_partitions.contains(m.token());
+            })));
+            for (const auto& sst : slices.sstables) {
+                const auto group = group_of(sst->get_first_decorated_key().token());
+                BOOST_REQUIRE_EQUAL(group, group_of(sst->get_last_decorated_key().token()));
+                auto& group_muts = expected.at(group);
+
+                auto rd = assert_that(sstable_reader(sst, s, env.make_reader_permit()));
+                for (const auto& m : group_muts) {
+                    rd.produces(m);
+                }
+                rd.produces_end_of_stream();
+
+                // Lookups go through the regenerated index and filter.
+                for (const auto& m : group_muts) {
+                    auto pr = dht::partition_range::make_singular(m.decorated_key());
+                    assert_that(sst->make_reader(s, env.make_reader_permit(), pr, s->full_slice()))
+                            .produces(m)
+                            .produces_end_of_stream();
+                    BOOST_REQUIRE(sst->filter_has_key(*s, m.key()));
+                }
+                BOOST_REQUIRE_GE(sst->get_stats_metadata().min_timestamp, input->get_stats_metadata().min_timestamp);
+                BOOST_REQUIRE_LE(sst->get_stats_metadata().max_timestamp, input->get_stats_metadata().max_timestamp);
+                BOOST_REQUIRE_EQUAL(sst->get_estimated_key_count(), group_muts.size());
+
+                // The slices are the same data as the input, they keep its metadata.
+                BOOST_REQUIRE_EQUAL(sst->get_stats_metadata().repaired_at, 42);
+                BOOST_REQUIRE_EQUAL(sst->get_origin(), input->get_origin());
+                BOOST_REQUIRE(sst->compaction_ancestors().contains(input->generation()));
+
+                // The counts of the copied partitions are carried over from
+                // the input. It has a TombstoneDensity segment per partition,
+                // so the tombstones are exact.
+                const auto* density = sst->get_scylla_metadata()->get_tombstone_density();
+                uint64_t tombstones = 0;
+                if (density) {
+                    for (const auto& segment : density->elements) {
+                        tombstones += segment.tombstones;
+                    }
+                }
+                BOOST_REQUIRE_EQUAL(tombstones, uint64_t(std::ranges::count_if(group_muts, [] (const mutation& m) {
+                    return bool(m.partition().partition_tombstone());
+                })));
+                uint64_t rows = 0;
+                for (const auto& m : group_muts) {
+                    rows += m.partition().row_count();
+                }
+                BOOST_REQUIRE_GE(uint64_t(sst->get_stats_metadata().rows_count), rows);
+            }
+        };
+
+        abort_source as;
+        auto slices = sstables::slice_sstable(input, env.make_reader_permit(), [&] (dht::token t) -> std::optional<size_t> {
+            return group_of(t);
+        }, sst_gen, cfg, as).get();
+        BOOST_REQUIRE_EQUAL(slices.stats.dropped_partitions, 0u);
+        verify_slices(slices, [] (size_t) { return true; });
+
+        // Partitions outside of the slices are dropped.
+        slices = sstables::slice_sstable(input, env.make_reader_permit(), [&] (dht::token t) -> std::optional<size_t> {
+            auto group = group_of(t);
+            return group == 0 ? std::make_optional(group) : std::nullopt;
+        }, sst_gen, cfg, as).get();
+        BOOST_REQUIRE_EQUAL(slices.stats.dropped_partitions, uint64_t(std::ranges::count_if(muts, [&] (const mutation& m) { return group_of(m.token()) != 0; })));
+        verify_slices(slices, [] (size_t group) { return group == 0; });
+
+        // Partitions can't be copied into sstables of another version, or
+        // written for another schema, e.g. when an sstable written before the
+        // schema was altered is loaded with the new one.
+        auto altered = schema_builder(s).with_column("other", int32_type).build();
+        BOOST_REQUIRE(!sstables::mc::can_copy_raw_partitions(*input, *altered, cfg, input->get_version()));
+        BOOST_REQUIRE(!sstables::can_slice_sstable(*input, cfg, sstables::sstable_version_types::mc));
+    });
+}
+
 void unsealed_sstable_compaction_fn(test_env& env) {
     BOOST_REQUIRE(this_smp_shard_count() == 1);
     auto s = schema_builder(this_smp_shard_count(), "tests", "unsealed_sstable_compaction_test")
@@ -7695,4 +7963,427 @@ SEASTAR_TEST_CASE(test_perform_component_rewrite_multiple_sstables) {
     });
 }
 
+SEASTAR_TEST_CASE(test_copy_through_disjoint_sstables) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto keys = ss.make_pkeys(11);
+        auto sst_gen = env.make_sst_factory(s);
+
+        auto make_insert = [&] (const dht::decorated_key& key) {
+            auto m = mutation(s, key);
+            m.partition().apply_insert(*s, ss.make_ckey(0), ss.new_timestamp());
+            return m;
+        };
+        utils::chunked_vector<mutation> muts;
+        for (size_t i = 0; i < 10; ++i) {
+            muts.push_back(make_insert(keys[i]));
+        }
+        auto tombstone = mutation(s, keys[10]);
+        tombstone.partition().apply(ss.new_tombstone());
+
+        auto disjoint1 = make_sstable_containing(sst_gen, {muts[0], muts[1], muts[2]}).get();
+        auto disjoint2 = make_sstable_containing(sst_gen, {muts[3], muts[4], muts[5]}).get();
+        auto overlapping1 = make_sstable_containing(sst_gen, {muts[6], muts[7], muts[8]}).get();
+        auto overlapping2 = make_sstable_containing(sst_gen, {muts[8], muts[9]}).get();
+        // Disjoint, but holds a tombstone.
+        auto with_tombstone = make_sstable_containing(sst_gen, {tombstone}).get();
+        std::vector<shared_sstable> input = {overlapping2, disjoint2, with_tombstone, overlapping1, disjoint1};
+
+        auto cf = env.make_table_for_tests(s);
+        auto close_cf = deferred_stop(cf);
+
+        auto compact = [&] (bool copy_disjoint_sstables) {
+            auto desc = compaction::compaction_descriptor(input);
+            desc.copy_disjoint_sstables = copy_disjoint_sstables;
+            auto run_identifier = desc.run_identifier;
+            auto ret = compact_sstables(env, std::move(desc), cf, sst_gen).get();
+            for (auto& sst : ret.new_sstables) {
+                BOOST_REQUIRE(sst->run_identifier() == run_identifier);
+            }
+            return ret;
+        };
+
+        auto ret = compact(false);
+        BOOST_REQUIRE_EQUAL(ret.stats.copied_through_size, 0);
+
+        ret = compact(true);
+        BOOST_REQUIRE_EQUAL(ret.stats.copied_through_size, disjoint1->bytes_on_disk() + disjoint2->bytes_on_disk());
+        for (auto& sst : ret.new_sstables) {
+            BOOST_REQUIRE(!std::ranges::contains(input, sst->generation(), std::mem_fn(&sstables::sstable::generation)));
+        }
+
+        auto reader = make_combined_reader(s, env.make_reader_permit(), ret.new_sstables | std::views::transform([&] (const shared_sstable& sst) {
+            return sst->as_mutation_source().make_mutation_reader(s, env.make_reader_permit());
+        }) | std::ranges::to<std::vector<mutation_reader>>());
+        auto assertions = assert_that(std::move(reader));
+        for (const auto& m : muts) {
+            assertions.produces(m);
+        }
+        assertions.produces(tombstone).produces_end_of_stream();
+    });
+}
+
+SEASTAR_TEST_CASE(test_copy_through_sstables_interleaved_with_rewritten_ones) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto keys = ss.make_pkeys(6);
+        auto sst_gen = env.make_sst_factory(s);
+
+        utils::chunked_vector<mutation> muts;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            auto m = mutation(s, keys[i]);
+            m.partition().apply_insert(*s, ss.make_ckey(0), ss.new_timestamp());
+            // The sstables at both ends hold tombstones, so they are rewritten.
+            if (i == 0 || i == keys.size() - 1) {
+                m.partition().apply(ss.new_tombstone());
+            }
+            muts.push_back(std::move(m));
+        }
+
+        // All the sstables are disjoint, but the output of rewriting the
+        // first and last ones spans the middle one.
+        auto first = make_sstable_containing(sst_gen, {muts[0], muts[1]}).get();
+        auto middle = make_sstable_containing(sst_gen, {muts[2], muts[3]}).get();
+        auto last = make_sstable_containing(sst_gen, {muts[4], muts[5]}).get();
+
+        auto cf = env.make_table_for_tests(s);
+        auto close_cf = deferred_stop(cf);
+
+        auto desc = compaction::compaction_descriptor({first, middle, last});
+        desc.copy_disjoint_sstables = true;
+        auto ret = compact_sstables(env, std::move(desc), cf, sst_gen).get();
+        BOOST_REQUIRE_EQUAL(ret.stats.copied_through_size, 0);
+
+        // The output is a run of disjoint sstables.
+        auto output = ret.new_sstables;
+        std::ranges::sort(output, [] (const shared_sstable& a, const shared_sstable& b) {
+            return a->compare_by_first_key(*b) < 0;
+        });
+        for (size_t i = 1; i < output.size(); ++i) {
+            BOOST_REQUIRE(output[i - 1]->get_last_decorated_key().tri_compare(*s, output[i]->get_first_decorated_key()) < 0);
+        }
+
+        auto reader = make_combined_reader(s, env.make_reader_permit(), output | std::views::transform([&] (const shared_sstable& sst) {
+            return sst->as_mutation_source().make_mutation_reader(s, env.make_reader_permit());
+        }) | std::ranges::to<std::vector<mutation_reader>>());
+        auto assertions = assert_that(std::move(reader));
+        for (const auto& m : muts) {
+            assertions.produces(m);
+        }
+        assertions.produces_end_of_stream();
+    });
+}
+
+SEASTAR_TEST_CASE(test_tombstone_dense_range_compaction) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto keys = ss.make_pkeys(1024);
+        auto sst_gen = env.make_sst_factory(s);
+
+        // Tombstones old enough to be purged, concentrated in a small part of the token range.
+        const size_t dense_begin = 480;
+        const size_t dense_end = 512;
+        const auto deletion_time = gc_clock::now() - s->gc_grace_seconds() - std::chrono::hours(24);
+        auto make_live = [&] (const dht::decorated_key& key) {
+            auto m = mutation(s, key);
+            ss.add_row(m, ss.make_ckey(0), "v");
+            return m;
+        };
+        utils::chunked_vector<mutation> muts;
+        for (size_t i = 0; i < keys.size() / 2; ++i) {
+            if (i >= dense_begin && i < dense_end) {
+                auto m = mutation(s, keys[i]);
+                m.partition().apply(tombstone(ss.new_timestamp(), deletion_time));
+                muts.push_back(std::move(m));
+            } else {
+                muts.push_back(make_live(keys[i]));
+            }
+        }
+        auto dense = make_sstable_containing(sst_gen, std::move(muts)).get();
+
+        muts.clear();
+        for (size_t i = keys.size() / 2; i < keys.size(); ++i) {
+            muts.push_back(make_live(keys[i]));
+        }
+        auto disjoint = make_sstable_containing(sst_gen, std::move(muts)).get();
+        // Holds data the tombstones may shadow.
+        auto overlapping = make_sstable_containing(sst_gen, {make_live(keys[dense_begin + 1])}).get();
+
+        const auto* sm = dense->get_scylla_metadata();
+        BOOST_REQUIRE(sm);
+        const auto* density = sm->get_tombstone_density();
+        BOOST_REQUIRE(density);
+        BOOST_REQUIRE_LE(density->elements.size(), sstables::tombstone_density_tracker::max_segments);
+        uint64_t partitions = 0;
+        uint64_t tombstones = 0;
+        for (const auto& segment : density->elements) {
+            partitions += segment.partitions;
+            tombstones += segment.tombstones;
+            BOOST_REQUIRE_LE(segment.first_token, segment.last_token);
+        }
+        BOOST_REQUIRE_EQUAL(partitions, keys.size() / 2);
+        BOOST_REQUIRE_EQUAL(tombstones, dense_end - dense_begin);
+        BOOST_REQUIRE(!disjoint->get_scylla_metadata()->get_tombstone_density());
+
+        auto cf = env.make_table_for_tests(s);
+        auto close_cf = deferred_stop(cf);
+        auto& table_s = cf.as_compaction_group_view();
+        std::vector<shared_sstable> candidates = {dense, disjoint, overlapping};
+
+        // The tombstones are too few for the sstable as a whole to reach the default tombstone_threshold.
+        auto gc_state = tombstone_gc_state::for_tests();
+        BOOST_REQUIRE_LT(dense->estimate_droppable_tombstone_ratio(gc_clock::now(), gc_state, s), 0.2);
+
+        auto cs = compaction::make_compaction_strategy(compaction::compaction_strategy_type::size_tiered, {});
+        // Recently written sstables are ignored.
+        auto descriptor = get_sstables_for_compaction(cs, table_s, candidates).get();
+        BOOST_REQUIRE(descriptor.sstables.empty());
+
+        for (auto& sst : candidates) {
+            sstables::test(sst).set_data_file_write_time(db_clock::time_point::min());
+        }
+        descriptor = get_sstables_for_compaction(cs, table_s, candidates).get();
+        BOOST_REQUIRE_EQUAL(descriptor.sstables.size(), 2u);
+        BOOST_REQUIRE(std::ranges::contains(descriptor.sstables, dense));
+        BOOST_REQUIRE(std::ranges::contains(descriptor.sstables, overlapping));
+
+        auto ret = compact_sstables(env, std::move(descriptor), cf, sst_gen).get();
+        for (auto& sst : ret.new_sstables) {
+            BOOST_REQUIRE(!sst->get_scylla_metadata()->get_tombstone_density());
+        }
+    });
+}
+
+SEASTAR_TEST_CASE(test_max_purgeable_uses_timestamp_index) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto keys = ss.make_pkeys(3);
+        auto sst_gen = env.make_sst_factory(s);
+        const auto deletion_time = gc_clock::now() - s->gc_grace_seconds() - std::chrono::hours(24);
+
+        auto make_live = [&] (const dht::decorated_key& key, api::timestamp_type ts) {
+            auto m = mutation(s, key);
+            ss.add_row(m, ss.make_ckey(0), "v", ts);
+            return m;
+        };
+        auto make_delete = [&] (const dht::decorated_key& key, api::timestamp_type ts) {
+            auto m = mutation(s, key);
+            m.partition().apply(tombstone(ts, deletion_time));
+            return m;
+        };
+
+        // Holds data older than the tombstones for keys[0] only, and nothing for keys[1].
+        auto other = make_sstable_containing(sst_gen, {make_live(keys[0], 10), make_live(keys[2], 100)}).get();
+        const auto* sm = other->get_scylla_metadata();
+        BOOST_REQUIRE(sm && sm->get_timestamp_index());
+        BOOST_REQUIRE_LE(sm->get_timestamp_index()->elements.size(), sstables::timestamp_index_tracker::max_segments);
+        const auto stat = sstables::ext_timestamp_stats_type::min_live_timestamp;
+        BOOST_REQUIRE_EQUAL(other->get_min_timestamp_for_token(keys[0].token(), stat).value(), api::timestamp_type(10));
+        BOOST_REQUIRE_EQUAL(other->get_min_timestamp_for_token(keys[1].token(), stat).value(), api::max_timestamp);
+        BOOST_REQUIRE_EQUAL(other->get_min_timestamp_for_token(keys[2].token(), stat).value(), api::timestamp_type(100));
+
+        auto deletes = make_sstable_containing(sst_gen, {make_delete(keys[0], 50), make_delete(keys[1], 50), make_delete(keys[2], 50)}).get();
+
+        auto cf = env.make_table_for_tests(s);
+        auto close_cf = deferred_stop(cf);
+        column_family_test(cf).add_sstable(other).get();
+        column_family_test(cf).add_sstable(deletes).get();
+
+        // Only the tombstone which may shadow data in the other sstable is kept,
+        // even though the other sstable as a whole holds data older than all of them.
+        auto ret = compact_sstables(env, compaction::compaction_descriptor({deletes}), cf, sst_gen).get();
+        BOOST_REQUIRE_EQUAL(ret.new_sstables.size(), 1u);
+        assert_that(sstable_reader(ret.new_sstables[0], s, env.make_reader_permit()))
+                .produces(make_delete(keys[0], 50))
+                .produces_end_of_stream();
+    });
+}
+
+SEASTAR_TEST_CASE(test_read_fanout_tracker) {
+    compaction::read_fanout_tracker tracker;
+    const auto full_range = dht::token_range::make_open_ended_both_sides();
+    const auto now = lowres_clock::now();
+    const auto t = dht::token::from_int64(42);
+
+    BOOST_REQUIRE(!tracker.record(full_range, t, 3, now));
+    BOOST_REQUIRE(!tracker.record(full_range, t, 3, now));
+    BOOST_REQUIRE(!tracker.take_hottest_range(3, now));
+    BOOST_REQUIRE(tracker.record(full_range, t, 3, now));
+    // Reads of other segments don't make it hotter.
+    BOOST_REQUIRE(!tracker.record(full_range, dht::token::from_int64(std::numeric_limits<int64_t>::min() + 1), 3, now));
+
+    auto hot = tracker.take_hottest_range(3, now);
+    BOOST_REQUIRE(hot);
+    BOOST_REQUIRE(hot->contains(t, dht::token_comparator()));
+    BOOST_REQUIRE(!hot->contains(dht::token::from_int64(std::numeric_limits<int64_t>::max()), dht::token_comparator()));
+    BOOST_REQUIRE(!tracker.take_hottest_range(3, now));
+
+    // The counts decay, so sporadic reads don't make a range hot.
+    for (int i = 0; i < 4; ++i) {
+        tracker.record(full_range, t, 3, now);
+    }
+    BOOST_REQUIRE(!tracker.take_hottest_range(3, now + 2 * compaction::read_fanout_tracker::decay_period));
+
+    // The segments follow the range of the group.
+    const auto range = dht::token_range::make(dht::token::from_int64(0), dht::token::from_int64(6399));
+    for (int i = 0; i < 3; ++i) {
+        tracker.record(range, dht::token::from_int64(150), 3, now);
+    }
+    hot = tracker.take_hottest_range(3, now);
+    BOOST_REQUIRE(hot);
+    BOOST_REQUIRE(hot->equal(dht::token_range::make(dht::token::from_int64(100), dht::token::from_int64(199)), dht::token_comparator()));
+    return make_ready_future<>();
+}
+
+SEASTAR_TEST_CASE(test_compaction_planner) {
+    using compaction::compaction_job_estimate;
+    constexpr uint64_t MB = 1 << 20;
+
+    // Compacting many small sstables removes more of them from reads per byte than compacting a few large ones.
+    auto small_runs = compaction_job_estimate{.input_bytes = 32 * MB, .fan_in = 32};
+    auto large_runs = compaction_job_estimate{.input_bytes = 4096 * MB, .fan_in = 4};
+    BOOST_REQUIRE_GT(small_runs.benefit_per_byte(), large_runs.benefit_per_byte());
+    // Reclaimable space makes a job more beneficial.
+    auto expired = large_runs;
+    expired.reclaimable_bytes = 2048 * MB;
+    BOOST_REQUIRE_GT(expired.benefit_per_byte(), large_runs.benefit_per_byte());
+    BOOST_REQUIRE_EQUAL(compaction_job_estimate{}.benefit_per_byte(), 0);
+
+    compaction::compaction_io_budget budget;
+    BOOST_REQUIRE(budget.try_reserve(600 * MB, 1000 * MB));
+    BOOST_REQUIRE(budget.try_reserve(400 * MB, 1000 * MB));
+    BOOST_REQUIRE(!budget.try_reserve(1, 1000 * MB));
+    budget.release(400 * MB);
+    BOOST_REQUIRE(!budget.try_reserve(500 * MB, 1000 * MB));
+    BOOST_REQUIRE(budget.try_reserve(100 * MB, 1000 * MB));
+    budget.release(700 * MB);
+    BOOST_REQUIRE_EQUAL(budget.in_flight(), 0);
+    // A job larger than the whole budget runs alone.
+    BOOST_REQUIRE(budget.try_reserve(5000 * MB, 1000 * MB));
+    BOOST_REQUIRE(!budget.try_reserve(1, 1000 * MB));
+    return make_ready_future<>();
+}
+
+SEASTAR_TEST_CASE(test_hot_range_compaction) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto keys = ss.make_pkeys(512);
+        auto sst_gen = env.make_sst_factory(s);
+
+        auto make_sstable = [&] (size_t begin, size_t end, size_t value_size) {
+            utils::chunked_vector<mutation> muts;
+            for (size_t i = begin; i < end; ++i) {
+                auto m = mutation(s, keys[i]);
+                ss.add_row(m, ss.make_ckey(0), sstring(value_size, 'v'));
+                muts.push_back(std::move(m));
+            }
+            return make_sstable_containing(sst_gen, std::move(muts)).get();
+        };
+        // Sizes far enough apart to be in different tiers.
+        auto small = make_sstable(0, 1, 16);
+        auto medium = make_sstable(256, 512, 64);
+        auto big = make_sstable(0, 256, 4096);
+
+        auto cf = env.make_table_for_tests(s);
+        auto close_cf = deferred_stop(cf);
+        auto& table_s = cf.as_compaction_group_view();
+        std::vector<shared_sstable> candidates = {small, medium, big};
+
+        auto cs = compaction::make_compaction_strategy(compaction::compaction_strategy_type::size_tiered, {{"min_sstable_size", "1"}});
+        auto descriptor = get_sstables_for_compaction(cs, table_s, candidates).get();
+        BOOST_REQUIRE(descriptor.sstables.empty());
+
+        // Reads of the first key touch both the small and the big sstable.
+        compaction::read_fanout_tracker tracker;
+        tracker.record(table_s.token_range(), keys[0].token(), 1);
+        strategy_control_for_test control(false, candidates, tracker.take_hottest_range(1));
+        descriptor = cs.get_sstables_for_compaction(table_s, control).get();
+        BOOST_REQUIRE_EQUAL(descriptor.sstables.size(), 2u);
+        BOOST_REQUIRE(std::ranges::contains(descriptor.sstables, small));
+        BOOST_REQUIRE(std::ranges::contains(descriptor.sstables, big));
+
+        // The hot range was taken by the strategy.
+        descriptor = cs.get_sstables_for_compaction(table_s, control).get();
+        BOOST_REQUIRE(descriptor.sstables.empty());
+    });
+}
+
+SEASTAR_TEST_CASE(test_repair_hash_summary) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto keys = ss.make_pkeys(8);
+        auto sst_gen = env.make_sst_factory(s);
+
+        auto make_mutation = [&] (const dht::decorated_key& key, api::timestamp_type ts) {
+            auto m = mutation(s, key);
+            ss.add_static_row(m, "s", ts);
+            ss.add_row(m, ss.make_ckey(0), "v", ts);
+            ss.delete_range(m, ss.make_ckey_range(1, 2), tombstone(ts, gc_clock::now()));
+            return m;
+        };
+        auto make_mutations = [&] (size_t first, size_t last, api::timestamp_type ts) {
+            utils::chunked_vector<mutation> muts;
+            for (size_t i = first; i < last; ++i) {
+                muts.push_back(make_mutation(keys[i], ts));
+            }
+            return muts;
+        };
+
+        auto without_summary = make_sstable_containing(sst_gen, make_mutations(0, keys.size(), 1)).get();
+        BOOST_REQUIRE(!without_summary->get_scylla_metadata()->get_repair_hash_summary());
+
+        env.db_config().enable_sstable_repair_hash_summary.set(true);
+        auto first_half = make_sstable_containing(sst_gen, make_mutations(0, keys.size() / 2, 1)).get();
+        auto second_half = make_sstable_containing(sst_gen, make_mutations(keys.size() / 2, keys.size(), 1)).get();
+        auto whole = make_sstable_containing(sst_gen, make_mutations(0, keys.size(), 1)).get();
+        auto newer = make_sstable_containing(sst_gen, make_mutations(0, keys.size(), 2)).get();
+        const auto* summary = whole->get_scylla_metadata()->get_repair_hash_summary();
+        BOOST_REQUIRE(summary);
+        BOOST_REQUIRE_LE(summary->buckets.elements.size(), sstables::repair_hash_summary_tracker::max_buckets);
+
+        const auto full_range = dht::token_range::make_open_ended_both_sides();
+        const auto split_token = dht::last_token_of_compaction_group(1, 0);
+        const auto left_range = dht::token_range::make_ending_with({split_token, true});
+        const auto right_range = dht::token_range::make_starting_with({split_token, false});
+
+        for (const auto& range : {full_range, left_range, right_range}) {
+            auto split = sstables::get_repair_hash_digest({first_half, second_half}, range, *s);
+            auto merged = sstables::get_repair_hash_digest({whole}, range, *s);
+            BOOST_REQUIRE(split && merged);
+            BOOST_REQUIRE(*split == *merged);
+        }
+        auto full = sstables::get_repair_hash_digest({whole}, full_range, *s).value();
+        auto left = sstables::get_repair_hash_digest({whole}, left_range, *s).value();
+        auto right = sstables::get_repair_hash_digest({whole}, right_range, *s).value();
+        BOOST_REQUIRE_EQUAL(full.fragments, left.fragments + right.fragments);
+        BOOST_REQUIRE_EQUAL(full.hash, left.hash + right.hash);
+        // A static row, a clustering row and a range tombstone per partition.
+        BOOST_REQUIRE_EQUAL(full.fragments, keys.size() * 3);
+
+        BOOST_REQUIRE(sstables::get_repair_hash_digest({newer}, full_range, *s).value() != full);
+        // Not a bucket of the ring.
+        BOOST_REQUIRE(!sstables::get_repair_hash_digest({whole}, dht::token_range::make_ending_with({keys[3].token(), true}), *s));
+        BOOST_REQUIRE(!sstables::get_repair_hash_digest({whole, without_summary}, full_range, *s));
+
+        // Range tombstones written to different sstables, with the same bounds
+        // but covering different ranges: {[1,4]@1, [3,6]@2} and {[1,6]@1, [3,4]@2}.
+        const auto deletion_time = gc_clock::now();
+        auto make_range_tombstone_sstable = [&] (uint32_t start, uint32_t end, api::timestamp_type ts) {
+            auto m = mutation(s, keys[0]);
+            ss.delete_range(m, ss.make_ckey_range(start, end), tombstone(ts, deletion_time));
+            return make_sstable_containing(sst_gen, {std::move(m)}).get();
+        };
+        auto overlapping = sstables::get_repair_hash_digest({make_range_tombstone_sstable(1, 4, 1), make_range_tombstone_sstable(3, 6, 2)}, full_range, *s);
+        auto nested = sstables::get_repair_hash_digest({make_range_tombstone_sstable(1, 6, 1), make_range_tombstone_sstable(3, 4, 2)}, full_range, *s);
+        BOOST_REQUIRE(overlapping && nested);
+        BOOST_REQUIRE(*overlapping != *nested);
+    });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -764,6 +764,54 @@ SEASTAR_TEST_CASE(test_skipping_in_compressed_stream) {
     });
 }
 
+SEASTAR_TEST_CASE(test_compressed_stream_with_helper_shards) {
+    return seastar::async([] {
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+        tmpdir tmp;
+
+        compression_parameters cp({
+            { compression_parameters::SSTABLE_COMPRESSION, "LZ4Compressor" },
+            { compression_parameters::CHUNK_LENGTH_KB, "4" },
+        });
+
+        // Compressible data, of a size which isn't a multiple of the chunk length.
+        sstring data;
+        while (data.size() < 1024 * 1024) {
+            data += tests::random::get_sstring(tests::random::get_int<size_t>(1, 64)) + sstring(tests::random::get_int<size_t>(0, 512), 'x');
+        }
+
+        auto write = [&] (sstring name, sstables::compression& c, unsigned helper_shards) {
+            auto file_path = (tmp.path() / name).string();
+            auto f = open_file_dma(file_path, open_flags::create | open_flags::wo).get();
+            auto os = make_file_output_stream(f, file_output_stream_options()).get();
+            auto out = make_compressed_file_m_format_output_stream(std::move(os), &c, cp, make_lz4_sstable_compressor_for_tests(), helper_shards);
+            out.write(data.data(), data.size()).get();
+            out.close().get();
+            c.update(seastar::file_size(file_path).get());
+            return file_path;
+        };
+
+        sstables::compression c_local;
+        auto local_path = write("local", c_local, 0);
+        sstables::compression c_offloaded;
+        auto offloaded_path = write("offloaded", c_offloaded, smp::count - 1);
+
+        // Offloading compression must not change what is written.
+        BOOST_REQUIRE_EQUAL(c_local.compressed_file_length(), c_offloaded.compressed_file_length());
+        BOOST_REQUIRE_EQUAL(c_local.get_full_checksum(), c_offloaded.get_full_checksum());
+        BOOST_REQUIRE_EQUAL(c_local.offsets.size(), c_offloaded.offsets.size());
+
+        auto f = open_file_dma(offloaded_path, open_flags::ro).get();
+        auto stream_creator = [f] (uint64_t pos, uint64_t len, file_input_stream_options options) -> future<input_stream<char>> {
+            co_return input_stream<char>(make_file_data_source(std::move(f), pos, len, std::move(options)));
+        };
+        auto in = make_compressed_file_m_format_input_stream(stream_creator, &c_offloaded, 0, data.size(), {}, semaphore.make_permit(), std::nullopt);
+        auto close_in = deferred_close(in);
+        auto b = in.read_exactly(data.size()).get();
+        BOOST_REQUIRE(std::string_view(b.get(), b.size()) == std::string_view(data));
+    });
+}
+
 // Test that sstables::key_view::tri_compare(const schema& s, partition_key_view other)
 // should correctly compare empty keys. The fact we did this incorrectly was
 // noticed while fixing #9375, and a separate issue on it is #10178.
@@ -16,6 +16,7 @@
 #include "test/lib/cql_test_env.hh"
 #include "test/lib/cql_assertions.hh"
 #include "test/lib/eventually.hh"
+#include "test/lib/log.hh"
 #include "transport/messages/result_message.hh"
 #include "types/types.hh"
 #include "service/storage_proxy.hh"
@@ -142,6 +143,53 @@ SEASTAR_THREAD_TEST_CASE(test_split_stats) {
     stats2->register_metrics_for("DC1");
 }
 
+// Multi-partition reads at CL=ONE are grouped by replica and shard when they
+// touch at least multi_partition_read_batching_threshold partitions. Check that
+// the batched path returns the same rows, in the same order, as the regular one.
+SEASTAR_TEST_CASE(test_batched_multi_partition_read) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        e.execute_cql("CREATE TABLE tbl (pk int, ck int, v int, PRIMARY KEY (pk, ck))").get();
+        for (int pk = 0; pk < 20; ++pk) {
+            for (int ck = 0; ck < 3; ++ck) {
+                e.execute_cql(format("INSERT INTO tbl (pk, ck, v) VALUES ({}, {}, {})", pk, ck, pk * 10 + ck)).get();
+            }
+        }
+
+        auto row = [] (int pk, int ck) {
+            return std::vector<bytes_opt>{int32_type->decompose(pk), int32_type->decompose(ck), int32_type->decompose(pk * 10 + ck)};
+        };
+        const std::vector<std::pair<sstring, std::vector<std::vector<bytes_opt>>>> queries = {
+            {"SELECT pk, ck, v FROM tbl WHERE pk IN (13, 2, 7, 42, 19) AND ck = 1",
+                {row(2, 1), row(7, 1), row(13, 1), row(19, 1)}},
+            {"SELECT pk, ck, v FROM tbl WHERE pk IN (5, 11, 3) AND ck < 2",
+                {row(3, 0), row(3, 1), row(5, 0), row(5, 1), row(11, 0), row(11, 1)}},
+            {"SELECT pk, ck, v FROM tbl WHERE pk IN (5, 11, 3) LIMIT 4",
+                {row(3, 0), row(3, 1), row(3, 2), row(5, 0)}},
+            {"SELECT pk, ck, v FROM tbl WHERE pk IN (8, 42, 43)",
+                {row(8, 0), row(8, 1), row(8, 2)}},
+        };
+
+        // The test runs in the statement scheduling group, like the queries,
+        // so these are the coordinator stats the queries update.
+        auto& stats = e.get_storage_proxy().local().get_stats();
+        for (uint32_t threshold : {0u, 2u}) {
+            e.db_config().multi_partition_read_batching_threshold.set(threshold);
+            for (const auto& [query, expected] : queries) {
+                testlog.info("threshold={} query={}", threshold, query);
+                const auto batched_reads = stats.batched_reads;
+                const auto batched_read_partitions = stats.batched_read_partitions;
+                assert_that(e.execute_cql(query).get()).is_rows().with_rows(expected);
+                if (threshold) {
+                    BOOST_REQUIRE_GT(stats.batched_reads, batched_reads);
+                    BOOST_REQUIRE_GT(stats.batched_read_partitions, batched_read_partitions);
+                } else {
+                    BOOST_REQUIRE_EQUAL(stats.batched_reads, batched_reads);
+                }
+            }
+        }
+    });
+}
+
 SEASTAR_TEST_CASE(test_drop_table_during_range_scan) {
 #ifdef SCYLLA_ENABLE_ERROR_INJECTION
     return do_with_cql_env_thread([] (cql_test_env& e) {
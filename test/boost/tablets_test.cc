@@ -34,6 +34,8 @@
 
 #include "replica/tablets.hh"
 #include "replica/tablet_mutation_builder.hh"
+#include "replica/request_rate_tracker.hh"
+#include "service/tablet_balancer_snapshot.hh"
 #include "locator/tablets.hh"
 #include "service/tablet_allocator.hh"
 #include "locator/tablet_replication_strategy.hh"
@@ -348,6 +350,35 @@ SEASTAR_THREAD_TEST_CASE(test_tablet_id_map_cloning) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(test_tablet_map_cloning) {
+    auto h1 = host_id(utils::UUID_gen::get_time_UUID());
+    auto h2 = host_id(utils::UUID_gen::get_time_UUID());
+
+    tablet_map tmap(1024);
+    for (auto tid : tmap.tablet_ids()) {
+        tmap.set_tablet(tid, tablet_info{tablet_replica_set{tablet_replica{h1, 0}}});
+    }
+
+    auto clone = tmap.clone_gently().get();
+    BOOST_REQUIRE(clone == tmap);
+
+    auto last = tmap.last_tablet();
+    clone.set_tablet(last, tablet_info{tablet_replica_set{tablet_replica{h2, 1}}});
+    BOOST_REQUIRE(clone != tmap);
+    BOOST_REQUIRE(tmap.get_tablet_info(last).replicas == tablet_replica_set{tablet_replica{h1, 0}});
+    BOOST_REQUIRE(clone.get_tablet_info(last).replicas == tablet_replica_set{tablet_replica{h2, 1}});
+
+    // Only the chunk of the modified tablet is copied.
+    BOOST_REQUIRE_EQUAL(&clone.get_tablet_info(tmap.first_tablet()), &tmap.get_tablet_info(tmap.first_tablet()));
+    BOOST_REQUIRE_NE(&clone.get_tablet_info(last), &tmap.get_tablet_info(last));
+    const auto chunk_size = tablet_map::tablet_container::max_chunk_capacity();
+    const auto chunks = (tmap.tablet_count() + chunk_size - 1) / chunk_size;
+    BOOST_REQUIRE_EQUAL(clone.tablets().shared_chunks(tmap.tablets()), chunks - 1);
+
+    clone.clear_gently().get();
+    tmap.clear_gently().get();
+}
+
 SEASTAR_TEST_CASE(test_tablet_metadata_persistence) {
     return do_with_cql_env_thread([] (cql_test_env& e) {
         auto h1 = host_id(utils::UUID_gen::get_time_UUID());
@@ -5160,6 +5191,270 @@ SEASTAR_THREAD_TEST_CASE(test_load_balancer_does_not_balance_with_missing_tablet
     }).get();
 }
 
+SEASTAR_THREAD_TEST_CASE(test_load_balancing_with_request_rates) {
+    do_with_cql_env_thread([] (auto& e) {
+        scoped_logger_level lb_log("load_balancer", seastar::log_level::debug);
+
+        topology_builder topo(e);
+        auto host1 = topo.add_node(node_state::normal, 1);
+        auto host2 = topo.add_node(node_state::normal, 1);
+
+        auto ks_name = add_keyspace(e, {{topo.dc(), 1}}, 1);
+        auto table1 = add_table(e, ks_name).get();
+
+        // Tablets of equal size, the ones on host1 receiving most of the requests.
+        const size_t tablet_count = 8;
+        mutate_tablets(e, [&] (tablet_metadata& tmeta) -> future<> {
+            tablet_map tmap(tablet_count);
+            for (auto tid : tmap.tablet_ids()) {
+                tmap.set_tablet(tid, tablet_info {
+                    tablet_replica_set {tablet_replica {size_t(tid) % 2 ? host2 : host1, 0}}
+                });
+            }
+            tmeta.set_tablet_map(table1, std::move(tmap));
+            co_return;
+        });
+
+        auto& stm = e.shared_token_metadata().local();
+        auto& stats = topo.get_shared_load_stats();
+        stats.set_capacity(host1, 100 * service::default_target_tablet_size);
+        stats.set_capacity(host2, 100 * service::default_target_tablet_size);
+        stats.set_tablet_sizes(stm.get(), table1, service::default_target_tablet_size);
+
+        std::unordered_map<dht::token_range, double> reads;
+        {
+            auto& tmap = stm.get()->tablets().get_tablet_map(table1);
+            for (auto tid : tmap.tablet_ids()) {
+                auto range = tmap.get_token_range(tid);
+                auto host = tmap.get_tablet_info(tid).replicas[0].host;
+                reads[range] = host == host1 ? 1000 : 10;
+                stats.stats.request_stats[host].tablet_rates[table1][range] = tablet_request_rate{reads[range], 0};
+            }
+        }
+
+        auto reads_per_host = [&] {
+            std::unordered_map<host_id, double> result;
+            auto& tmap = stm.get()->tablets().get_tablet_map(table1);
+            for (auto tid : tmap.tablet_ids()) {
+                result[tmap.get_tablet_info(tid).replicas[0].host] += reads[tmap.get_token_range(tid)];
+            }
+            return result;
+        };
+
+        // Storage is balanced, so no tablet moves if only storage is balanced.
+        e.db_config().tablet_load_balancing_request_rate_weight.set(0);
+        BOOST_REQUIRE(e.get_tablet_allocator().local().balance_tablets(stm.get(), nullptr, nullptr, stats.get()).get().empty());
+
+        e.db_config().tablet_load_balancing_request_rate_weight.set(0.5);
+        rebalance_tablets(e, &stats);
+        auto balanced_reads = reads_per_host();
+        testlog.info("Reads per host: {} {}", balanced_reads[host1], balanced_reads[host2]);
+        BOOST_REQUIRE_GE(balanced_reads[host2], 1000);
+        BOOST_REQUIRE_LT(balanced_reads[host1], 4000);
+
+        // The rates moved along with the tablets. Fluctuations of the rates smaller
+        // than the hysteresis do not move tablets back.
+        for (auto& [host, trs] : stats.stats.request_stats) {
+            for (auto& [range, rate] : trs.tablet_rates[table1]) {
+                BOOST_REQUIRE_EQUAL(rate.reads, reads[range]);
+                rate.reads *= host == host1 ? 0.97 : 1.03;
+            }
+        }
+        BOOST_REQUIRE(e.get_tablet_allocator().local().balance_tablets(stm.get(), nullptr, nullptr, stats.get()).get().empty());
+    }).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_load_driven_split_and_merge) {
+    do_with_cql_env_thread([] (auto& e) {
+        scoped_logger_level lb_log("load_balancer", seastar::log_level::debug);
+
+        topology_builder topo(e);
+        auto host1 = topo.add_node(node_state::normal, 1);
+
+        const size_t initial_tablets = 2;
+        auto ks_name = add_keyspace(e, {{topo.dc(), 1}}, initial_tablets);
+        auto table1 = add_table(e, ks_name, {{"pow2_count", "false"}}).get();
+
+        auto& stm = e.shared_token_metadata().local();
+        auto& stats = topo.get_shared_load_stats();
+        // Small enough for the sizes alone to allow a merge down to the initial tablet count.
+        stats.set_tablet_sizes(stm.get(), table1, 1);
+
+        auto tablet_count = [&] {
+            return stm.get()->tablets().get_tablet_map(table1).tablet_count();
+        };
+
+        // The first tablet is hot, and most of its requests go to the first half of its range.
+        const auto median_token = dht::token::from_int64(std::numeric_limits<int64_t>::min() / 2);
+        const dht::token first_tablet_last_token = stm.get()->tablets().get_tablet_map(table1).get_last_token(tablet_id(0));
+        auto set_rates = [&] (double first_tablet_reads, double other_reads) {
+            auto& tmap = stm.get()->tablets().get_tablet_map(table1);
+            auto& rates = stats.stats.request_stats[host1].tablet_rates[table1];
+            rates.clear();
+            for (auto tid : tmap.tablet_ids()) {
+                auto range = tmap.get_token_range(tid);
+                if (tid == tablet_id(0)) {
+                    rates[range] = tablet_request_rate{first_tablet_reads, 0, median_token};
+                } else {
+                    rates[range] = tablet_request_rate{other_reads, 0, std::nullopt};
+                }
+            }
+        };
+        set_rates(1000, 10);
+
+        // The hot tablet is not split as long as request rates do not drive resizing.
+        rebalance_tablets(e, &stats);
+        BOOST_REQUIRE_EQUAL(tablet_count(), initial_tablets);
+
+        // The hot tablet is split at its median token, the others at their midpoints.
+        e.db_config().tablet_split_request_rate_threshold.set(500);
+        rebalance_tablets(e, &stats);
+        BOOST_REQUIRE_EQUAL(tablet_count(), initial_tablets * 2);
+        {
+            auto& tmap = stm.get()->tablets().get_tablet_map(table1);
+            BOOST_REQUIRE_EQUAL(tmap.get_last_token(tablet_id(0)), median_token);
+            BOOST_REQUIRE_EQUAL(tmap.get_last_token(tablet_id(1)), first_tablet_last_token);
+            BOOST_REQUIRE(tmap.resize_decision().is_none());
+        }
+
+        // The halves of the hot tablet got half of its requests each. They are below the
+        // threshold, but still too hot to be merged back.
+        rebalance_tablets(e, &stats);
+        BOOST_REQUIRE_EQUAL(tablet_count(), initial_tablets * 2);
+
+        // Once the load cools down, the tablets are merged back.
+        set_rates(10, 10);
+        rebalance_tablets(e, &stats);
+        BOOST_REQUIRE_EQUAL(tablet_count(), initial_tablets);
+        BOOST_REQUIRE_EQUAL(stm.get()->tablets().get_tablet_map(table1).get_last_token(tablet_id(0)), first_tablet_last_token);
+    }).get();
+}
+
+// Split tokens can't be persisted in system.tablets before all nodes know the
+// column, so hot tablets are split at their midpoints until then.
+SEASTAR_THREAD_TEST_CASE(test_load_driven_split_without_split_tokens_feature) {
+    cql_test_config cfg{};
+    cfg.disabled_features.insert("TABLET_SPLIT_TOKENS");
+    do_with_cql_env_thread([] (auto& e) {
+        topology_builder topo(e);
+        auto host1 = topo.add_node(node_state::normal, 1);
+
+        const size_t initial_tablets = 2;
+        auto ks_name = add_keyspace(e, {{topo.dc(), 1}}, initial_tablets);
+        auto table1 = add_table(e, ks_name, {{"pow2_count", "false"}}).get();
+
+        auto& stm = e.shared_token_metadata().local();
+        auto& stats = topo.get_shared_load_stats();
+        stats.set_tablet_sizes(stm.get(), table1, 1);
+
+        const auto median_token = dht::token::from_int64(std::numeric_limits<int64_t>::min() / 2);
+        const auto midpoint = stm.get()->tablets().get_tablet_map(table1).get_split_token(tablet_id(0));
+        BOOST_REQUIRE_NE(median_token, midpoint);
+        auto& tmap = stm.get()->tablets().get_tablet_map(table1);
+        for (auto tid : tmap.tablet_ids()) {
+            stats.stats.request_stats[host1].tablet_rates[table1][tmap.get_token_range(tid)] =
+                    tablet_request_rate{tid == tablet_id(0) ? 1000.0 : 10.0, 0, tid == tablet_id(0) ? std::make_optional(median_token) : std::nullopt};
+        }
+
+        e.db_config().tablet_split_request_rate_threshold.set(500);
+        rebalance_tablets(e, &stats);
+        auto& new_tmap = stm.get()->tablets().get_tablet_map(table1);
+        BOOST_REQUIRE_EQUAL(new_tmap.tablet_count(), initial_tablets * 2);
+        BOOST_REQUIRE_EQUAL(new_tmap.get_last_token(tablet_id(0)), midpoint);
+    }, cfg).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_request_rate_tracker_median_token) {
+    const auto now = lowres_clock::now();
+    replica::request_rate_tracker tracker(now);
+    const auto range = dht::token_range::make({dht::token::from_int64(0), false}, {dht::token::from_int64(1600), true});
+
+    BOOST_REQUIRE(!tracker.get_rate(range, now).median_token);
+
+    // 3/4 of the requests go to the first of the 16 segments of the range.
+    for (int i = 0; i < 300; ++i) {
+        tracker.note_read();
+        tracker.note_token(range, dht::token::from_int64(50));
+    }
+    for (int i = 0; i < 100; ++i) {
+        tracker.note_write();
+        tracker.note_token(range, dht::token::from_int64(1550));
+    }
+    auto rate = tracker.get_rate(range, now + std::chrono::seconds(10));
+    BOOST_REQUIRE_GT(rate.reads, rate.writes);
+    BOOST_REQUIRE(rate.median_token);
+    testlog.info("Median token: {}", *rate.median_token);
+    BOOST_REQUIRE(range.contains(*rate.median_token, dht::token_comparator()));
+    BOOST_REQUIRE_LT(*rate.median_token, dht::token::from_int64(100));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_tablet_balancer_snapshot_round_trip) {
+    do_with_cql_env_thread([] (auto& e) {
+        topology_builder topo(e);
+        auto host1 = topo.add_node(node_state::normal, 2);
+        auto host2 = topo.add_node(node_state::normal, 2);
+
+        auto ks_name = add_keyspace(e, {{topo.dc(), 2}}, 4);
+        auto table1 = add_table(e, ks_name).get();
+
+        auto& stm = e.shared_token_metadata().local();
+        auto& stats = topo.get_shared_load_stats();
+        stats.set_tablet_sizes(stm.get(), table1, 100);
+        auto& tmap = stm.get()->tablets().get_tablet_map(table1);
+        const locator::range_based_tablet_id first_tablet{table1, tmap.get_token_range(tablet_id(0))};
+        stats.stats.request_stats[host1].tablet_rates[table1][first_tablet.range] = tablet_request_rate{10, 20, std::nullopt};
+
+        auto snapshot = make_tablet_balancer_snapshot(*stm.get(), stats.stats, e.local_db()).get();
+        auto text = rjson::print(tablet_balancer_snapshot_to_json(snapshot).get());
+        testlog.debug("Snapshot: {}", text);
+        auto restored = tablet_balancer_snapshot_from_json(rjson::parse(text));
+
+        for (auto host : {host1, host2}) {
+            auto it = std::ranges::find(restored.nodes, host, &tablet_balancer_snapshot::node::id);
+            BOOST_REQUIRE(it != restored.nodes.end());
+            BOOST_REQUIRE(it->dc_rack == topo.rack());
+            BOOST_REQUIRE_EQUAL(it->shard_count, 2);
+            BOOST_REQUIRE(it->capacity == stats.stats.capacity.at(host));
+        }
+
+        auto ks = std::ranges::find(restored.keyspaces, ks_name, &tablet_balancer_snapshot::keyspace::name);
+        BOOST_REQUIRE(ks != restored.keyspaces.end());
+        BOOST_REQUIRE(ks->replication == snapshot.keyspaces[std::distance(restored.keyspaces.begin(), ks)].replication);
+
+        auto t = std::ranges::find(restored.tables, table1, &tablet_balancer_snapshot::table::id);
+        BOOST_REQUIRE(t != restored.tables.end());
+        BOOST_REQUIRE_EQUAL(t->keyspace, ks_name);
+        BOOST_REQUIRE(!t->base_table);
+        BOOST_REQUIRE_EQUAL(t->tablets.size(), tmap.tablet_count());
+        for (auto tid : tmap.tablet_ids()) {
+            const auto& tablet = t->tablets[tid.value()];
+            BOOST_REQUIRE_EQUAL(tablet.last_token, tmap.get_last_token(tid));
+            BOOST_REQUIRE_EQUAL(tablet.replicas.size(), 2);
+            for (const auto& r : tablet.replicas) {
+                BOOST_REQUIRE(contains(tmap.get_tablet_info(tid).replicas, r.replica));
+                BOOST_REQUIRE(r.size == 100);
+            }
+        }
+
+        // The load stats rebuilt from the snapshot are the ones it was taken with.
+        auto restored_stats = tablet_balancer_snapshot_load_stats(restored);
+        for (auto tid : tmap.tablet_ids()) {
+            for (const auto& r : tmap.get_tablet_info(tid).replicas) {
+                BOOST_REQUIRE(restored_stats.get_tablet_size(r.host, {table1, tmap.get_token_range(tid)}) == 100);
+            }
+        }
+        auto rate = restored_stats.get_tablet_request_rate(host1, first_tablet);
+        BOOST_REQUIRE(rate);
+        BOOST_REQUIRE_EQUAL(rate->reads, 10);
+        BOOST_REQUIRE_EQUAL(rate->writes, 20);
+        BOOST_REQUIRE_EQUAL(restored_stats.tables.at(table1).size_in_bytes, 100 * tmap.tablet_count());
+
+        auto bad_version = rjson::parse(text);
+        rjson::replace_with_string_name(bad_version, "version", rjson::value(tablet_balancer_snapshot::format_version + 1));
+        BOOST_REQUIRE_THROW(tablet_balancer_snapshot_from_json(bad_version), std::runtime_error);
+    }).get();
+}
+
 SEASTAR_THREAD_TEST_CASE(test_split_and_merge_of_colocated_tables) {
     do_with_cql_env_thread([] (auto& e) {
         scoped_logger_level lb_log("load_balancer", seastar::log_level::trace);
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2026-present ScyllaDB
+#
+# SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+#
+
+import asyncio
+import logging
+import pytest
+import time
+
+from cassandra.protocol import InvalidRequest
+from cassandra.query import SimpleStatement, ConsistencyLevel
+
+from test.pylib.manager_client import ManagerClient
+from test.pylib.util import wait_for
+from test.cluster.util import reconnect_driver, new_test_keyspace
+
+logger = logging.getLogger(__name__)
+
+HOUR_US = 3600 * 1000 * 1000
+
+
+async def get_registry_entries(cql, table_id):
+    """Return the set of (status, generation) of the sstables of the table in the registry.
+
+    Only the sstables offloaded to object storage are tracked in the registry,
+    the local ones live in the table's directory.
+    """
+    res = await cql.run_async(SimpleStatement("SELECT * FROM system.sstables", consistency_level=ConsistencyLevel.ONE))
+    return {(row.status, row.generation) for row in res if row.table_id == table_id}
+
+
+async def get_table_id(cql, ks, table):
+    rows = await cql.run_async(f"SELECT id FROM system_schema.tables WHERE keyspace_name = '{ks}' AND table_name = '{table}'")
+    return rows[0].id
+
+
+async def insert_window(cql, ks, keys, timestamp):
+    await asyncio.gather(*[cql.run_async(f"INSERT INTO {ks}.test (pk, c) VALUES ({k}, {k}) USING TIMESTAMP {timestamp}")
+                           for k in keys])
+
+
+async def create_table_with_offloaded_windows(manager, server, ks, s3_storage, windows):
+    """Write `windows` one-hour windows to a TWCS table keeping the 2 most recent
+    windows on local storage, one sstable per window, and wait for the cold
+    windows to be offloaded to object storage by regular compaction.
+
+    Returns the table id, the registry entries of the offloaded sstables and
+    the timestamp of the most recent window.
+    """
+    cql = manager.get_cql()
+    await cql.run_async(f"CREATE TABLE {ks}.test (pk int PRIMARY KEY, c int) WITH compaction = {{"
+                        "'class': 'TimeWindowCompactionStrategy', 'compaction_window_unit': 'HOURS', 'compaction_window_size': 1, "
+                        "'offload_after_windows': 2, "
+                        f"'offload_storage_endpoint': '{s3_storage.address}', 'offload_storage_bucket': '{s3_storage.bucket_name}'}}")
+    table_id = await get_table_id(cql, ks, "test")
+
+    now = int(time.time()) * 1000 * 1000
+    for w in range(windows):
+        await insert_window(cql, ks, range(w * 10, w * 10 + 10), now - (windows - 1 - w) * HOUR_US)
+        await manager.api.keyspace_flush(server.ip_addr, ks, "test")
+
+    async def cold_windows_offloaded():
+        entries = await get_registry_entries(cql, table_id)
+        return entries if len([gen for status, gen in entries if status == 'sealed']) >= windows - 2 else None
+    offloaded = await wait_for(cold_windows_offloaded, time.time() + 60)
+    logger.info(f"Offloaded sstables: {offloaded}")
+    return table_id, offloaded, now
+
+
+def offload_config(s3_storage, **kwargs):
+    return {
+        'object_storage_endpoints': s3_storage.create_endpoint_conf(),
+        'experimental_features': ['keyspace-storage-options'],
+        **kwargs,
+    }
+
+
+async def test_twcs_offload_cold_windows(manager: ManagerClient, s3_storage):
+    """
+    1. Write 6 one-hour windows to a TWCS table keeping the 2 most recent
+       windows on local storage, one sstable per window.
+    2. Wait for the 4 cold windows to be offloaded to object storage by regular compaction.
+    3. Write more data to a cold window, and run a major compaction over the
+       mix of local and offloaded sstables. Offloaded sstables are not
+       compacted together with local ones, so they must survive it.
+    4. Restart the node, so offloaded sstables are loaded back from object storage.
+    """
+    server = await manager.server_add(config=offload_config(s3_storage))
+    cql = manager.get_cql()
+
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 1} AND tablets = {'initial': 1}") as ks:
+        windows = 6
+        table_id, offloaded, now = await create_table_with_offloaded_windows(manager, server, ks, s3_storage, windows)
+
+        async def count_rows(cql):
+            res = await cql.run_async(f"SELECT count(*) FROM {ks}.test")
+            return res[0].count
+
+        assert await count_rows(cql) == windows * 10
+
+        # Data added to a cold window lands in a local sstable, so the major
+        # compaction takes both local and offloaded sstables.
+        await insert_window(cql, ks, range(100, 110), now - (windows - 1) * HOUR_US)
+        await manager.api.keyspace_flush(server.ip_addr, ks, "test")
+        await manager.api.keyspace_compaction(server.ip_addr, ks, "test")
+
+        entries = await get_registry_entries(cql, table_id)
+        assert {gen for status, gen in offloaded} <= {gen for status, gen in entries if status == 'sealed'}
+        assert await count_rows(cql) == windows * 10 + 10
+
+        await manager.server_restart(server.server_id)
+        cql = await reconnect_driver(manager)
+
+        entries = await get_registry_entries(cql, table_id)
+        assert all(status == 'sealed' for status, gen in entries), f"Unexpected registry entries after restart: {entries}"
+        assert {gen for status, gen in offloaded} <= {gen for status, gen in entries}
+        assert await count_rows(cql) == windows * 10 + 10
+
+
+async def test_twcs_offload_snapshot(manager: ManagerClient, s3_storage):
+    """
+    Snapshotting sstables on object storage is not implemented, so a snapshot
+    of a table with offloaded windows, taken by nodetool snapshot or by DROP
+    with auto_snapshot, includes only its local sstables.
+    """
+    server = await manager.server_add(config=offload_config(s3_storage, auto_snapshot=True))
+    cql = manager.get_cql()
+    log = await manager.server_open_log(server.server_id)
+
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 1} AND tablets = {'initial': 1}") as ks:
+        await create_table_with_offloaded_windows(manager, server, ks, s3_storage, 4)
+
+        mark = await log.mark()
+        await manager.api.take_snapshot(server.ip_addr, ks, "offloaded")
+        await log.wait_for(f"Snapshot of {ks}.test does not include [0-9]+ sstables offloaded to object storage", from_mark=mark)
+
+        mark = await log.mark()
+        await cql.run_async(f"DROP TABLE {ks}.test")
+        await log.wait_for(f"Snapshot of {ks}.test does not include [0-9]+ sstables offloaded to object storage", from_mark=mark)
+
+
+async def test_twcs_offload_alter_keeps_offload_storage(manager: ManagerClient, s3_storage):
+    """
+    Offloaded windows are found on boot through the offload storage options,
+    so ALTERs which would drop or change them are rejected. Offloading can be
+    stopped by setting offload_after_windows to 0.
+    """
+    server = await manager.server_add(config=offload_config(s3_storage))
+    cql = manager.get_cql()
+
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 1} AND tablets = {'initial': 1}") as ks:
+        windows = 4
+        await create_table_with_offloaded_windows(manager, server, ks, s3_storage, windows)
+
+        def twcs(offload_after_windows, bucket):
+            return ("{'class': 'TimeWindowCompactionStrategy', 'compaction_window_unit': 'HOURS', 'compaction_window_size': 1, "
+                    f"'offload_after_windows': {offload_after_windows}, "
+                    f"'offload_storage_endpoint': '{s3_storage.address}', 'offload_storage_bucket': '{bucket}'}}")
+
+        for compaction in ["{'class': 'SizeTieredCompactionStrategy'}",
+                           "{'class': 'TimeWindowCompactionStrategy', 'compaction_window_unit': 'HOURS', 'compaction_window_size': 1}",
+                           twcs(2, s3_storage.bucket_name + "-other")]:
+            with pytest.raises(InvalidRequest, match="may have windows offloaded"):
+                await cql.run_async(f"ALTER TABLE {ks}.test WITH compaction = {compaction}")
+
+        await cql.run_async(f"ALTER TABLE {ks}.test WITH compaction = {twcs(0, s3_storage.bucket_name)}")
+
+        await manager.server_restart(server.server_id)
+        cql = await reconnect_driver(manager)
+
+        res = await cql.run_async(f"SELECT count(*) FROM {ks}.test")
+        assert res[0].count == windows * 10
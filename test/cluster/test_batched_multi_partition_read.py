@@ -0,0 +1,56 @@
+#
+# Copyright (C) 2026-present ScyllaDB
+#
+# SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+#
+
+"""
+Test multi-partition reads which the coordinator batches into a single
+READ_DATA_BATCH request per replica, across the RPC path.
+"""
+
+from cassandra.cluster import ConsistencyLevel  # type: ignore
+from cassandra.query import SimpleStatement  # type: ignore
+
+from test.pylib.manager_client import ManagerClient
+from test.cluster.util import new_test_keyspace
+
+
+BATCHED_READS_METRIC = "scylla_storage_proxy_coordinator_batched_reads"
+REPLICA_READS_METRIC = "scylla_storage_proxy_replica_reads"
+
+
+async def get_metric(manager: ManagerClient, servers, name, labels = {}):
+    total = 0
+    for s in servers:
+        metrics = await manager.metrics.query(s.ip_addr)
+        total += metrics.get(name, labels) or 0
+    return total
+
+
+async def test_batched_multi_partition_read_over_rpc(manager: ManagerClient):
+    config = {"multi_partition_read_batching_threshold": 2}
+    servers = await manager.servers_add(3, config=config)
+    cql, hosts = await manager.get_ready_cql(servers)
+
+    # With RF=1, most partitions are owned by other nodes than the coordinator,
+    # so they are read over RPC.
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 1}") as ks:
+        await cql.run_async(f"CREATE TABLE {ks}.tbl (pk int, ck int, v int, PRIMARY KEY (pk, ck))")
+        n_partitions = 50
+        for pk in range(n_partitions):
+            for ck in range(3):
+                await cql.run_async(f"INSERT INTO {ks}.tbl (pk, ck, v) VALUES ({pk}, {ck}, {pk * 10 + ck})")
+
+        batched_reads_before = await get_metric(manager, servers, BATCHED_READS_METRIC)
+        replica_reads_before = await get_metric(manager, servers, REPLICA_READS_METRIC, {"op_type": "data_batch"})
+
+        keys = list(range(0, n_partitions + 10, 3))
+        stmt = SimpleStatement(f"SELECT pk, ck, v FROM {ks}.tbl WHERE pk IN ({', '.join(map(str, keys))}) AND ck = 1",
+                               consistency_level=ConsistencyLevel.ONE)
+        for host in hosts:
+            rows = await cql.run_async(stmt, host=host)
+            assert sorted((r.pk, r.ck, r.v) for r in rows) == [(pk, 1, pk * 10 + 1) for pk in keys if pk < n_partitions]
+
+        assert await get_metric(manager, servers, BATCHED_READS_METRIC) > batched_reads_before
+        assert await get_metric(manager, servers, REPLICA_READS_METRIC, {"op_type": "data_batch"}) > replica_reads_before
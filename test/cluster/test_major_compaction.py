@@ -7,10 +7,12 @@
 import pytest
 import logging
 import asyncio
+import time
 
 from test.pylib.manager_client import ManagerClient
 from test.pylib.rest_client import inject_error_one_shot
 from test.cluster.util import new_test_keyspace, reconnect_driver
+from test.pylib.util import wait_for
 
 logger = logging.getLogger(__name__)
 
@@ -284,3 +286,43 @@ async def test_disable_autocompaction_during_major_compaction(manager: ManagerCl
         await compaction_task
         await log.wait_for(f"Major {ks}.{cf} .* Compacted .*", from_mark=mark, timeout=30)
 
+
+@pytest.mark.skip_mode(mode='release', reason='error injections are not supported in release mode')
+async def test_major_compaction_io_budget(manager: ManagerClient):
+    """
+    Test that a major compaction holds bytes of the node-wide compaction I/O
+    budget while it runs, and returns them when it is done, even if the
+    budget was disabled in the meantime.
+    """
+    metric = "scylla_compaction_manager_io_budget_in_flight_bytes"
+    server = await manager.server_add(config={"compaction_disk_bandwidth_mb_per_sec": 1})
+    cf = "test_major_compaction_io_budget"
+    cql = manager.get_cql()
+
+    async def in_flight_bytes():
+        metrics = await manager.metrics.query(server.ip_addr)
+        return metrics.get(metric) or 0
+
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 1} AND tablets = {'initial': 1}") as ks:
+        await cql.run_async(f"CREATE TABLE {ks}.{cf} (pk int PRIMARY KEY)")
+        await disable_autocompaction_across_keyspaces(manager, server.ip_addr, ks)
+        await asyncio.gather(*[cql.run_async(f"INSERT INTO {ks}.{cf} (pk) VALUES ({k});") for k in range(100)])
+        await manager.api.keyspace_flush(server.ip_addr, ks, cf)
+
+        injection = "major_compaction_wait"
+        await manager.api.enable_injection(server.ip_addr, injection, True)
+        compaction_task = asyncio.create_task(manager.api.keyspace_compaction(server.ip_addr, ks, cf))
+        await manager.api.wait_for_injection_enter(server.ip_addr, injection)
+        assert await in_flight_bytes() > 0
+
+        log = await manager.server_open_log(server.server_id)
+        mark = await log.mark()
+        await manager.server_update_config(server.server_id, "compaction_disk_bandwidth_mb_per_sec", 0)
+        await log.wait_for(r"completed re-reading configuration file", from_mark=mark, timeout=60)
+
+        await manager.api.message_injection(server.ip_addr, injection)
+        await compaction_task
+
+        async def budget_released():
+            return await in_flight_bytes() == 0 or None
+        await wait_for(budget_released, time.time() + 30)
@@ -450,3 +450,51 @@ async def test_repair_rejects_equal_start_and_end_token(manager):
     with pytest.raises(HTTPError, match="Start and end tokens must be different"):
         await manager.api.client.post_json(f"/storage_service/repair_async/ks",
                                            host=servers[0].ip_addr, params=params)
+
+
+async def test_tablet_repair_skips_ranges_in_sync_by_hash_summaries(manager: ManagerClient):
+    """Verify that tablet repair skips the rows of a tablet whose replicas have
+    equal repair hash summaries, and falls back to row-level sync when one of
+    them has an sstable without a summary.
+    """
+    config = {'enable_sstable_repair_hash_summary': True}
+    servers = await manager.servers_add(2, config=config, auto_rack_dc="dc1")
+    cql = manager.get_cql()
+    hosts = await wait_for_cql_and_get_hosts(cql, servers, time.time() + 30)
+    logs = [await manager.server_open_log(s.server_id) for s in servers]
+
+    async def repair_and_get_stats(ks):
+        marks = [await log.mark() for log in logs]
+        await manager.api.tablet_repair(servers[0].ip_addr, ks, "test", "all")
+        stats = []
+        for log, mark in zip(logs, marks):
+            for line, match in await log.grep(r"repair\[.*\]: stats: .* round_nr=(\d+), .*range_nr_synced_by_hash_summaries=(\d+)", from_mark=mark):
+                stats.append((int(match.group(1)), int(match.group(2))))
+        assert len(stats) == 1, f"Expected the stats of a single tablet repair, got: {stats}"
+        return stats[0]
+
+    async def insert_and_flush(ks, keys):
+        await asyncio.gather(*[cql.run_async(SimpleStatement(f"INSERT INTO {ks}.test (pk, c) VALUES ({k}, {k})", consistency_level=ConsistencyLevel.ALL))
+                               for k in keys])
+        await asyncio.gather(*[manager.api.keyspace_flush(s.ip_addr, ks, "test") for s in servers])
+
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 2} AND tablets = {'initial': 1}") as ks:
+        await cql.run_async(f"CREATE TABLE {ks}.test (pk int PRIMARY KEY, c int)")
+        await insert_and_flush(ks, range(100))
+
+        # Both replicas have the same data, in sstables with summaries.
+        round_nr, synced_by_hash_summaries = await repair_and_get_stats(ks)
+        assert synced_by_hash_summaries == 1
+        assert round_nr == 0
+
+        # The data stays in sync, but the second replica writes it to an
+        # sstable without a summary, so its digest is unknown.
+        await cql.run_async("UPDATE system.config SET value = 'false' WHERE name = 'enable_sstable_repair_hash_summary'", host=hosts[1])
+        await insert_and_flush(ks, range(100, 200))
+
+        round_nr, synced_by_hash_summaries = await repair_and_get_stats(ks)
+        assert synced_by_hash_summaries == 0
+        assert round_nr > 0
+
+        rows = await cql.run_async(SimpleStatement(f"SELECT count(*) FROM {ks}.test", consistency_level=ConsistencyLevel.ALL))
+        assert rows[0].count == 200
@@ -6,6 +6,9 @@
 from collections import defaultdict
 from typing import Optional, Type
 from aiohttp.client_exceptions import ServerDisconnectedError
+from cassandra.protocol import EventMessage
+import cassandra.cqltypes
+import cassandra.protocol
 
 from test.pylib.manager_client import ManagerClient
 from test.pylib.rest_client import HTTPError, read_barrier
@@ -617,3 +620,56 @@ async def test_restart_in_cleanup_stage_after_cleanup(manager: ManagerClient):
         await await_api_task(move_task, allowed_exception=ServerDisconnectedError)
 
         await manager.api.quiesce_topology(servers[0].ip_addr)
+
+
+async def test_tablets_change_event(manager: ManagerClient, monkeypatch):
+    """
+    Verifies that a driver which registered for TABLETS_CHANGE events receives
+    the new routing of a migrated tablet, and that it receives it only once the
+    replicas of the tablet changed, not on the intermediate stages of the migration.
+    """
+    servers = await manager.servers_add(2, property_file=[{"dc": "dc1", "rack": "r1"}, {"dc": "dc1", "rack": "r1"}])
+    await manager.disable_tablet_balancing()
+    cql = manager.get_cql()
+
+    tablet_info_type = cassandra.cqltypes.lookup_casstype("TupleType(LongType, LongType, ListType(TupleType(UUIDType, Int32Type)))")
+
+    def recv_tablets_change(f, protocol_version):
+        change_type = cassandra.protocol.read_string(f)
+        keyspace = cassandra.protocol.read_string(f)
+        table = cassandra.protocol.read_string(f)
+        tablets = [tablet_info_type.from_binary(cassandra.protocol.read_binary_string(f), protocol_version)
+                   for _ in range(cassandra.protocol.read_int(f))]
+        return {"change_type": change_type, "keyspace": keyspace, "table": table, "tablets": tablets}
+
+    monkeypatch.setattr(cassandra.protocol, "known_event_types", cassandra.protocol.known_event_types.union(["TABLETS_CHANGE"]), raising=True)
+    monkeypatch.setattr(EventMessage, "recv_tablets_change", recv_tablets_change, raising=False)
+
+    received_events = []
+    cql.cluster.control_connection._connection.register_watchers({"TABLETS_CHANGE": received_events.append})
+
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 1} AND tablets = {'initial': 2}") as ks:
+        await cql.run_async(f"CREATE TABLE {ks}.test (pk int PRIMARY KEY, c int);")
+        await asyncio.gather(*[cql.run_async(f"INSERT INTO {ks}.test (pk, c) VALUES ({k}, {k});") for k in range(64)])
+
+        old_replica = await get_tablet_replica(manager, servers[0], ks, "test", 0)
+        new_host = next(h for h in [await manager.get_host_id(s.server_id) for s in servers] if h != old_replica[0])
+        logger.info(f"Move tablet {old_replica[0]} -> {new_host}")
+        await manager.api.move_tablet(servers[0].ip_addr, ks, "test", old_replica[0], old_replica[1], new_host, 0, 0)
+
+        def table_events():
+            return [e for e in received_events if e["keyspace"] == ks and e["table"] == "test"]
+
+        async def tablet_moved():
+            return table_events() or None
+        events = await wait_for(tablet_moved, time.time() + 60)
+
+        for e in events:
+            assert e["change_type"] == "UPDATE_TABLETS"
+            # Only the migrated tablet is sent, with its new replicas.
+            assert len(e["tablets"]) == 1
+            first_token, last_token, replicas = e["tablets"][0]
+            assert first_token < 0 <= last_token
+            assert [(str(host), shard) for host, shard in replicas] == [(str(new_host), 0)]
+        rows = await cql.run_async(f"SELECT count(*) FROM {ks}.test")
+        assert rows[0].count == 64
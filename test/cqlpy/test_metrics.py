@@ -29,3 +29,54 @@ def test_client_timestamp_drift_metric(cql, test_keyspace, scylla_only):
         after = count_after if count_after is not None else 0
         assert after >= before + 10, \
             f"Expected at least 10 new samples, got {after - before}"
+
+def lane_requests_served(cql, lane):
+    return ScyllaMetrics.query(cql).get('scylla_transport_lane_requests_served', {'lane': lane}) or 0
+
+def fast_lane_memory_available(cql):
+    return ScyllaMetrics.query(cql).get('scylla_transport_fast_lane_memory_available')
+
+# Test that small EXECUTE requests of prepared single-partition SELECTs, which
+# restrict the clustering key or have a LIMIT, are admitted through the fast
+# lane of the transport, while other requests go through the regular lane,
+# and that the memory of the fast lane is all given back, even when the
+# responses are larger than the admitted requests.
+def test_transport_fast_lane(cql, test_keyspace, scylla_only):
+    schema = 'p int, c int, v text, primary key (p, c)'
+    with new_test_table(cql, test_keyspace, schema) as table:
+        memory_available = fast_lane_memory_available(cql)
+
+        big_value = 'x' * 100000
+        insert = cql.prepare(f"INSERT INTO {table} (p, c, v) VALUES (?, ?, ?)")
+        for c in range(10):
+            cql.execute(insert, [1, c, big_value])
+
+        fast_before = lane_requests_served(cql, 'fast')
+        point_read = cql.prepare(f"SELECT * FROM {table} WHERE p = ? AND c = ?")
+        slice_read = cql.prepare(f"SELECT * FROM {table} WHERE p = ? AND c >= ?")
+        limited_read = cql.prepare(f"SELECT * FROM {table} WHERE p = ? LIMIT 2")
+        n = 20
+        for _ in range(n):
+            assert len(list(cql.execute(point_read, [1, 0]))) == 1
+            assert len(list(cql.execute(slice_read, [1, 0]))) == 10
+            assert len(list(cql.execute(limited_read, [1]))) == 2
+        assert lane_requests_served(cql, 'fast') >= fast_before + 3 * n
+
+        # Neither reads of whole partitions, nor range scans, nor filtering,
+        # nor writes take the fast lane.
+        fast_before = lane_requests_served(cql, 'fast')
+        regular_before = lane_requests_served(cql, 'regular')
+        partition_read = cql.prepare(f"SELECT * FROM {table} WHERE p = ?")
+        scan = cql.prepare(f"SELECT * FROM {table}")
+        filtering = cql.prepare(f"SELECT * FROM {table} WHERE p = ? AND v = ? ALLOW FILTERING")
+        for _ in range(n):
+            assert len(list(cql.execute(partition_read, [1]))) == 10
+            cql.execute(scan)
+            cql.execute(filtering, [1, 'y'])
+            cql.execute(insert, [2, 0, 'y'])
+        assert lane_requests_served(cql, 'fast') == fast_before
+        assert lane_requests_served(cql, 'regular') >= regular_before + 4 * n
+
+        # The responses of the point reads were much larger than what the
+        # fast lane admitted them with, yet all its memory is given back.
+        assert fast_lane_memory_available(cql) == memory_available
@@ -76,3 +76,20 @@ def test_page_size_0(cql, test_keyspace, scylla_only):
         # it's better to stick to the traditional page_size = 0.
         r = cql.execute(SimpleStatement(f'SELECT * FROM {table} WHERE p={p}', fetch_size=-1))
         assert len(r.current_rows) == nrows
+
+# Test that a large page, whose rows are streamed into the response instead
+# of being serialized into it upfront, is returned intact, including null
+# cells and values spanning several of the buffers the rows are streamed in.
+def test_large_page(cql, test_keyspace):
+    with new_test_table(cql, test_keyspace, 'p int, c int, s text, b blob, PRIMARY KEY (p, c)') as table:
+        stmt = cql.prepare(f'INSERT INTO {table} (p, c, s, b) VALUES (?, ?, ?, ?)')
+        p = 0
+        nrows = 20
+        expected = []
+        for c in range(nrows):
+            s = chr(ord('a') + c) * (c * 2000)
+            b = bytes([c]) * 20000 if c % 2 else None
+            cql.execute(stmt, [p, c, s, b])
+            expected.append((p, c, s, b))
+        r = cql.execute(SimpleStatement(f'SELECT p, c, s, b FROM {table} WHERE p={p}', fetch_size=nrows))
+        assert [(row.p, row.c, row.s, row.b) for row in r.current_rows] == expected
@@ -270,7 +270,7 @@ def test_scylla_sstable_dump_data_with_s3(skip_s3_tests, cql, test_keyspace, scy
     assert json.loads(out)
 
 
-@pytest.mark.parametrize("what", ["index", "compression-info", "summary", "statistics", "scylla-metadata"])
+@pytest.mark.parametrize("what", ["index", "compression-info", "summary", "statistics", "scylla-metadata", "compaction-strategy-metadata"])
 @pytest.mark.parametrize("which_sstables", [one_sstable, all_sstables])
 def test_scylla_sstable_dump_component(cql, test_keyspace, scylla_path, scylla_data_dir, what, which_sstables):
     with scylla_sstable(simple_clustering_table, cql, test_keyspace, scylla_data_dir) as (_, schema_file, sstables):
@@ -288,6 +288,12 @@ def test_scylla_sstable_dump_component(cql, test_keyspace, scylla_path, scylla_d
             assert "sharding" in sst_metadata, f"Expected 'sharding' metadata in sstable scylla-metadata: sstable={sst_name}: {sst_metadata}"
             assert sst_metadata["sharding"] != [], f"Expected non-empty sharding metadata in sstable scylla-metadata: sstable={sst_name}: {sst_metadata}"
 
+    if what == "compaction-strategy-metadata":
+        for sst_name, sst_metadata in json_out["sstables"].items():
+            assert sst_metadata["data_size"] > 0, f"Expected non-empty sstable: sstable={sst_name}: {sst_metadata}"
+            assert int(sst_metadata["first_token"]) <= int(sst_metadata["last_token"])
+            assert sst_metadata["min_timestamp"] <= sst_metadata["max_timestamp"]
+
 @pytest.mark.parametrize("table_factory", [
         simple_no_clustering_table,
         simple_clustering_table,
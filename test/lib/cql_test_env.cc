@@ -698,6 +698,11 @@ class single_node_cql_env : public cql_test_env {
                     .static_shares = cfg->compaction_static_shares,
                     .max_shares = cfg->compaction_max_shares,
                     .throughput_mb_per_sec = cfg->compaction_throughput_mb_per_sec,
+                    .foreground_latency_target_us = cfg->compaction_controller_foreground_latency_target_us,
+                    .hot_range_sstables_per_read = cfg->compaction_hot_range_sstables_per_read,
+                    .hot_range_reads = cfg->compaction_hot_range_reads,
+                    .slice_sstables_for_split = cfg->compaction_slice_sstables_for_split,
+                    .disk_bandwidth_mb_per_sec = cfg->compaction_disk_bandwidth_mb_per_sec,
                     .flush_all_tables_before_major = cfg->compaction_flush_all_tables_before_major_seconds() * 1s,
                 };
             });
@@ -99,6 +99,9 @@ class table_for_tests::compaction_group_view : public compaction::compaction_gro
     sstables::shared_sstable make_sstable(sstables::sstable_state, sstables::sstable_version_types version) const override {
         return table().make_sstable(sstables::sstable_state::normal, version);
     }
+    sstables::shared_sstable make_sstable(sstables::sstable_state, const data_dictionary::storage_options& storage_opts) const override {
+        return table().make_sstable(sstables::sstable_state::normal, table().get_sstables_manager().get_preferred_sstable_version(), storage_opts);
+    }
     sstables::sstable_writer_config configure_writer(sstring origin) const override {
         return _sstables_manager.configure_writer(std::move(origin));
     }
@@ -264,6 +267,8 @@ test_env::impl::impl(test_env_config cfg, sstable_compressor_factory& scfarg, ss
                 .data_file_directories = db_config->data_file_directories(),
                 .format = db_config->sstable_format,
                 .large_data_records_per_sstable = db_config->compaction_large_data_records_per_sstable,
+                .compaction_compression_helper_shards = db_config->compaction_compression_helper_shards,
+                .write_repair_hash_summary = db_config->enable_sstable_repair_hash_summary,
             },
             feature_service,
             cache_tracker,
@@ -22,6 +22,7 @@ int scylla_tablets_main(int argc, char**argv);
 std::function<int(int, char**)> alternator(std::function<int(int, char**)> scylla_main, std::function<future<>(lw_shared_ptr<db::config> cfg, sharded<abort_source>& as)>* after_init_func);
 int scylla_tablet_load_balancing_main(int argc, char**argv);
 int scylla_compaction_efficiency_main(int argc, char** argv);
+int scylla_compaction_simulator_main(int argc, char** argv);
 std::function<int(int, char**)> perf_cql_raw(std::function<int(int, char**)> scylla_main, std::function<future<>(lw_shared_ptr<db::config> cfg, sharded<abort_source>& as)>* after_init_func);
 
 } // namespace tools
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+// Helpers for reporting the results of the compaction benchmarks,
+// perf_compaction_efficiency and perf_compaction_simulator.
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <numeric>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+#include <json/json.h>
+
+// The samples of a metric, sorted to report their distribution.
+template <typename T>
+class sample_distribution {
+    std::vector<T> _sorted;
+public:
+    explicit sample_distribution(std::vector<T> samples)
+        : _sorted(std::move(samples)) {
+        std::ranges::sort(_sorted);
+    }
+
+    size_t size() const noexcept { return _sorted.size(); }
+    bool empty() const noexcept { return _sorted.empty(); }
+
+    // p is in [0, 100]. Returns 0 if there are no samples.
+    T percentile(double p) const {
+        if (_sorted.empty()) {
+            return 0;
+        }
+        auto idx = static_cast<size_t>(std::ceil(p / 100.0 * _sorted.size())) - 1;
+        idx = std::min(idx, _sorted.size() - 1);
+        return _sorted[idx];
+    }
+
+    // The following must not be called if there are no samples.
+    T max() const { return _sorted.back(); }
+    double avg() const { return std::accumulate(_sorted.begin(), _sorted.end(), 0.0) / _sorted.size(); }
+
+    // Prints "<name> (p50/p99/max): <p50>/<p99>/<max>", formatting the values with value_format.
+    void print_percentiles(std::string_view name, std::initializer_list<unsigned> percentiles, std::string_view value_format = "{}") const {
+        std::string labels;
+        std::string values;
+        for (auto p : percentiles) {
+            labels += fmt::format("p{}/", p);
+            values += fmt::format(fmt::runtime(value_format), percentile(p)) + "/";
+        }
+        fmt::print("{} ({}max): {}{}\n", name, labels, values, fmt::format(fmt::runtime(value_format), max()));
+    }
+
+    // Sets <prefix>_p<N> for the percentiles and <prefix>_max. Integral values
+    // are stored as numbers, others as strings formatted with value_format.
+    void add_percentiles(Json::Value& root, std::string_view prefix, std::initializer_list<unsigned> percentiles, std::string_view value_format = "{}") const {
+        auto to_json = [&] (T v) -> Json::Value {
+            if constexpr (std::is_integral_v<T>) {
+                return Json::Value::UInt64(v);
+            } else {
+                return fmt::format(fmt::runtime(value_format), v);
+            }
+        };
+        for (auto p : percentiles) {
+            root[fmt::format("{}_p{}", prefix, p)] = to_json(percentile(p));
+        }
+        root[fmt::format("{}_max", prefix)] = to_json(max());
+    }
+};
+
+inline void print_json_results(const Json::Value& root) {
+    Json::StreamWriterBuilder builder;
+    builder["indentation"] = "  ";
+    fmt::print("{}\n", Json::writeString(builder, root));
+}
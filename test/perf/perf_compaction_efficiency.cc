@@ -18,6 +18,7 @@
 
 #include "test/lib/cql_test_env.hh"
 #include "test/perf/perf.hh"
+#include "test/perf/perf_compaction.hh"
 #include "db/config.hh"
 #include "replica/database.hh"
 #include "sstables/sstables.hh"
@@ -74,34 +75,15 @@ struct metrics {
         return std::chrono::duration<double>(end_time - start_time).count();
     }
 
-    // Compute percentile from sorted samples (0-100)
-    uint64_t percentile(const std::vector<uint64_t>& sorted, double p) const {
-        if (sorted.empty()) {
-            return 0;
-        }
-        auto idx = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size())) - 1;
-        idx = std::min(idx, sorted.size() - 1);
-        return sorted[idx];
-    }
-
-    double percentile_double(const std::vector<double>& sorted, double p) const {
-        if (sorted.empty()) {
-            return 0;
-        }
-        auto idx = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size())) - 1;
-        idx = std::min(idx, sorted.size() - 1);
-        return sorted[idx];
+    double weighted_compaction_efficiency() const {
+        return total_compaction_input_bytes > 0
+            ? (static_cast<int64_t>(total_compaction_input_bytes) - static_cast<int64_t>(total_compaction_output_bytes)) / static_cast<double>(total_compaction_input_bytes)
+            : 0;
     }
 
     void print_results(const test_config& cfg, uint64_t final_sstable_count,
                        uint64_t total_bytes_on_disk, uint64_t major_compacted_bytes) const {
-        auto sorted_ra = read_amp_samples;
-        std::sort(sorted_ra.begin(), sorted_ra.end());
-
-        double avg_ra = 0;
-        if (!sorted_ra.empty()) {
-            avg_ra = std::accumulate(sorted_ra.begin(), sorted_ra.end(), 0.0) / sorted_ra.size();
-        }
+        sample_distribution ra(read_amp_samples);
 
         double write_amp = flush_bytes_written > 0
             ? static_cast<double>(compaction_bytes_written) / flush_bytes_written
@@ -136,41 +118,23 @@ struct metrics {
             : 0;
         fmt::print("Space amplification: {:.2f}x\n", space_amp);
         fmt::print("\n");
-        fmt::print("Read amplification samples: {}\n", sorted_ra.size());
-        if (!sorted_ra.empty()) {
-            fmt::print("Read amplification (avg sstables per probe): {:.1f}\n", avg_ra);
-            fmt::print("Read amplification (p50/p95/p99/max): {}/{}/{}/{}\n",
-                       percentile(sorted_ra, 50),
-                       percentile(sorted_ra, 95),
-                       percentile(sorted_ra, 99),
-                       sorted_ra.back());
+        fmt::print("Read amplification samples: {}\n", ra.size());
+        if (!ra.empty()) {
+            fmt::print("Read amplification (avg sstables per probe): {:.1f}\n", ra.avg());
+            ra.print_percentiles("Read amplification", {50, 95, 99});
         }
 
         if (!compaction_efficiency_samples.empty()) {
-            auto sorted_ce = compaction_efficiency_samples;
-            std::sort(sorted_ce.begin(), sorted_ce.end());
-            double weighted_avg_ce = total_compaction_input_bytes > 0
-                ? (static_cast<int64_t>(total_compaction_input_bytes) - static_cast<int64_t>(total_compaction_output_bytes)) / static_cast<double>(total_compaction_input_bytes)
-                : 0;
-            fmt::print("\nCompaction efficiency samples: {}\n", sorted_ce.size());
-            fmt::print("Compaction efficiency (weighted avg): {:.4f}\n", weighted_avg_ce);
-            fmt::print("Compaction efficiency (p50/p95/p99/max): {:.4f}/{:.4f}/{:.4f}/{:.4f}\n",
-                       percentile_double(sorted_ce, 50),
-                       percentile_double(sorted_ce, 95),
-                       percentile_double(sorted_ce, 99),
-                       sorted_ce.back());
+            sample_distribution ce(compaction_efficiency_samples);
+            fmt::print("\nCompaction efficiency samples: {}\n", ce.size());
+            fmt::print("Compaction efficiency (weighted avg): {:.4f}\n", weighted_compaction_efficiency());
+            ce.print_percentiles("Compaction efficiency", {50, 95, 99}, "{:.4f}");
         }
     }
 
     void write_json(const test_config& cfg, uint64_t final_sstable_count,
                     uint64_t total_bytes_on_disk, uint64_t major_compacted_bytes) const {
-        auto sorted_ra = read_amp_samples;
-        std::sort(sorted_ra.begin(), sorted_ra.end());
-
-        double avg_ra = 0;
-        if (!sorted_ra.empty()) {
-            avg_ra = std::accumulate(sorted_ra.begin(), sorted_ra.end(), 0.0) / sorted_ra.size();
-        }
+        sample_distribution ra(read_amp_samples);
 
         double write_amp = flush_bytes_written > 0
             ? static_cast<double>(compaction_bytes_written) / flush_bytes_written
@@ -196,33 +160,20 @@ struct metrics {
             : 0;
         root["space_amplification"] = fmt::format("{:.2f}", space_amp);
         root["write_amplification"] = fmt::format("{:.2f}", write_amp);
-        root["read_amp_samples"] = Json::Value::UInt64(sorted_ra.size());
-        if (!sorted_ra.empty()) {
-            root["read_amp_avg"] = fmt::format("{:.2f}", avg_ra);
-            root["read_amp_p50"] = Json::Value::UInt64(percentile(sorted_ra, 50));
-            root["read_amp_p95"] = Json::Value::UInt64(percentile(sorted_ra, 95));
-            root["read_amp_p99"] = Json::Value::UInt64(percentile(sorted_ra, 99));
-            root["read_amp_max"] = Json::Value::UInt64(sorted_ra.back());
+        root["read_amp_samples"] = Json::Value::UInt64(ra.size());
+        if (!ra.empty()) {
+            root["read_amp_avg"] = fmt::format("{:.2f}", ra.avg());
+            ra.add_percentiles(root, "read_amp", {50, 95, 99});
         }
 
         if (!compaction_efficiency_samples.empty()) {
-            auto sorted_ce = compaction_efficiency_samples;
-            std::sort(sorted_ce.begin(), sorted_ce.end());
-            double weighted_avg_ce = total_compaction_input_bytes > 0
-                ? (static_cast<int64_t>(total_compaction_input_bytes) - static_cast<int64_t>(total_compaction_output_bytes)) / static_cast<double>(total_compaction_input_bytes)
-                : 0;
-            root["compaction_efficiency_samples"] = Json::Value::UInt64(sorted_ce.size());
-            root["compaction_efficiency_weighted_avg"] = fmt::format("{:.4f}", weighted_avg_ce);
-            root["compaction_efficiency_p50"] = fmt::format("{:.4f}", percentile_double(sorted_ce, 50));
-            root["compaction_efficiency_p95"] = fmt::format("{:.4f}", percentile_double(sorted_ce, 95));
-            root["compaction_efficiency_p99"] = fmt::format("{:.4f}", percentile_double(sorted_ce, 99));
-            root["compaction_efficiency_max"] = fmt::format("{:.4f}", sorted_ce.back());
+            sample_distribution ce(compaction_efficiency_samples);
+            root["compaction_efficiency_samples"] = Json::Value::UInt64(ce.size());
+            root["compaction_efficiency_weighted_avg"] = fmt::format("{:.4f}", weighted_compaction_efficiency());
+            ce.add_percentiles(root, "compaction_efficiency", {50, 95, 99}, "{:.4f}");
         }
 
-        Json::StreamWriterBuilder builder;
-        builder["indentation"] = "  ";
-        auto json_str = Json::writeString(builder, root);
-        fmt::print("{}\n", json_str);
+        print_json_results(root);
     }
 };
 
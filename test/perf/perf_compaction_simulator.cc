@@ -0,0 +1,792 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+// Simulates compaction strategies on sstable metadata only, without reading
+// or writing any data. The simulation starts from the sstables of a node, as
+// dumped by `scylla sstable dump-compaction-strategy-metadata`, or from an
+// empty table, and applies a synthetic write stream to it: a flush every
+// --flush-interval (in simulated time), each overwriting and deleting some of
+// the existing data. The compactions are picked by the real compaction
+// strategy, from fake sstables carrying the metadata the strategies look at.
+// Compactions are not executed, their output is estimated instead, see
+// simulator::compact().
+//
+// Since no data is read or written, even years of workload on terabytes of
+// data can be simulated in seconds, which allows comparing strategies and
+// their options on a node's actual data before switching to them.
+
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <json/json.h>
+
+#include <seastar/core/app-template.hh>
+#include <seastar/core/thread.hh>
+
+#include "clocks-impl.hh"
+#include "compaction/compaction.hh"
+#include "compaction/compaction_backlog_manager.hh"
+#include "compaction/compaction_group_view.hh"
+#include "compaction/compaction_strategy.hh"
+#include "compaction/compaction_strategy_state.hh"
+#include "compaction/strategy_control.hh"
+#include "test/lib/sstable_test_env.hh"
+#include "test/lib/sstable_utils.hh"
+#include "test/perf/perf.hh"
+#include "test/perf/perf_compaction.hh"
+#include "schema/schema_builder.hh"
+#include "sstables/sstable_set.hh"
+#include "sstables/sstables.hh"
+
+namespace {
+
+struct test_config {
+    sstring sstables_metadata;
+    sstring compaction_strategy = "IncrementalCompactionStrategy";
+    std::map<sstring, sstring> compaction_options;
+    unsigned flushes = 1000;
+    unsigned flush_interval = 60;
+    uint64_t flush_size = 64 << 20;
+    double overwrite_ratio = 0.25;
+    double delete_ratio = 0.0;
+    unsigned default_time_to_live = 0;
+    unsigned gc_grace_seconds = 864000;
+    unsigned read_probes = 100;
+    unsigned random_seed = 0;
+    sstring output_format = "text";
+    bool verbose = false;
+};
+
+// The metadata compaction strategies make their decisions on, plus the
+// bookkeeping the simulation needs to estimate the output of compactions.
+struct sstable_metadata {
+    uint64_t data_size = 0;
+    int64_t first_token = std::numeric_limits<int64_t>::min();
+    int64_t last_token = std::numeric_limits<int64_t>::max();
+    uint64_t partitions = 0;
+    uint64_t cells = 0;
+    // Tombstones and expiring cells.
+    uint64_t tombstones = 0;
+    api::timestamp_type min_timestamp = api::min_timestamp;
+    api::timestamp_type max_timestamp = api::min_timestamp;
+    int32_t min_local_deletion_time = std::numeric_limits<int32_t>::max();
+    int32_t max_local_deletion_time = std::numeric_limits<int32_t>::max();
+    uint32_t level = 0;
+    sstables::run_id run_identifier = sstables::run_id::create_random_id();
+    db_clock::time_point write_time;
+    // Bytes of data shadowed by data written later, in other sstables.
+    // Dropped once compacted together with the shadowing data.
+    uint64_t obsolete_bytes = 0;
+
+    bool overlaps(const sstable_metadata& o) const {
+        return first_token <= o.last_token && o.first_token <= last_token;
+    }
+    double bytes_per_cell() const {
+        return cells ? double(data_size) / cells : 0;
+    }
+};
+
+struct metrics {
+    uint64_t total_flushes = 0;
+    uint64_t total_compactions = 0;
+    uint64_t expired_sstables_dropped = 0;
+    uint64_t disjoint_sstables_copied = 0;
+
+    uint64_t flush_bytes_written = 0;
+    uint64_t compaction_bytes_written = 0;
+
+    // Number of sstables covering a randomly picked token.
+    std::vector<uint64_t> read_fanout_samples;
+    // Ratio of data on disk to live data, sampled after each flush.
+    std::vector<double> space_amp_samples;
+
+    uint64_t final_sstable_count = 0;
+    uint64_t final_bytes_on_disk = 0;
+    uint64_t final_live_bytes = 0;
+
+    double write_amplification() const {
+        return flush_bytes_written > 0
+            ? static_cast<double>(flush_bytes_written + compaction_bytes_written) / flush_bytes_written
+            : 0;
+    }
+
+    double final_space_amplification() const {
+        return final_live_bytes > 0 ? static_cast<double>(final_bytes_on_disk) / final_live_bytes : 0;
+    }
+
+    void print_results(const test_config& cfg) const {
+        sample_distribution rf(read_fanout_samples);
+        sample_distribution sa(space_amp_samples);
+
+        fmt::print("\n=== Compaction Simulator Results ===\n");
+        fmt::print("Strategy: {}\n", cfg.compaction_strategy);
+        fmt::print("Random seed: {}\n", cfg.random_seed);
+        fmt::print("Simulated time: {}s\n", uint64_t(total_flushes) * cfg.flush_interval);
+        fmt::print("Total flushes: {}\n", total_flushes);
+        fmt::print("Total compactions: {}\n", total_compactions);
+        fmt::print("Fully expired sstables dropped: {}\n", expired_sstables_dropped);
+        fmt::print("Disjoint sstables copied: {}\n", disjoint_sstables_copied);
+        fmt::print("Final sstable count: {}\n", final_sstable_count);
+        fmt::print("\n");
+        fmt::print("Flush bytes written: {:.1f} MB\n", flush_bytes_written / 1048576.0);
+        fmt::print("Compaction bytes written: {:.1f} MB\n", compaction_bytes_written / 1048576.0);
+        fmt::print("Write amplification: {:.2f}x\n", write_amplification());
+        fmt::print("\n");
+        fmt::print("Total data on disk: {:.1f} MB\n", final_bytes_on_disk / 1048576.0);
+        fmt::print("Live data: {:.1f} MB\n", final_live_bytes / 1048576.0);
+        fmt::print("Space amplification: {:.2f}x\n", final_space_amplification());
+        if (!sa.empty()) {
+            sa.print_percentiles("Space amplification", {50, 99}, "{:.2f}");
+        }
+        fmt::print("\n");
+        fmt::print("Read fan-out samples: {}\n", rf.size());
+        if (!rf.empty()) {
+            fmt::print("Read fan-out (avg sstables per read): {:.1f}\n", rf.avg());
+            rf.print_percentiles("Read fan-out", {50, 95, 99});
+        }
+    }
+
+    void write_json(const test_config& cfg) const {
+        sample_distribution rf(read_fanout_samples);
+        sample_distribution sa(space_amp_samples);
+
+        Json::Value root;
+        root["strategy"] = std::string(cfg.compaction_strategy);
+        root["random_seed"] = cfg.random_seed;
+        root["simulated_seconds"] = Json::Value::UInt64(uint64_t(total_flushes) * cfg.flush_interval);
+        root["total_flushes"] = Json::Value::UInt64(total_flushes);
+        root["total_compactions"] = Json::Value::UInt64(total_compactions);
+        root["expired_sstables_dropped"] = Json::Value::UInt64(expired_sstables_dropped);
+        root["disjoint_sstables_copied"] = Json::Value::UInt64(disjoint_sstables_copied);
+        root["final_sstable_count"] = Json::Value::UInt64(final_sstable_count);
+        root["flush_bytes_written"] = Json::Value::UInt64(flush_bytes_written);
+        root["compaction_bytes_written"] = Json::Value::UInt64(compaction_bytes_written);
+        root["write_amplification"] = fmt::format("{:.2f}", write_amplification());
+        root["total_bytes_on_disk"] = Json::Value::UInt64(final_bytes_on_disk);
+        root["live_bytes"] = Json::Value::UInt64(final_live_bytes);
+        root["space_amplification"] = fmt::format("{:.2f}", final_space_amplification());
+        if (!sa.empty()) {
+            sa.add_percentiles(root, "space_amplification", {50, 99}, "{:.2f}");
+        }
+        root["read_fanout_samples"] = Json::Value::UInt64(rf.size());
+        if (!rf.empty()) {
+            root["read_fanout_avg"] = fmt::format("{:.2f}", rf.avg());
+            rf.add_percentiles(root, "read_fanout", {50, 95, 99});
+        }
+
+        print_json_results(root);
+    }
+};
+
+// Parses the output of `scylla sstable dump-compaction-strategy-metadata`.
+std::vector<sstable_metadata> load_sstables_metadata(const sstring& path) {
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error(fmt::format("failed to open {}", path));
+    }
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    std::string errors;
+    if (!Json::parseFromStream(builder, in, &root, &errors)) {
+        throw std::runtime_error(fmt::format("failed to parse {}: {}", path, errors));
+    }
+    std::vector<sstable_metadata> ret;
+    const auto& sstables = root["sstables"];
+    for (const auto& name : sstables.getMemberNames()) {
+        const auto& v = sstables[name];
+        sstable_metadata m;
+        m.data_size = v["data_size"].asUInt64();
+        m.first_token = std::stoll(v["first_token"].asString());
+        m.last_token = std::stoll(v["last_token"].asString());
+        m.partitions = v["estimated_partitions"].asUInt64();
+        m.cells = v["estimated_cells"].asUInt64();
+        m.tombstones = v["estimated_tombstones"].asUInt64();
+        m.min_timestamp = v["min_timestamp"].asInt64();
+        m.max_timestamp = v["max_timestamp"].asInt64();
+        m.min_local_deletion_time = v["min_local_deletion_time"].asInt();
+        m.max_local_deletion_time = v["max_local_deletion_time"].asInt();
+        m.level = v["level"].asUInt();
+        m.run_identifier = sstables::run_id(utils::UUID(v["run_identifier"].asString()));
+        m.write_time = db_clock::time_point(std::chrono::seconds(v["data_file_write_time"].asInt64()));
+        ret.push_back(std::move(m));
+    }
+    return ret;
+}
+
+class simulated_compaction_group_view : public compaction::compaction_group_view {
+    struct dummy_compaction_backlog_tracker : public compaction::compaction_backlog_tracker::impl {
+        virtual void replace_sstables(const std::vector<sstables::shared_sstable>& old_ssts, const std::vector<sstables::shared_sstable>& new_ssts) override { }
+        virtual double backlog(const compaction::compaction_backlog_tracker::ongoing_writes& ow, const compaction::compaction_backlog_tracker::ongoing_compactions& oc) const override { return 0.0; }
+    };
+
+private:
+    sstables::test_env& _env;
+    schema_ptr _schema;
+    reader_permit _permit;
+    mutable compaction::compaction_strategy _compaction_strategy;
+    compaction::compaction_strategy_state _compaction_strategy_state;
+    sstables::sstable_set _main_set;
+    sstables::sstable_set _maintenance_set;
+    std::vector<sstables::shared_sstable> _compacted_undeleted_sstables;
+    tombstone_gc_state _tombstone_gc_state;
+    compaction::compaction_backlog_tracker _backlog_tracker;
+    std::string _group_id;
+    condition_variable _staging_done_condition;
+
+public:
+    simulated_compaction_group_view(sstables::test_env& env, schema_ptr schema)
+        : _env(env)
+        , _schema(std::move(schema))
+        , _permit(_env.make_reader_permit())
+        , _compaction_strategy(compaction::make_compaction_strategy(_schema->compaction_strategy(), _schema->compaction_strategy_options()))
+        , _compaction_strategy_state(compaction::compaction_strategy_state::make(_compaction_strategy))
+        , _main_set(_compaction_strategy.make_sstable_set(*this))
+        , _maintenance_set(sstables::make_partitioned_sstable_set(_schema, token_range()))
+        , _tombstone_gc_state(tombstone_gc_state::for_tests())
+        , _backlog_tracker(std::make_unique<dummy_compaction_backlog_tracker>())
+        , _group_id("simulated-group")
+    { }
+
+    void add_sstable(sstables::shared_sstable sst) {
+        (void)_main_set.insert(std::move(sst));
+    }
+    void remove_sstable(sstables::shared_sstable sst) {
+        _main_set.erase(std::move(sst));
+    }
+
+    virtual dht::token_range token_range() const noexcept override { return dht::token_range::make(dht::first_token(), dht::last_token()); }
+    virtual const schema_ptr& schema() const noexcept override { return _schema; }
+    virtual unsigned min_compaction_threshold() const noexcept override { return _schema->min_compaction_threshold(); }
+    virtual bool compaction_enforce_min_threshold() const noexcept override { return true; }
+    virtual future<lw_shared_ptr<const sstables::sstable_set>> main_sstable_set() const override { co_return make_lw_shared<const sstables::sstable_set>(_main_set); }
+    virtual future<lw_shared_ptr<const sstables::sstable_set>> maintenance_sstable_set() const override { co_return make_lw_shared<const sstables::sstable_set>(_maintenance_set); }
+    lw_shared_ptr<const sstables::sstable_set> sstable_set_for_tombstone_gc() const override { return make_lw_shared<const sstables::sstable_set>(_main_set); }
+    virtual bool skip_memtable_for_tombstone_gc() const noexcept override { return true; }
+    virtual std::unordered_set<sstables::shared_sstable> fully_expired_sstables(const std::vector<sstables::shared_sstable>& sstables, gc_clock::time_point compaction_time) const override {
+        return compaction::get_fully_expired_sstables(*this, sstables, compaction_time);
+    }
+    virtual const std::vector<sstables::shared_sstable>& compacted_undeleted_sstables() const noexcept override { return _compacted_undeleted_sstables; }
+    virtual compaction::compaction_strategy& get_compaction_strategy() const noexcept override { return _compaction_strategy; }
+    virtual compaction::compaction_strategy_state& get_compaction_strategy_state() noexcept override { return _compaction_strategy_state; }
+    virtual reader_permit make_compaction_reader_permit() const override { return _permit; }
+    virtual sstables::sstables_manager& get_sstables_manager() noexcept override { return _env.manager(); }
+    virtual sstables::shared_sstable make_sstable(sstables::sstable_state) const override { return _env.make_sstable(_schema); }
+    virtual sstables::shared_sstable make_sstable(sstables::sstable_state, sstables::sstable_version_types) const override { return _env.make_sstable(_schema); }
+    virtual sstables::shared_sstable make_sstable(sstables::sstable_state, const data_dictionary::storage_options&) const override { return _env.make_sstable(_schema); }
+    virtual sstables::sstable_writer_config configure_writer(sstring origin) const override { return _env.manager().configure_writer(std::move(origin)); }
+    virtual api::timestamp_type min_memtable_timestamp() const override { return api::max_timestamp; }
+    virtual api::timestamp_type min_memtable_live_timestamp() const override { return api::max_timestamp; }
+    virtual api::timestamp_type min_memtable_live_row_marker_timestamp() const override { return api::max_timestamp; }
+    virtual bool memtable_has_key(const dht::decorated_key& key) const override { return false; }
+    virtual future<> on_compaction_completion(compaction::compaction_completion_desc desc, sstables::offstrategy offstrategy) override { return make_ready_future<>(); }
+    virtual bool is_auto_compaction_disabled_by_user() const noexcept override { return false; }
+    virtual bool tombstone_gc_enabled() const noexcept override { return true; }
+    virtual tombstone_gc_state get_tombstone_gc_state() const noexcept override { return _tombstone_gc_state; }
+    virtual compaction::compaction_backlog_tracker& get_backlog_tracker() override { return _backlog_tracker; }
+    virtual const std::string get_group_id() const noexcept override { return _group_id; }
+    virtual seastar::condition_variable& get_staging_done_condition() noexcept override { return _staging_done_condition; }
+    dht::token_range get_token_range_after_split(const dht::token& t) const noexcept override { return dht::token_range(); }
+    int64_t get_sstables_repaired_at() const noexcept override { return 0; }
+};
+
+// Compactions are executed one at a time, so all sstables are candidates.
+class simulated_strategy_control : public compaction::strategy_control {
+public:
+    bool has_ongoing_compaction(compaction::compaction_group_view& table_s) const noexcept override {
+        return false;
+    }
+
+    future<std::vector<sstables::shared_sstable>> candidates(compaction::compaction_group_view& t) const override {
+        auto main_set = co_await t.main_sstable_set();
+        co_return *main_set->all() | std::ranges::to<std::vector>();
+    }
+
+    future<std::vector<sstables::frozen_sstable_run>> candidates_as_runs(compaction::compaction_group_view& t) const override {
+        auto main_set = co_await t.main_sstable_set();
+        co_return main_set->all_sstable_runs();
+    }
+
+    // Reads are only sampled, they don't feed the compaction.
+    std::optional<dht::token_range> take_hot_read_range(compaction::compaction_group_view& t) const override {
+        return std::nullopt;
+    }
+};
+
+class simulator {
+    // Strategies are expected to converge, this only guards against a
+    // strategy picking the same compaction over and over.
+    static constexpr unsigned max_compactions_per_flush = 1000;
+
+    const test_config& _cfg;
+    sstables::test_env& _env;
+    schema_ptr _schema;
+    simulated_compaction_group_view _view;
+    simulated_strategy_control _control;
+    std::unordered_map<sstables::shared_sstable, sstable_metadata> _sstables;
+    metrics& _metrics;
+    std::mt19937_64 _rng;
+    // The token range flushes and reads are spread over.
+    int64_t _first_token = std::numeric_limits<int64_t>::min() + 1;
+    int64_t _last_token = std::numeric_limits<int64_t>::max();
+    // Averages of the initial sstables, used to shape the flushed sstables.
+    double _bytes_per_cell = 100;
+    double _cells_per_partition = 10;
+
+private:
+    static dht::decorated_key make_key(int64_t token) {
+        return dht::decorated_key(dht::token::from_int64(token), partition_key::make_empty());
+    }
+
+    sstables::shared_sstable make_sstable(sstable_metadata m) {
+        auto sst = _env.make_sstable(_schema);
+        sstables::stats_metadata stats = {};
+        stats.min_timestamp = m.min_timestamp;
+        stats.max_timestamp = m.max_timestamp;
+        stats.min_local_deletion_time = m.min_local_deletion_time;
+        stats.max_local_deletion_time = m.max_local_deletion_time;
+        stats.sstable_level = m.level;
+        if (m.partitions) {
+            stats.estimated_cells_count.add(std::max<uint64_t>(1, m.cells / m.partitions));
+            stats.estimated_cells_count *= m.partitions;
+        }
+        if (m.tombstones) {
+            stats.estimated_tombstone_drop_time.update(m.max_local_deletion_time, m.tombstones);
+        }
+        sstables::test(sst).set_values(partition_key::make_empty(), partition_key::make_empty(), std::move(stats), std::max<uint64_t>(1, m.data_size));
+        sstables::test(sst).set_first_and_last_keys(make_key(m.first_token), make_key(m.last_token));
+        sstables::test(sst).set_run_identifier(m.run_identifier);
+        sstables::test(sst).set_data_file_write_time(m.write_time);
+        return sst;
+    }
+
+    void add(sstable_metadata m) {
+        auto sst = make_sstable(m);
+        _sstables.emplace(sst, std::move(m));
+        _view.add_sstable(std::move(sst));
+    }
+
+    void remove(const sstables::shared_sstable& sst) {
+        _sstables.erase(sst);
+        _view.remove_sstable(sst);
+    }
+
+    static api::timestamp_type now_timestamp() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(db_clock::now().time_since_epoch()).count();
+    }
+
+    static int32_t now_seconds() {
+        return gc_clock::now().time_since_epoch().count();
+    }
+
+    uint64_t live_bytes() const {
+        uint64_t live = 0;
+        for (const auto& [sst, m] : _sstables) {
+            live += m.data_size - std::min(m.data_size, m.obsolete_bytes + uint64_t(m.tombstones * m.bytes_per_cell()));
+        }
+        return live;
+    }
+
+    uint64_t bytes_on_disk() const {
+        uint64_t total = 0;
+        for (const auto& [sst, m] : _sstables) {
+            total += m.data_size;
+        }
+        return total;
+    }
+
+    // Flushes a memtable which overwrites, or deletes, --overwrite-ratio and
+    // --delete-ratio of its size worth of existing data, spread over the
+    // existing sstables in proportion to their live data.
+    void flush() {
+        const auto now_ts = now_timestamp();
+        const auto now_s = now_seconds();
+
+        uint64_t live = 0;
+        for (const auto& [sst, m] : _sstables) {
+            live += m.data_size - m.obsolete_bytes;
+        }
+        const auto shadowed = std::min<uint64_t>(live, (_cfg.overwrite_ratio + _cfg.delete_ratio) * _cfg.flush_size);
+        if (live) {
+            for (auto& [sst, m] : _sstables) {
+                m.obsolete_bytes += uint64_t(double(m.data_size - m.obsolete_bytes) / live * shadowed);
+            }
+        }
+
+        sstable_metadata m;
+        m.data_size = _cfg.flush_size;
+        m.first_token = _first_token;
+        m.last_token = _last_token;
+        m.cells = std::max<uint64_t>(1, _cfg.flush_size / _bytes_per_cell);
+        m.partitions = std::max<uint64_t>(1, m.cells / _cells_per_partition);
+        m.min_timestamp = now_ts - std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::seconds(_cfg.flush_interval)).count();
+        m.max_timestamp = now_ts;
+        if (_cfg.default_time_to_live) {
+            m.tombstones = m.cells;
+            m.min_local_deletion_time = now_s - _cfg.flush_interval + _cfg.default_time_to_live;
+            m.max_local_deletion_time = now_s + _cfg.default_time_to_live;
+        } else if (_cfg.delete_ratio > 0) {
+            m.tombstones = m.cells * _cfg.delete_ratio;
+            m.min_local_deletion_time = now_s - _cfg.flush_interval;
+            m.max_local_deletion_time = now_s;
+        }
+        m.write_time = db_clock::now();
+        add(std::move(m));
+
+        _metrics.flush_bytes_written += _cfg.flush_size;
+        ++_metrics.total_flushes;
+    }
+
+    // Estimates the output of compacting the input sstables:
+    // * the obsolete data of an input is dropped in proportion to how much
+    //   of the newer data overlapping with it is also compacted;
+    // * the tombstones (and expired cells) of an input are purged if they
+    //   are past gc_grace_seconds and all the older data overlapping with
+    //   the input is compacted;
+    // * the remaining data is split into sstables of at most the
+    //   descriptor's max_sstable_bytes, evenly over the inputs' token range.
+    void compact(compaction::compaction_descriptor desc) {
+        const auto gc_before = now_seconds() - int32_t(_schema->gc_grace_seconds().count());
+        std::unordered_set<sstables::shared_sstable> inputs(desc.sstables.begin(), desc.sstables.end());
+        std::vector<sstables::shared_sstable> removed;
+        std::vector<sstables::shared_sstable> added;
+
+        auto expired = _view.fully_expired_sstables(desc.sstables, gc_clock::now());
+        for (const auto& sst : expired) {
+            inputs.erase(sst);
+            removed.push_back(sst);
+            ++_metrics.expired_sstables_dropped;
+        }
+        if (desc.has_only_fully_expired) {
+            for (const auto& sst : inputs) {
+                removed.push_back(sst);
+                ++_metrics.expired_sstables_dropped;
+            }
+            inputs.clear();
+        }
+
+        // Input sstables not overlapping with any other input, and without
+        // tombstones, are linked into the output run as they are.
+        if (desc.copy_disjoint_sstables && inputs.size() > 1) {
+            std::vector<sstables::shared_sstable> disjoint;
+            for (const auto& sst : inputs) {
+                const auto& m = _sstables.at(sst);
+                if (!m.tombstones && std::ranges::none_of(inputs, [&] (const sstables::shared_sstable& o) { return o != sst && m.overlaps(_sstables.at(o)); })) {
+                    disjoint.push_back(sst);
+                }
+            }
+            for (const auto& sst : disjoint) {
+                auto m = _sstables.at(sst);
+                m.level = desc.level;
+                m.run_identifier = desc.run_identifier;
+                inputs.erase(sst);
+                removed.push_back(sst);
+                auto copy = make_sstable(m);
+                _sstables.emplace(copy, std::move(m));
+                added.push_back(std::move(copy));
+                ++_metrics.disjoint_sstables_copied;
+            }
+        }
+
+        if (!inputs.empty()) {
+            sstable_metadata out;
+            out.first_token = std::numeric_limits<int64_t>::max();
+            out.last_token = std::numeric_limits<int64_t>::min();
+            out.min_timestamp = api::max_timestamp;
+            out.min_local_deletion_time = std::numeric_limits<int32_t>::max();
+            out.max_local_deletion_time = std::numeric_limits<int32_t>::min();
+            double size = 0;
+            double obsolete = 0;
+            double cells = 0;
+            double tombstones = 0;
+            double partitions = 0;
+            double input_size = 0;
+            for (const auto& sst : inputs) {
+                const auto& m = _sstables.at(sst);
+                uint64_t newer_total = 0;
+                uint64_t newer_compacted = 0;
+                bool older_outside = false;
+                for (const auto& [o, om] : _sstables) {
+                    if (o == sst || !m.overlaps(om)) {
+                        continue;
+                    }
+                    if (om.max_timestamp > m.max_timestamp) {
+                        newer_total += om.data_size;
+                        newer_compacted += inputs.contains(o) ? om.data_size : 0;
+                    } else if (om.min_timestamp < m.max_timestamp && !inputs.contains(o)) {
+                        older_outside = true;
+                    }
+                }
+                const double dropped = newer_total ? double(m.obsolete_bytes) * newer_compacted / newer_total : m.obsolete_bytes;
+                const bool purge = m.tombstones && m.max_local_deletion_time < gc_before && !older_outside;
+                const double purged_cells = purge ? m.tombstones : 0;
+
+                size += m.data_size - dropped - purged_cells * m.bytes_per_cell();
+                obsolete += m.obsolete_bytes - dropped;
+                cells += m.cells - purged_cells;
+                tombstones += m.tombstones - purged_cells;
+                partitions += m.partitions;
+                input_size += m.data_size;
+
+                out.first_token = std::min(out.first_token, m.first_token);
+                out.last_token = std::max(out.last_token, m.last_token);
+                out.min_timestamp = std::min(out.min_timestamp, m.min_timestamp);
+                out.max_timestamp = std::max(out.max_timestamp, m.max_timestamp);
+                if (m.tombstones && !purge) {
+                    out.min_local_deletion_time = std::min(out.min_local_deletion_time, m.min_local_deletion_time);
+                    out.max_local_deletion_time = std::max(out.max_local_deletion_time, m.max_local_deletion_time);
+                }
+                removed.push_back(sst);
+            }
+            if (out.max_local_deletion_time == std::numeric_limits<int32_t>::min()) {
+                out.max_local_deletion_time = std::numeric_limits<int32_t>::max();
+            }
+            out.level = desc.level;
+            out.run_identifier = desc.run_identifier;
+            out.write_time = db_clock::now();
+
+            const auto output_size = uint64_t(std::max(0.0, size));
+            // Assume dropped data shadowed partitions in the same proportion.
+            partitions *= input_size ? output_size / input_size : 0;
+            if (output_size && cells >= 1) {
+                const auto pieces = std::max<uint64_t>(1, (output_size + desc.max_sstable_bytes - 1) / desc.max_sstable_bytes);
+                const auto width = (static_cast<__int128>(out.last_token) - out.first_token + 1) / pieces;
+                for (uint64_t i = 0; i < pieces; ++i) {
+                    auto piece = out;
+                    piece.first_token = out.first_token + int64_t(width * i);
+                    piece.last_token = i + 1 == pieces ? out.last_token : int64_t(out.first_token + width * (i + 1) - 1);
+                    piece.data_size = std::max<uint64_t>(1, output_size / pieces);
+                    piece.obsolete_bytes = std::max(0.0, obsolete) / pieces;
+                    piece.cells = std::max<uint64_t>(1, cells / pieces);
+                    piece.tombstones = std::max(0.0, tombstones) / pieces;
+                    piece.partitions = std::max<uint64_t>(1, partitions / pieces);
+                    auto sst = make_sstable(piece);
+                    _sstables.emplace(sst, std::move(piece));
+                    added.push_back(std::move(sst));
+                }
+                _metrics.compaction_bytes_written += output_size;
+            }
+        }
+
+        for (const auto& sst : removed) {
+            remove(sst);
+        }
+        for (const auto& sst : added) {
+            _view.add_sstable(sst);
+        }
+        _view.get_compaction_strategy().notify_completion(_view, removed, added);
+        ++_metrics.total_compactions;
+
+        if (_cfg.verbose) {
+            fmt::print("compaction: {} sstables in, {} sstables out (level={}), {} sstables in the table\n",
+                       removed.size(), added.size(), desc.level, _sstables.size());
+        }
+    }
+
+    void sample_reads() {
+        std::uniform_int_distribution<int64_t> dist(_first_token, _last_token);
+        for (unsigned i = 0; i < _cfg.read_probes; ++i) {
+            const auto token = dist(_rng);
+            _metrics.read_fanout_samples.push_back(std::ranges::count_if(_sstables, [token] (const auto& e) {
+                return e.second.first_token <= token && token <= e.second.last_token;
+            }));
+        }
+    }
+
+public:
+    simulator(const test_config& cfg, sstables::test_env& env, schema_ptr schema, metrics& m)
+        : _cfg(cfg)
+        , _env(env)
+        , _schema(std::move(schema))
+        , _view(_env, _schema)
+        , _metrics(m)
+        , _rng(cfg.random_seed)
+    { }
+
+    void load(std::vector<sstable_metadata> initial) {
+        if (initial.empty()) {
+            return;
+        }
+        _first_token = std::numeric_limits<int64_t>::max();
+        _last_token = std::numeric_limits<int64_t>::min();
+        uint64_t bytes = 0;
+        uint64_t cells = 0;
+        uint64_t partitions = 0;
+        for (auto& m : initial) {
+            _first_token = std::min(_first_token, m.first_token);
+            _last_token = std::max(_last_token, m.last_token);
+            bytes += m.data_size;
+            cells += m.cells;
+            partitions += m.partitions;
+            add(std::move(m));
+        }
+        if (cells) {
+            _bytes_per_cell = double(bytes) / cells;
+        }
+        if (partitions) {
+            _cells_per_partition = std::max(1.0, double(cells) / partitions);
+        }
+    }
+
+    void run() {
+        for (unsigned i = 0; i < _cfg.flushes; ++i) {
+            forward_jump_clocks(std::chrono::seconds(_cfg.flush_interval));
+            flush();
+            for (unsigned c = 0; c < max_compactions_per_flush; ++c) {
+                auto desc = _view.get_compaction_strategy().get_sstables_for_compaction(_view, _control).get();
+                if (desc.sstables.empty()) {
+                    break;
+                }
+                compact(std::move(desc));
+            }
+            sample_reads();
+            if (auto live = live_bytes()) {
+                _metrics.space_amp_samples.push_back(double(bytes_on_disk()) / live);
+            }
+        }
+        _metrics.final_sstable_count = _sstables.size();
+        _metrics.final_bytes_on_disk = bytes_on_disk();
+        _metrics.final_live_bytes = live_bytes();
+    }
+};
+
+void do_compaction_simulation(sstables::test_env& env, const test_config& cfg) {
+    auto builder = schema_builder("ks", "perf_compaction_simulator")
+        .with_column("pk", long_type, column_kind::partition_key)
+        .with_column("v", long_type);
+    builder.set_compaction_strategy(compaction::compaction_strategy::type(cfg.compaction_strategy));
+    builder.set_compaction_strategy_options(std::map<sstring, sstring>(cfg.compaction_options));
+    builder.set_gc_grace_seconds(cfg.gc_grace_seconds);
+    if (cfg.default_time_to_live) {
+        builder.set_default_time_to_live(std::chrono::seconds(cfg.default_time_to_live));
+    }
+    auto s = builder.build();
+
+    metrics m;
+    simulator sim(cfg, env, s, m);
+    if (!cfg.sstables_metadata.empty()) {
+        sim.load(load_sstables_metadata(cfg.sstables_metadata));
+    }
+    sim.run();
+
+    if (cfg.output_format == "json") {
+        m.write_json(cfg);
+    } else {
+        m.print_results(cfg);
+    }
+}
+
+} // anonymous namespace
+
+namespace perf {
+
+int scylla_compaction_simulator_main(int argc, char** argv) {
+    namespace bpo = boost::program_options;
+    app_template app;
+    app.add_options()
+        ("sstables-metadata", bpo::value<std::string>()->default_value(""),
+            "initial sstables, as dumped by `scylla sstable dump-compaction-strategy-metadata` (empty = start with an empty table)")
+        ("compaction-strategy", bpo::value<std::string>()->default_value("IncrementalCompactionStrategy"),
+            "compaction strategy class name")
+        ("compaction-options", bpo::value<std::string>()->default_value(""),
+            "compaction strategy options as key=value,key=value")
+        ("flushes", bpo::value<unsigned>()->default_value(1000),
+            "number of memtable flushes to simulate")
+        ("flush-interval", bpo::value<unsigned>()->default_value(60),
+            "simulated time between flushes, in seconds")
+        ("flush-size", bpo::value<uint64_t>()->default_value(64 << 20),
+            "size of the sstable written by each flush, in bytes")
+        ("overwrite-ratio", bpo::value<double>()->default_value(0.25),
+            "ratio of each flush overwriting existing data (0.0-1.0)")
+        ("delete-ratio", bpo::value<double>()->default_value(0.0),
+            "ratio of each flush deleting existing data (0.0-1.0)")
+        ("default-time-to-live", bpo::value<unsigned>()->default_value(0),
+            "table TTL in seconds (0 = disabled)")
+        ("gc-grace-seconds", bpo::value<unsigned>()->default_value(864000),
+            "table gc_grace_seconds")
+        ("read-probes", bpo::value<unsigned>()->default_value(100),
+            "number of random tokens to measure the read fan-out of after each flush")
+        ("random-seed", bpo::value<unsigned>(),
+            "random number generator seed")
+        ("output-format", bpo::value<std::string>()->default_value("text"),
+            "output format: text, json")
+        ("verbose", bpo::bool_switch()->default_value(false),
+            "print each simulated compaction")
+        ;
+
+    set_abort_on_internal_error(true);
+
+    return app.run(argc, argv, [&app] {
+        auto conf_seed = app.configuration()["random-seed"];
+        auto seed = conf_seed.empty() ? std::random_device()() : conf_seed.as<unsigned>();
+
+        test_config cfg;
+        cfg.sstables_metadata = app.configuration()["sstables-metadata"].as<std::string>();
+        cfg.compaction_strategy = app.configuration()["compaction-strategy"].as<std::string>();
+        cfg.flushes = app.configuration()["flushes"].as<unsigned>();
+        cfg.flush_interval = app.configuration()["flush-interval"].as<unsigned>();
+        cfg.flush_size = app.configuration()["flush-size"].as<uint64_t>();
+        cfg.overwrite_ratio = app.configuration()["overwrite-ratio"].as<double>();
+        cfg.delete_ratio = app.configuration()["delete-ratio"].as<double>();
+        cfg.default_time_to_live = app.configuration()["default-time-to-live"].as<unsigned>();
+        cfg.gc_grace_seconds = app.configuration()["gc-grace-seconds"].as<unsigned>();
+        cfg.read_probes = app.configuration()["read-probes"].as<unsigned>();
+        cfg.random_seed = seed;
+        cfg.output_format = app.configuration()["output-format"].as<std::string>();
+        cfg.verbose = app.configuration()["verbose"].as<bool>();
+        // Parse compaction options from key=value,key=value format
+        auto opts_str = app.configuration()["compaction-options"].as<std::string>();
+        if (!opts_str.empty()) {
+            std::istringstream iss(opts_str);
+            std::string pair;
+            while (std::getline(iss, pair, ',')) {
+                auto eq = pair.find('=');
+                if (eq == std::string::npos) {
+                    throw std::invalid_argument(fmt::format("invalid compaction option (expected key=value): {}", pair));
+                }
+                cfg.compaction_options[sstring(pair.substr(0, eq))] = sstring(pair.substr(eq + 1));
+            }
+        }
+        if (cfg.output_format != "text" && cfg.output_format != "json") {
+            throw std::invalid_argument(fmt::format("invalid value for output-format: {}", cfg.output_format));
+        }
+        if (cfg.flush_interval == 0 || cfg.flush_size == 0) {
+            throw std::invalid_argument("--flush-interval and --flush-size must be non-zero");
+        }
+        if (cfg.overwrite_ratio < 0 || cfg.delete_ratio < 0 || cfg.overwrite_ratio + cfg.delete_ratio > 1.0) {
+            throw std::invalid_argument(fmt::format("overwrite-ratio and delete-ratio must be non-negative and add up to at most 1.0, got {} and {}",
+                    cfg.overwrite_ratio, cfg.delete_ratio));
+        }
+
+        if (cfg.output_format == "text") {
+            fmt::print("Compaction simulator\n");
+            fmt::print("  random-seed: {}\n", cfg.random_seed);
+            fmt::print("  sstables-metadata: {}\n", cfg.sstables_metadata.empty() ? "(none)" : cfg.sstables_metadata);
+            fmt::print("  compaction-strategy: {}\n", cfg.compaction_strategy);
+            for (auto& [k, v] : cfg.compaction_options) {
+                fmt::print("  compaction.{}={}\n", k, v);
+            }
+            fmt::print("  flushes: {}\n", cfg.flushes);
+            fmt::print("  flush-interval: {}s\n", cfg.flush_interval);
+            fmt::print("  flush-size: {}\n", cfg.flush_size);
+            fmt::print("  overwrite-ratio: {}\n", cfg.overwrite_ratio);
+            fmt::print("  delete-ratio: {}\n", cfg.delete_ratio);
+            if (cfg.default_time_to_live > 0) {
+                fmt::print("  default-time-to-live: {}s\n", cfg.default_time_to_live);
+            }
+        }
+
+        return sstables::test_env::do_with_async([cfg = std::move(cfg)] (sstables::test_env& env) {
+            do_compaction_simulation(env, cfg);
+        });
+    });
+}
+
+} // namespace perf
@@ -112,6 +112,52 @@ static future<> test_basic_operations(app_template& app) {
 
         testlog.info("Cleared in {:.6f} [ms]", time_to_clear.count() * 1000);
 
+        if (this_smp_shard_count() > 1) {
+            auto time_to_copy_on_other_shard = smp::submit_to(1, [&] {
+                return seastar::async([&] {
+                    tablet_metadata tm3;
+                    auto d = duration_in_seconds([&] {
+                        tm3 = tm.copy().get();
+                    });
+                    tm3.clear_gently().get();
+                    return d;
+                });
+            }).get();
+
+            testlog.info("Copied on another shard in {:.6f} [ms]", time_to_copy_on_other_shard.count() * 1000);
+        }
+
+        {
+            const auto& tmap = tm.get_tablet_map(ids.front());
+            std::optional<tablet_map> clone;
+            auto time_to_clone = duration_in_seconds([&] {
+                clone = tmap.clone_gently().get();
+            });
+
+            testlog.info("Cloned a tablet map in {:.6f} [ms]", time_to_clone.count() * 1000);
+
+            auto time_to_update = duration_in_seconds([&] {
+                tm.mutate_tablet_map_async(ids.front(), [&] (tablet_map& tmap) {
+                    tmap.set_tablet(tmap.first_tablet(), tablet_info{tablet_replica_set{tablet_replica{h2, 0}}});
+                    return make_ready_future<>();
+                }).get();
+            });
+
+            const auto& updated = tm.get_tablet_map(ids.front());
+            testlog.info("Updated one tablet in {:.6f} [ms], {} of {} tablets shared with the previous map",
+                         time_to_update.count() * 1000,
+                         std::ranges::count_if(updated.tablet_ids(), [&] (tablet_id id) {
+                             return &updated.get_tablet_info(id) == &clone->get_tablet_info(id);
+                         }),
+                         updated.tablet_count());
+
+            // Restore the tablet, the metadata is compared with the saved one below.
+            tm.mutate_tablet_map_async(ids.front(), [&] (tablet_map& tmap) {
+                tmap.set_tablet(tmap.first_tablet(), clone->get_tablet_info(tmap.first_tablet()));
+                return make_ready_future<>();
+            }).get();
+        }
+
         auto time_to_save = duration_in_seconds([&] {
             save_tablet_metadata(e.local_db(), tm, api::new_timestamp()).get();
         });
@@ -14,6 +14,8 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/core/reactor.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+#include <seastar/util/file.hh>
 
 #include "locator/tablets.hh"
 #include "service/tablet_allocator.hh"
@@ -28,6 +30,9 @@
 #include "service/storage_proxy.hh"
 #include "db/system_keyspace.hh"
 #include "tools/utils.hh"
+#include "service/tablet_balancer_snapshot.hh"
+#include "cql3/util.hh"
+#include "utils/overloaded_functor.hh"
 
 #include "test/perf/perf.hh"
 #include "test/lib/log.hh"
@@ -143,11 +148,17 @@ struct rebalance_stats {
     seconds_double elapsed_time = seconds_double(0);
     seconds_double max_rebalance_time = seconds_double(0);
     uint64_t rebalance_count = 0;
+    uint64_t migrations = 0;
+    uint64_t intranode_migrations = 0;
+    uint64_t bytes_moved = 0;
 
     rebalance_stats& operator+=(const rebalance_stats& other) {
         elapsed_time += other.elapsed_time;
         max_rebalance_time = std::max(max_rebalance_time, other.max_rebalance_time);
         rebalance_count += other.rebalance_count;
+        migrations += other.migrations;
+        intranode_migrations += other.intranode_migrations;
+        bytes_moved += other.bytes_moved;
         return *this;
     }
 };
@@ -181,6 +192,17 @@ rebalance_stats rebalance_tablets(cql_test_env& e, locator::load_stats& load_sta
             .max_rebalance_time = elapsed,
             .rebalance_count = 1,
         };
+        for (auto&& mig : plan.migrations()) {
+            if (mig.src && mig.dst && mig.src->host == mig.dst->host) {
+                ++iteration_stats.intranode_migrations;
+                continue;
+            }
+            ++iteration_stats.migrations;
+            auto& tmap = stm.get()->tablets().get_tablet_map(mig.tablet.table);
+            auto size = mig.src ? load_stats.get_tablet_size(mig.src->host, {mig.tablet.table, tmap.get_token_range(mig.tablet.tablet)})
+                                : load_stats.get_avg_tablet_size(tmap, mig.tablet);
+            iteration_stats.bytes_moved += size.value_or(0);
+        }
         stats += iteration_stats;
         testlog.debug("Rebalance iteration {} took {:.3f} [s]: mig={}, bad={}, first_bad={}, eval={}, skiplist={}, skip: (load={}, rack={}, node={})",
                       i + 1, elapsed.count(),
@@ -200,7 +222,8 @@ rebalance_stats rebalance_tablets(cql_test_env& e, locator::load_stats& load_sta
             save_tablet_metadata(e.local_db(), stm.get()->tablets(), guard.write_timestamp()).get();
             e.get_storage_service().local().update_tablet_metadata({}).get();
 
-            testlog.info("Rebalance took {:.3f} [s] after {} iteration(s)", stats.elapsed_time.count(), i + 1);
+            testlog.info("Rebalance took {:.3f} [s] after {} iteration(s), migrations={} (intra-node={}), moved={} [B]",
+                         stats.elapsed_time.count(), i + 1, stats.migrations, stats.intranode_migrations, stats.bytes_moved);
             return stats;
         }
         stm.mutate_token_metadata([&] (token_metadata& tm) {
@@ -691,6 +714,181 @@ future<> run_simulations(const boost::program_options::variables_map& app_cfg) {
     }
 }
 
+// Logs the spread of the storage utilization among the nodes and the shards of each DC.
+static
+void log_cluster_balance(const sstring& name, token_metadata_ptr tm, const locator::load_stats& stats) {
+    load_sketch load(tm, make_lw_shared<locator::load_stats>(stats));
+    load.populate().get();
+
+    std::map<sstring, std::vector<host_id>> nodes_by_dc;
+    tm->for_each_token_owner([&] (const locator::node& n) {
+        if (!n.is_leaving()) {
+            nodes_by_dc[n.dc()].push_back(n.host_id());
+        }
+    });
+
+    for (const auto& [dc, nodes] : nodes_by_dc) {
+        min_max_tracker<double> node_load_minmax;
+        min_max_tracker<double> shard_load_minmax;
+        uint64_t used = 0;
+        uint64_t capacity = 0;
+        for (auto h : nodes) {
+            if (!load.has_complete_data(h)) {
+                testlog.warn("{}: incomplete load stats for node {}", name, h);
+                continue;
+            }
+            node_load_minmax.update(load.get_load(h));
+            auto shard_minmax = load.get_shard_minmax(h);
+            shard_load_minmax.update(shard_minmax.min());
+            shard_load_minmax.update(shard_minmax.max());
+            used += load.get_disk_used(h);
+            capacity += load.get_capacity(h);
+        }
+        if (!capacity) {
+            continue;
+        }
+        const double ideal_load = double(used) / capacity;
+        testlog.info("{}: DC {}: ideal utilization={:.4f}, node: min={:.4f}, max={:.4f}, overcommit={:.4f}, shard: min={:.4f}, max={:.4f}, overcommit={:.4f}",
+                     name, dc, ideal_load,
+                     node_load_minmax.min(), node_load_minmax.max(), node_load_minmax.max() / ideal_load,
+                     shard_load_minmax.min(), shard_load_minmax.max(), shard_load_minmax.max() / ideal_load);
+    }
+}
+
+// Rebuilds the cluster captured by a tablet balancer snapshot, see service::tablet_balancer_snapshot,
+// and rebalances it until convergence.
+void test_replay(const bpo::variables_map& opts) {
+    const auto path = opts["snapshot"].as<std::string>();
+    auto snapshot = service::tablet_balancer_snapshot_from_json(
+            rjson::parse(util::read_entire_file_contiguous(std::filesystem::path(path)).get()));
+    testlog.info("Loaded snapshot {}: {} nodes, {} keyspaces, {} tables", path,
+                 snapshot.nodes.size(), snapshot.keyspaces.size(), snapshot.tables.size());
+
+    auto cfg = tablet_cql_test_config();
+    do_with_cql_env_thread([&] (auto& e) {
+        topology_builder topo(e);
+
+        // Host ids are generated by topology_builder, so the snapshot is rewritten with them.
+        std::unordered_map<host_id, host_id> hosts;
+        std::vector<host_id> draining;
+        for (auto& n : snapshot.nodes) {
+            auto host = topo.add_node(service::node_state::normal, n.shard_count, n.dc_rack);
+            hosts.emplace(n.id, host);
+            n.id = host;
+            if (n.draining) {
+                draining.push_back(host);
+            }
+            // Nodes which did not report their capacity get one which fits plenty of tablets.
+            n.capacity = n.capacity.value_or(default_target_tablet_size * n.shard_count * 100);
+            n.effective_capacity = n.effective_capacity.value_or(*n.capacity);
+        }
+
+        size_t missing_sizes = 0;
+        for (auto& t : snapshot.tables) {
+            for (auto& tablet : t.tablets) {
+                uint64_t size_sum = 0;
+                size_t sizes = 0;
+                for (auto& r : tablet.replicas) {
+                    r.replica.host = hosts.at(r.replica.host);
+                    if (r.size) {
+                        size_sum += *r.size;
+                        ++sizes;
+                    }
+                }
+                // Replicas on nodes which were down when the snapshot was taken have no size.
+                for (auto& r : tablet.replicas) {
+                    if (!r.size) {
+                        r.size = sizes ? size_sum / sizes : default_target_tablet_size;
+                        ++missing_sizes;
+                    }
+                }
+            }
+        }
+        if (missing_sizes) {
+            testlog.warn("{} tablet replicas have no size in the snapshot, using the size of their other replicas", missing_sizes);
+        }
+
+        testlog.info("Creating schema");
+        for (const auto& ks : snapshot.keyspaces) {
+            // System keyspaces already exist.
+            if (e.local_db().has_keyspace(ks.name)) {
+                continue;
+            }
+            sstring replication;
+            for (const auto& [dc, option] : ks.replication) {
+                replication += std::visit(overloaded_functor{
+                    [&] (const sstring& rf) { return format(", '{}': '{}'", dc, rf); },
+                    [&] (const rack_list& racks) { return format(", '{}': [{}]", dc, fmt::join(racks | std::views::transform([] (const sstring& rack) {
+                        return format("'{}'", rack);
+                    }), ", ")); },
+                }, option);
+            }
+            e.execute_cql(format("create keyspace {} with replication = {{'class': 'NetworkTopologyStrategy'{}}}"
+                                 " and tablets = {{'enabled': true, 'initial': 1}}",
+                                 cql3::util::maybe_quote(ks.name), replication)).get();
+        }
+        for (const auto& t : snapshot.tables) {
+            if (e.local_db().column_family_exists(t.id)) {
+                continue;
+            }
+            e.create_table([&] (std::string_view) {
+                return *schema_builder(this_smp_shard_count(), t.keyspace, t.name, t.id)
+                        .with_column("p1", utf8_type, column_kind::partition_key)
+                        .with_column("r1", int32_type)
+                        .build();
+            }).get();
+        }
+
+        auto& stm = e.shared_token_metadata().local();
+        stm.mutate_token_metadata([&] (token_metadata& tm) -> future<> {
+            for (const auto& t : snapshot.tables) {
+                if (t.base_table) {
+                    continue;
+                }
+                utils::chunked_vector<dht::raw_token> last_tokens;
+                for (const auto& tablet : t.tablets) {
+                    last_tokens.push_back(dht::raw_token(tablet.last_token));
+                }
+                tablet_map tmap(std::move(last_tokens));
+                for (size_t i = 0; i < t.tablets.size(); ++i) {
+                    tablet_replica_set replicas;
+                    for (const auto& r : t.tablets[i].replicas) {
+                        replicas.push_back(r.replica);
+                    }
+                    tmap.set_tablet(tablet_id(i), tablet_info{std::move(replicas)});
+                    co_await coroutine::maybe_yield();
+                }
+                tm.tablets().set_tablet_map(t.id, std::move(tmap));
+            }
+            for (const auto& t : snapshot.tables) {
+                if (t.base_table) {
+                    tm.tablets().drop_tablet_map(t.id);
+                    co_await tm.tablets().set_colocated_table(t.id, *t.base_table);
+                }
+            }
+        }).get();
+        {
+            abort_source as;
+            auto guard = e.get_raft_group0_client().start_operation(as).get();
+            save_tablet_metadata(e.local_db(), stm.get()->tablets(), guard.write_timestamp()).get();
+            e.get_storage_service().local().update_tablet_metadata({}).get();
+        }
+
+        for (auto host : draining) {
+            topo.set_node_state(host, service::node_state::decommissioning);
+        }
+
+        auto stats = service::tablet_balancer_snapshot_load_stats(snapshot);
+        log_cluster_balance("Initial", stm.get(), stats);
+
+        auto res = rebalance_tablets(e, stats);
+        testlog.info("Convergence: {:.3f} [s] in {} round(s), max={:.3f} [s], migrations={} (intra-node={}), moved={} [B]",
+                     res.elapsed_time.count(), res.rebalance_count, res.max_rebalance_time.count(),
+                     res.migrations, res.intranode_migrations, res.bytes_moved);
+        log_cluster_balance("Final", stm.get(), stats);
+    }, cfg).get();
+}
+
 namespace perf {
 
 void run_add_dec(const bpo::variables_map& opts) {
@@ -747,6 +945,16 @@ const std::map<operation, operation_func> operations_with_func{
             typed_option<double>("tablet-size-deviation-factor", 0.5, "Deviation factor for the tablet size random generator.")
           }
         }, &test_parallel_scaleout},
+
+        {{"replay",
+         "Replays the balancing of a cluster captured by a tablet balancer snapshot",
+         "The snapshot is taken with GET /storage_service/tablets/balancer_snapshot on a live cluster.\n"
+         "The cluster is rebuilt from it and rebalanced until convergence, after which the number\n"
+         "of migrations, the bytes moved and the final imbalance of nodes and shards are reported.",
+         {
+            typed_option<std::string>("snapshot", "Path to the snapshot file."),
+          }
+        }, &test_replay},
     }
 };
 
@@ -815,6 +815,7 @@ class scylla_sstable_compaction_group_view : public compaction::compaction_group
     virtual sstables::sstables_manager& get_sstables_manager() noexcept override { return _sst_man; }
     virtual sstables::shared_sstable make_sstable(sstables::sstable_state) const override { return do_make_sstable(); }
     virtual sstables::shared_sstable make_sstable(sstables::sstable_state, sstables::sstable_version_types) const override { return do_make_sstable(); }
+    virtual sstables::shared_sstable make_sstable(sstables::sstable_state, const data_dictionary::storage_options&) const override { return do_make_sstable(); }
     virtual sstables::sstable_writer_config configure_writer(sstring origin) const override { return do_configure_writer(std::move(origin)); }
     virtual api::timestamp_type min_memtable_timestamp() const override { return api::min_timestamp; }
     virtual api::timestamp_type min_memtable_live_timestamp() const override { return api::min_timestamp; }
@@ -1345,6 +1346,9 @@ const char* to_string(sstables::scylla_metadata_type t) {
         case sstables::scylla_metadata_type::Schema: return "schema";
         case sstables::scylla_metadata_type::ComponentsDigests: return "components_digests";
         case sstables::scylla_metadata_type::LargeDataRecords: return "large_data_records";
+        case sstables::scylla_metadata_type::TombstoneDensity: return "tombstone_density";
+        case sstables::scylla_metadata_type::TimestampIndex: return "timestamp_index";
+        case sstables::scylla_metadata_type::RepairHashSummary: return "repair_hash_summary";
     }
     std::abort();
 }
@@ -1475,6 +1479,54 @@ class scylla_metadata_visitor {
         _writer.Uint64(val.dead_rows);
         _writer.EndObject();
     }
+    void operator()(const sstables::tombstone_density_segment& val) const {
+        _writer.StartObject();
+        _writer.Key("first_token");
+        _writer.AsString(dht::token::from_int64(val.first_token));
+        _writer.Key("last_token");
+        _writer.AsString(dht::token::from_int64(val.last_token));
+        _writer.Key("partitions");
+        _writer.Uint64(val.partitions);
+        _writer.Key("cells");
+        _writer.Uint64(val.cells);
+        _writer.Key("tombstones");
+        _writer.Uint64(val.tombstones);
+        _writer.Key("max_local_deletion_time");
+        _writer.Int64(val.max_local_deletion_time);
+        _writer.EndObject();
+    }
+    void operator()(const sstables::timestamp_index_segment& val) const {
+        _writer.StartObject();
+        _writer.Key("first_token");
+        _writer.AsString(dht::token::from_int64(val.first_token));
+        _writer.Key("last_token");
+        _writer.AsString(dht::token::from_int64(val.last_token));
+        _writer.Key("min_live_timestamp");
+        _writer.Int64(val.min_live_timestamp);
+        _writer.Key("min_live_row_marker_timestamp");
+        _writer.Int64(val.min_live_row_marker_timestamp);
+        _writer.EndObject();
+    }
+    void operator()(const sstables::repair_hash_summary_bucket& val) const {
+        _writer.StartObject();
+        _writer.Key("bucket");
+        _writer.Uint64(val.bucket);
+        _writer.Key("hash");
+        _writer.Uint64(val.hash);
+        _writer.Key("fragments");
+        _writer.Uint64(val.fragments);
+        _writer.EndObject();
+    }
+    void operator()(const sstables::scylla_metadata::repair_hash_summary& val) const {
+        _writer.StartObject();
+        _writer.Key("level");
+        _writer.Uint(val.level);
+        _writer.Key("columns_digest");
+        _writer.Uint64(val.columns_digest);
+        _writer.Key("buckets");
+        (*this)(val.buckets);
+        _writer.EndObject();
+    }
     void operator()(const sstables::scylla_metadata::ext_timestamp_stats& val) const {
         _writer.StartObject();
         for (const auto& [k, v] : val.map) {
@@ -1572,6 +1624,51 @@ void dump_scylla_metadata_operation(schema_ptr schema, reader_permit permit, con
     writer.EndStream();
 }
 
+void dump_compaction_strategy_metadata_operation(schema_ptr schema, reader_permit permit, const std::vector<sstables::shared_sstable>& sstables,
+        sstables::sstables_manager& sst_man, const db::config&, const bpo::variables_map&) {
+    if (sstables.empty()) {
+        throw std::invalid_argument("no sstables specified on the command line");
+    }
+
+    json_writer writer;
+    writer.StartStream();
+    for (auto& sst : sstables) {
+        const auto& stats = sst->get_stats_metadata();
+        writer.Key(fmt::to_string(sst->get_filename()));
+        writer.StartObject();
+        writer.Key("data_size");
+        writer.Uint64(sst->data_size());
+        writer.Key("ondisk_data_size");
+        writer.Uint64(sst->ondisk_data_size());
+        writer.Key("data_file_write_time");
+        writer.Int64(std::chrono::duration_cast<std::chrono::seconds>(sst->data_file_write_time().time_since_epoch()).count());
+        writer.Key("first_token");
+        writer.AsString(sst->get_first_decorated_key().token());
+        writer.Key("last_token");
+        writer.AsString(sst->get_last_decorated_key().token());
+        writer.Key("estimated_partitions");
+        writer.Uint64(sst->get_estimated_key_count());
+        writer.Key("estimated_cells");
+        writer.Uint64(stats.estimated_cells_count.mean() * stats.estimated_cells_count.count());
+        writer.Key("estimated_tombstones");
+        writer.Uint64(stats.estimated_tombstone_drop_time.sum(std::numeric_limits<int32_t>::max()));
+        writer.Key("min_timestamp");
+        writer.Int64(stats.min_timestamp);
+        writer.Key("max_timestamp");
+        writer.Int64(stats.max_timestamp);
+        writer.Key("min_local_deletion_time");
+        writer.Int64(stats.min_local_deletion_time);
+        writer.Key("max_local_deletion_time");
+        writer.Int64(stats.max_local_deletion_time);
+        writer.Key("level");
+        writer.Uint(sst->get_sstable_level());
+        writer.Key("run_identifier");
+        writer.AsString(sst->run_identifier());
+        writer.EndObject();
+    }
+    writer.EndStream();
+}
+
 void validate_checksums_operation(schema_ptr schema, reader_permit permit, const std::vector<sstables::shared_sstable>& sstables,
         sstables::sstables_manager& sst_man, const db::config&, const bpo::variables_map&) {
     if (sstables.empty()) {
@@ -2471,6 +2568,18 @@ produced by Apache Cassandra.
 For more information, see: {}
 )", doc_link("operating-scylla/admin-tools/scylla-sstable#dump-scylla-metadata"))},
             dump_scylla_metadata_operation},
+/* dump-compaction-strategy-metadata */
+    {{"dump-compaction-strategy-metadata",
+            "Dump the sstable metadata compaction strategies make decisions on",
+fmt::format(R"(
+Dump the sizes, token ranges, timestamps, tombstone estimates, levels and run
+identifiers of the sstables, as seen by compaction strategies. The output of a
+node's sstables can be fed to `scylla perf-compaction-simulator`, to compare
+compaction strategies on the node's data.
+
+For more information, see: {}
+)", doc_link("operating-scylla/admin-tools/scylla-sstable#dump-compaction-strategy-metadata"))},
+            dump_compaction_strategy_metadata_operation},
 /* validate */
     {{"validate",
             "Validate the sstable(s), same as scrub in validate mode",
@@ -15,12 +15,13 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/net/api.hh>
 #include "service/client_routes.hh"
+#include "locator/tablets.hh"
 
 namespace cql_transport {
 
 class event {
 public:
-    enum class event_type { TOPOLOGY_CHANGE, STATUS_CHANGE, SCHEMA_CHANGE, CLIENT_ROUTES_CHANGE };
+    enum class event_type { TOPOLOGY_CHANGE, STATUS_CHANGE, SCHEMA_CHANGE, CLIENT_ROUTES_CHANGE, TABLETS_CHANGE };
 
     const event_type type;
 private:
@@ -30,6 +31,7 @@ class event {
     class status_change;
     class schema_change;
     class client_routes_change;
+    class tablets_change;
 };
 
 class event::topology_change : public event {
@@ -114,4 +116,23 @@ class event::client_routes_change : public event {
     }
 };
 
+class event::tablets_change : public event {
+public:
+    enum class change_type { UPDATE_TABLETS };
+
+    const change_type change;
+    const sstring keyspace;
+    const sstring table;
+    // The current routing of the changed tablets of the table.
+    const std::vector<locator::tablet_routing_info> tablets;
+
+    tablets_change(sstring keyspace, sstring table, std::vector<locator::tablet_routing_info> tablets)
+        : event(event_type::TABLETS_CHANGE)
+        , change(change_type::UPDATE_TABLETS)
+        , keyspace(std::move(keyspace))
+        , table(std::move(table))
+        , tablets(std::move(tablets))
+    { }
+};
+
 }
@@ -30,6 +30,9 @@ void cql_server::event_notifier::register_event(event::event_type et, cql_server
     case event::event_type::CLIENT_ROUTES_CHANGE:
         _client_routes_change_listeners.emplace(conn);
         break;
+    case event::event_type::TABLETS_CHANGE:
+        _tablets_change_listeners.emplace(conn);
+        break;
     }
 }
 
@@ -39,6 +42,7 @@ void cql_server::event_notifier::unregister_connection(cql_server::connection* c
     _status_change_listeners.erase(conn);
     _schema_change_listeners.erase(conn);
     _client_routes_change_listeners.erase(conn);
+    _tablets_change_listeners.erase(conn);
 }
 
 void cql_server::event_notifier::on_create_keyspace(const sstring& ks_name)
@@ -306,4 +310,29 @@ void cql_server::event_notifier::on_client_routes_change(const service::client_r
     }
 }
 
+void cql_server::event_notifier::on_tablets_change(const sstring& ks_name, const sstring& cf_name, const std::vector<locator::tablet_routing_info>& tablets)
+{
+    // Bounds the number of TABLETS_CHANGE events queued on a connection which
+    // doesn't keep up with them. A driver which misses an event still learns the
+    // new routing from the tablets-routing-v1 payload of mis-routed requests.
+    static constexpr size_t max_pending_tablets_change_events = 16;
+
+    using namespace cql_transport;
+    const event::tablets_change ev{ks_name, cf_name, tablets};
+    for (auto&& conn : _tablets_change_listeners) {
+        if (conn->_pending_requests_gate.is_closed()) {
+            continue;
+        }
+        if (conn->_pending_tablets_change_events >= max_pending_tablets_change_events) {
+            elogger.debug("Dropping TABLETS_CHANGE event of {}.{} on a connection with too many events pending", ks_name, cf_name);
+            continue;
+        }
+        ++conn->_pending_tablets_change_events;
+        conn->write_response(conn->make_tablets_change_event(ev));
+        conn->_ready_to_respond = conn->_ready_to_respond.finally([conn] {
+            --conn->_pending_tablets_change_events;
+        });
+    }
+}
+
 }
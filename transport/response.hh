@@ -38,7 +38,17 @@ class response {
     cql_binary_opcode _opcode;
     uint8_t           _flags = 0; // a bitwise OR mask of zero or more cql_frame_flags values
     bytes_ostream _body;
+    // Rows following the body, serialized directly into the output stream
+    // when the response is written, see stream_rows().
+    shared_ptr<const messages::result_message::rows> _streamed_rows;
+    size_t _streamed_rows_size = 0;
 public:
+    // Rows of results at least this large are streamed instead of being
+    // serialized into the body upfront.
+    static constexpr size_t rows_streaming_threshold = 128 * 1024;
+    // The size of the buffers streamed rows are serialized into.
+    static constexpr size_t rows_streaming_buffer_size = 32 * 1024;
+
     template<typename T>
     class placeholder;
 
@@ -67,6 +77,7 @@ class response {
 
     void serialize(const event::schema_change& event, uint8_t version);
     void serialize(const event::client_routes_change& event, uint8_t version);
+    void serialize(const event::tablets_change& event, uint8_t version);
     void write_byte(uint8_t b);
     void write_int(int32_t n);
     placeholder<int32_t> write_int_placeholder();
@@ -88,23 +99,42 @@ class response {
     void write(const cql3::metadata& m, const cql_metadata_id_wrapper& request_metadata_id, bool no_metadata = false);
     void write(const cql3::prepared_metadata& m, uint8_t version);
 
+    /// Defer the serialization of the rows of `rows`, `size` bytes in
+    /// serialized form, to when the response is written.
+    ///
+    /// This avoids buffering a second copy of large results in the body: the
+    /// rows are transcoded from the query result directly into the output
+    /// stream, in rows_streaming_buffer_size buffers, which start to be sent
+    /// before the last rows are serialized.
+    ///
+    /// The rows have to be written on the shard they were produced on. If
+    /// the response is handed over to another shard or node, it has to
+    /// materialize_streamed_rows() first.
+    void stream_rows(shared_ptr<const messages::result_message::rows> rows, size_t size);
+
+    /// Serialize the streamed rows into the body, if any.
+    void materialize_streamed_rows();
+
     future<> write_message(output_stream<char>& out, uint8_t version, cql_compression compression, seastar::deleter);
 
     cql_binary_opcode opcode() const {
         return _opcode;
     }
     size_t size() const {
-        return _body.size();
+        return _body.size() + _streamed_rows_size;
     }
     uint8_t flags() const {
         return _flags;
     }
 
     bytes_ostream extract_body() && {
+        materialize_streamed_rows();
         return std::move(_body);
     }
 
 private:
+    future<> write_streamed_rows(output_stream<char>& out);
+
     void compress(cql_compression compression);
     void compress_lz4();
     void compress_snappy();
@@ -10,6 +10,7 @@
 
 #include "cql3/statements/batch_statement.hh"
 #include "cql3/statements/modification_statement.hh"
+#include "cql3/statements/select_statement.hh"
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/semaphore.hh>
 #include <seastar/coroutine/switch_to.hh>
@@ -19,11 +20,13 @@
 #include "types/set.hh"
 #include "types/map.hh"
 #include "types/vector.hh"
+#include "types/tuple.hh"
 #include "dht/token-sharding.hh"
 #include "service/migration_manager.hh"
 #include "service/storage_service.hh"
 #include "service/memory_limiter.hh"
 #include "service/storage_proxy.hh"
+#include "replica/tablets.hh"
 #include "gms/feature_service.hh"
 #include "service/qos/service_level_controller.hh"
 #include "db/consistency_level_type.hh"
@@ -41,6 +44,7 @@
 #include <seastar/util/lazy.hh>
 #include <seastar/util/short_streams.hh>
 #include <seastar/core/execution_stage.hh>
+#include <seastar/core/thread.hh>
 #include "utils/assert.hh"
 #include "utils/exception_container.hh"
 #include "utils/log.hh"
@@ -149,6 +153,14 @@ sstring to_string(const event::client_routes_change::change_type t) {
     throw std::invalid_argument("unknown change type");
 }
 
+sstring to_string(const event::tablets_change::change_type t) {
+    using type = event::tablets_change::change_type;
+    switch (t) {
+    case type::UPDATE_TABLETS:  return "UPDATE_TABLETS";
+    }
+    throw std::invalid_argument("unknown change type");
+}
+
 sstring to_string(cql_binary_opcode op) {
     switch(op) {
     case cql_binary_opcode::ERROR:          return "ERROR";
@@ -219,6 +231,8 @@ parse_event_type(const sstring& value)
         return event::event_type::SCHEMA_CHANGE;
     } else if (value == "CLIENT_ROUTES_CHANGE") {
         return event::event_type::CLIENT_ROUTES_CHANGE;
+    } else if (value == "TABLETS_CHANGE") {
+        return event::event_type::TABLETS_CHANGE;
     } else {
         return exceptions::protocol_exception(format("Invalid value '{}' for Event.Type", value));
     }
@@ -328,7 +342,10 @@ cql_server::cql_server(sharded<cql3::query_processor>& qp, auth::service& auth_s
     , _ms(ms)
     , _config(std::move(config))
     , _memory_available(ml.get_semaphore())
-    , _total_memory(ml.total_memory())
+    , _fast_lane_total_memory(!used_by_maintenance_socket && _config.fast_lane_max_request_size() ? ml.total_memory() / 10 : 0)
+    , _fast_lane_reservation(consume_units(_memory_available, _fast_lane_total_memory))
+    , _fast_lane_memory_available(_fast_lane_total_memory)
+    , _total_memory(ml.total_memory() - _fast_lane_total_memory)
     , _notifier(std::make_unique<event_notifier>(*this))
     , _auth_service(auth_service)
     , _sl_controller(sl_controller)
@@ -397,6 +414,28 @@ cql_server::cql_server(sharded<cql3::query_processor>& qp, auth::service& auth_s
         transport_metrics.emplace_back(std::move(m));
     }
 
+    sm::label lane_label("lane");
+    for (auto lane : {request_lane::regular, request_lane::fast}) {
+        auto label_instance = lane_label(lane == request_lane::fast ? "fast" : "regular");
+        transport_metrics.emplace_back(
+            sm::make_counter("lane_requests_served", get_lane_stats(lane).requests_served,
+                        sm::description("Counts the number of requests admitted through the lane. "
+                                        "Small EXECUTE requests of prepared single-partition SELECTs are admitted through the fast lane."),
+                        {label_instance}));
+        transport_metrics.emplace_back(
+            sm::make_counter("lane_requests_blocked_memory", get_lane_stats(lane).requests_blocked_memory,
+                        sm::description("Counts the requests that blocked due to reaching the memory quota limit of the lane."),
+                        {label_instance}));
+        transport_metrics.emplace_back(
+            sm::make_histogram("lane_request_latency_histogram", [this, lane] { return to_metrics_histogram(get_lane_stats(lane).request_latency); },
+                        sm::description("A histogram of transport-level CQL request latencies (in microseconds) of requests admitted through the lane, "
+                                        "measuring from the start of request processing until the response is written to the socket."),
+                        {label_instance}).set_skip_when_empty());
+    }
+    transport_metrics.emplace_back(
+        sm::make_gauge("fast_lane_memory_available", [this] { return _fast_lane_memory_available.current(); },
+                    sm::description(seastar::format("Holds the amount of available memory for admitting new requests through the fast lane (max is {}B).", _fast_lane_total_memory))));
+
     sm::label cql_error_label("type");
     for (const auto& e : exceptions::exception_map()) {
         _stats.errors.insert({e.first, 0});
@@ -1246,9 +1285,6 @@ future<> cql_server::connection::process_request() {
         if (op == uint8_t(cql_binary_opcode::QUERY) || op == uint8_t(cql_binary_opcode::PREPARE)) {
             mem_estimate += _server._query_processor.local().parsing_cost_estimate();
         }
-        // Cap the estimate, otherwise get_units call later would deadlock
-        mem_estimate = std::min(mem_estimate, _server._total_memory);
-
         if (_server._stats.requests_serving > _server._config.max_concurrent_requests) {
             ++_server._stats.requests_shed;
             return _read_buf.skip(f.length).then([this, stream = f.stream] {
@@ -1262,30 +1298,27 @@ future<> cql_server::connection::process_request() {
             });
         }
 
-        const auto shedding_timeout = std::chrono::milliseconds(50);
-        auto fut = allow_shedding
-                ? get_units(_server._memory_available, mem_estimate, shedding_timeout).then_wrapped([this, length = f.length] (auto f) {
-                    try {
-                        return make_ready_future<semaphore_units<>>(f.get());
-                    } catch (semaphore_timed_out& sto) {
-                        // Cancel shedding in case no more requests are going to do that on completion
-                        if (_pending_requests_gate.get_count() == 0) {
-                            _shed_incoming_requests = false;
-                        }
-                        return _read_buf.skip(length).then([sto = std::move(sto)] () mutable {
-                            return make_exception_future<semaphore_units<>>(std::move(sto));
-                        });
+        const bool fast_lane_candidate = op == uint8_t(cql_binary_opcode::EXECUTE)
+                && _server._fast_lane_total_memory
+                && f.length <= _server._config.fast_lane_max_request_size();
+        if (fast_lane_candidate) {
+            // The frame is small, so it can be read before being admitted,
+            // to find out if it is a point read, which belongs to the fast lane.
+            return this->read_and_decompress_frame(f.length, f.flags).then([this, mem_estimate, length = f.length, flags = f.flags, op, stream, tracing_requested, request_start_time, request_start_timestamp] (fragmented_temporary_buffer buf) mutable {
+                const auto lane = is_point_read(buf, flags) ? request_lane::fast : request_lane::regular;
+                return admit_request(lane, mem_estimate, length, true).then_wrapped([this, buf = std::move(buf), lane, flags, op, stream, tracing_requested, request_start_time, request_start_timestamp] (auto mem_permit_fut) mutable {
+                    if (mem_permit_fut.failed()) {
+                        // Ignore semaphore errors - they are expected if load shedding took place
+                        mem_permit_fut.ignore_ready_future();
+                        return make_ready_future<>();
                     }
-                })
-                : get_units(_server._memory_available, mem_estimate);
-        if (_server._memory_available.waiters()) {
-            if (allow_shedding && !_shedding_timer.armed()) {
-                _shedding_timer.arm(shedding_timeout);
-            }
-            ++_server._stats.requests_blocked_memory;
+                    return process_admitted_request(std::move(buf), make_service_permit(mem_permit_fut.get()), lane, op, stream, flags,
+                            tracing_requested, request_start_time, request_start_timestamp);
+                });
+            });
         }
 
-        return fut.then_wrapped([this, length = f.length, flags = f.flags, op, stream, tracing_requested, request_start_time, request_start_timestamp] (auto mem_permit_fut) {
+        return admit_request(request_lane::regular, mem_estimate, f.length, false).then_wrapped([this, length = f.length, flags = f.flags, op, stream, tracing_requested, request_start_time, request_start_timestamp] (auto mem_permit_fut) {
           if (mem_permit_fut.failed()) {
               // Ignore semaphore errors - they are expected if load shedding took place
               mem_permit_fut.ignore_ready_future();
@@ -1293,77 +1326,155 @@ future<> cql_server::connection::process_request() {
           }
           semaphore_units<> mem_permit = mem_permit_fut.get();
           return this->read_and_decompress_frame(length, flags).then([this, op, stream, flags, tracing_requested, mem_permit = make_service_permit(std::move(mem_permit)), request_start_time, request_start_timestamp] (fragmented_temporary_buffer buf) mutable {
+            return process_admitted_request(std::move(buf), std::move(mem_permit), request_lane::regular, op, stream, flags,
+                    tracing_requested, request_start_time, request_start_timestamp);
+          });
+        });
+    });
+}
 
-            ++_server._stats.requests_served;
-            ++_server._stats.requests_serving;
-            ++_server.get_cql_sg_stats()._requests_serving;
+future<semaphore_units<>> cql_server::connection::admit_request(request_lane lane, size_t mem_estimate, uint32_t length, bool frame_read) {
+    auto& memory_available = _server.lane_memory(lane);
+    // Cap the estimate, otherwise get_units call later would deadlock
+    mem_estimate = std::min<size_t>(mem_estimate, _server.lane_total_memory(lane));
 
-            _pending_requests_gate.enter();
-            auto& sg_stats = _server.get_cql_sg_stats();
-            auto leave = defer([this, &sg_stats] noexcept {
-                --_server._stats.requests_serving;
-                --sg_stats._requests_serving;
-                _shedding_timer.cancel();
-                _shed_incoming_requests = false;
-                _pending_requests_gate.leave();
-            });
-            auto istream = buf.get_istream();
+    const bool allow_shedding = _client_state.get_workload_type() == service::client_state::workload_type::interactive;
+    const auto shedding_timeout = std::chrono::milliseconds(50);
+    auto fut = allow_shedding
+            ? get_units(memory_available, mem_estimate, shedding_timeout).then_wrapped([this, length, frame_read] (auto f) {
+                try {
+                    return make_ready_future<semaphore_units<>>(f.get());
+                } catch (semaphore_timed_out& sto) {
+                    // Cancel shedding in case no more requests are going to do that on completion
+                    if (_pending_requests_gate.get_count() == 0) {
+                        _shed_incoming_requests = false;
+                    }
+                    auto skip = frame_read ? make_ready_future<>() : _read_buf.skip(length);
+                    return skip.then([sto = std::move(sto)] () mutable {
+                        return make_exception_future<semaphore_units<>>(std::move(sto));
+                    });
+                }
+            })
+            : get_units(memory_available, mem_estimate);
+    if (memory_available.waiters()) {
+        if (allow_shedding && !_shedding_timer.armed()) {
+            _shedding_timer.arm(shedding_timeout);
+        }
+        ++_server._stats.requests_blocked_memory;
+        ++_server.get_lane_stats(lane).requests_blocked_memory;
+    }
+    return fut;
+}
 
+bool cql_server::connection::is_point_read(const fragmented_temporary_buffer& buf, uint8_t flags) {
+    bytes_ostream linearization_buffer;
+    request_reader in(buf.get_istream(), linearization_buffer);
+    if ((flags & cql_frame_flags::custom_payload) && _version >= 4) {
+        if (!in.read_string_bytes_map()) {
+            return false;
+        }
+    }
+    auto id = in.read_short_bytes();
+    if (!id) {
+        return false;
+    }
+    auto prepared = _server._query_processor.local().get_prepared(cql3::prepared_cache_key_type(std::move(id).assume_value(), get_dialect()));
+    if (!prepared) {
+        return false;
+    }
+    auto* select = dynamic_cast<const cql3::statements::select_statement*>(prepared->statement.get());
+    if (!select || dynamic_cast<const cql3::statements::view_indexed_table_select_statement*>(select)) {
+        return false;
+    }
+    // Filtering may read a whole partition to return a few rows.
+    const auto& restrictions = *select->get_restrictions();
+    if (restrictions.is_key_range() || restrictions.key_is_in_relation() || restrictions.need_filtering()) {
+        return false;
+    }
+    // A partition can be large, so reading it is cheap only if the read is
+    // restricted to some of its rows, or limited.
+    return restrictions.has_clustering_columns_restriction() || !restrictions.has_unrestricted_clustering_columns() || select->has_limit();
+}
+
+future<> cql_server::connection::process_admitted_request(fragmented_temporary_buffer buf, service_permit mem_permit, request_lane lane, uint8_t op, uint16_t stream, uint8_t flags,
+        tracing_request_type tracing_requested, db::timeout_clock::time_point request_start_time, api::timestamp_type request_start_timestamp) {
+    ++_server._stats.requests_served;
+    ++_server._stats.requests_serving;
+    ++_server.get_cql_sg_stats()._requests_serving;
+    ++_server.get_lane_stats(lane).requests_served;
+
+    _pending_requests_gate.enter();
+    auto& sg_stats = _server.get_cql_sg_stats();
+    auto leave = defer([this, &sg_stats] noexcept {
+        --_server._stats.requests_serving;
+        --sg_stats._requests_serving;
+        _shedding_timer.cancel();
+        _shed_incoming_requests = false;
+        _pending_requests_gate.leave();
+    });
+    auto istream = buf.get_istream();
 
-            // Parallelize only the performance sensitive requests:
-            // QUERY, PREPARE, EXECUTE, BATCH
-            bool should_paralelize = (op == uint8_t(cql_binary_opcode::QUERY) ||
-                    op == uint8_t(cql_binary_opcode::PREPARE) ||
-                    op == uint8_t (cql_binary_opcode::EXECUTE) ||
-                    op == uint8_t(cql_binary_opcode::BATCH));
 
-            future<foreign_ptr<std::unique_ptr<cql_server::response>>> request_process_future = should_paralelize ?
-                    _process_request_stage(this, istream, op, stream, flags, seastar::ref(_client_state), tracing_requested, mem_permit, request_start_timestamp) :
-                    process_request_one(istream, op, stream, flags, seastar::ref(_client_state), tracing_requested, mem_permit, request_start_timestamp);
+    // Parallelize only the performance sensitive requests:
+    // QUERY, PREPARE, EXECUTE, BATCH
+    bool should_paralelize = (op == uint8_t(cql_binary_opcode::QUERY) ||
+            op == uint8_t(cql_binary_opcode::PREPARE) ||
+            op == uint8_t (cql_binary_opcode::EXECUTE) ||
+            op == uint8_t(cql_binary_opcode::BATCH));
 
-            future<> request_response_future = request_process_future.then_wrapped([this, buf = std::move(buf), mem_permit, leave = std::move(leave), stream, request_start_time] (future<foreign_ptr<std::unique_ptr<cql_server::response>>> response_f) mutable {
-                try {
-                    auto& sg_stats = _server.get_cql_sg_stats();
-                    size_t pending_response_size = 0;
-                    if (response_f.failed()) {
-                        const auto message = format("request processing failed, error [{}]", response_f.get_exception());
-                        clogger.error("{}: {}", _client_state.get_remote_address(), message);
-                        write_response(_server.make_error(stream, exceptions::exception_code::SERVER_ERROR,
-                                                  message,
-                                                  tracing::trace_state_ptr()));
+    future<foreign_ptr<std::unique_ptr<cql_server::response>>> request_process_future = should_paralelize ?
+            _process_request_stage(this, istream, op, stream, flags, seastar::ref(_client_state), tracing_requested, mem_permit, request_start_timestamp) :
+            process_request_one(istream, op, stream, flags, seastar::ref(_client_state), tracing_requested, mem_permit, request_start_timestamp);
+
+    future<> request_response_future = request_process_future.then_wrapped([this, buf = std::move(buf), mem_permit, lane, leave = std::move(leave), stream, request_start_time] (future<foreign_ptr<std::unique_ptr<cql_server::response>>> response_f) mutable {
+        try {
+            auto& sg_stats = _server.get_cql_sg_stats();
+            size_t pending_response_size = 0;
+            semaphore_units<> extra_units;
+            if (response_f.failed()) {
+                const auto message = format("request processing failed, error [{}]", response_f.get_exception());
+                clogger.error("{}: {}", _client_state.get_remote_address(), message);
+                write_response(_server.make_error(stream, exceptions::exception_code::SERVER_ERROR,
+                                          message,
+                                          tracing::trace_state_ptr()));
+            } else {
+                auto response = response_f.get();
+                // Account for response body size exceeding the initial estimate.
+                // It is charged to the regular lane, even for requests admitted
+                // through the fast lane, so that the memory used by the fast lane
+                // stays bounded by what it admits.
+                auto resp_size = response->size();
+                auto permit_size = mem_permit.count();
+                if (resp_size > permit_size) {
+                    auto extra = resp_size - permit_size;
+                    if (lane == request_lane::regular) {
+                        mem_permit.adopt(consume_units(_server._memory_available, extra));
                     } else {
-                        auto response = response_f.get();
-                        // Account for response body size exceeding the initial estimate.
-                        auto resp_size = response->size();
-                        auto permit_size = mem_permit.count();
-                        if (resp_size > permit_size) {
-                            auto extra = resp_size - permit_size;
-                            auto extra_units = consume_units(_server._memory_available, extra);
-                            mem_permit.adopt(std::move(extra_units));
-                        }
-                        pending_response_size = resp_size;
-                        sg_stats._pending_response_memory += pending_response_size;
-                        write_response(std::move(response), _compression);
+                        extra_units = consume_units(_server._memory_available, extra);
                     }
-                    _ready_to_respond = _ready_to_respond.finally([leave = std::move(leave), permit = std::move(mem_permit), &sg_stats, pending_response_size, request_start_time] {
-                        sg_stats._pending_response_memory -= pending_response_size;
-                        sg_stats._request_latency.add(db::timeout_clock::now() - request_start_time);
-                    });
-                } catch (...) {
-                    clogger.error("{}: request processing failed: {}",
-                                  _client_state.get_remote_address(), std::current_exception());
                 }
-                maybe_update_scheduling_group_after_reclassification();
-            });
-
-            if (should_paralelize) {
-                return make_ready_future<>();
-            } else {
-                return request_response_future;
+                pending_response_size = resp_size;
+                sg_stats._pending_response_memory += pending_response_size;
+                write_response(std::move(response), _compression);
             }
-          });
-        });
+            _ready_to_respond = _ready_to_respond.finally([this, leave = std::move(leave), permit = std::move(mem_permit), extra_units = std::move(extra_units), &sg_stats, pending_response_size, request_start_time, lane] {
+                sg_stats._pending_response_memory -= pending_response_size;
+                const auto latency = db::timeout_clock::now() - request_start_time;
+                sg_stats._request_latency.add(latency);
+                _server.get_lane_stats(lane).request_latency.add(latency);
+            });
+        } catch (...) {
+            clogger.error("{}: request processing failed: {}",
+                          _client_state.get_remote_address(), std::current_exception());
+        }
+        maybe_update_scheduling_group_after_reclassification();
     });
+
+    if (should_paralelize) {
+        return make_ready_future<>();
+    } else {
+        return request_response_future;
+    }
 }
 
 // Contiguous buffers for use with compression primitives.
@@ -1576,7 +1687,7 @@ future<std::unique_ptr<cql_server::response>> cql_server::connection::process_op
 }
 
 std::unique_ptr<cql_server::response>
-make_result(int16_t stream, messages::result_message& msg, const tracing::trace_state_ptr& tr_state,
+make_result(int16_t stream, shared_ptr<messages::result_message> msg, const tracing::trace_state_ptr& tr_state,
         cql_protocol_version_type version, cql_metadata_id_wrapper&& metadata_id, bool skip_metadata = false);
 
 static inline cql_server::result_with_foreign_response_ptr convert_error_message_to_coordinator_result(messages::result_message* msg) {
@@ -1661,7 +1772,7 @@ process_query_internal(service::client_state& client_state, sharded<cql3::query_
         } else {
             tracing::trace(q_state->query_state.get_trace_state(), "Done processing - preparing a result");
 
-            return cql_server::process_fn_return_type(make_foreign(make_result(stream, *msg, q_state->query_state.get_trace_state(), version, cql_metadata_id_wrapper{}, skip_metadata)));
+            return cql_server::process_fn_return_type(make_foreign(make_result(stream, msg, q_state->query_state.get_trace_state(), version, cql_metadata_id_wrapper{}, skip_metadata)));
         }
     });
 }
@@ -1690,7 +1801,7 @@ future<std::unique_ptr<cql_server::response>> cql_server::connection::process_pr
             cql_metadata_id_wrapper metadata_id = is_metadata_id_supported(client_state)
                 ? cql_metadata_id_wrapper(msg->get_metadata_id())
                 : cql_metadata_id_wrapper();
-            return make_result(stream, *msg, trace_state, _version, std::move(metadata_id));
+            return make_result(stream, msg, trace_state, _version, std::move(metadata_id));
         });
     });
 }
@@ -1795,7 +1906,7 @@ process_execute_internal(service::client_state& client_state, sharded<cql3::quer
             return cql_server::process_fn_return_type(convert_error_message_to_coordinator_result(msg.get()));
         } else {
             tracing::trace(q_state->query_state.get_trace_state(), "Done processing - preparing a result");
-            return cql_server::process_fn_return_type(make_foreign(make_result(stream, *msg, q_state->query_state.get_trace_state(), version, std::move(metadata_id), skip_metadata)));
+            return cql_server::process_fn_return_type(make_foreign(make_result(stream, msg, q_state->query_state.get_trace_state(), version, std::move(metadata_id), skip_metadata)));
         }
     });
 }
@@ -1942,7 +2053,7 @@ process_batch_internal(service::client_state& client_state, sharded<cql3::query_
         } else {
             tracing::trace(q_state->query_state.get_trace_state(), "Done processing - preparing a result");
 
-            return cql_server::process_fn_return_type(make_foreign(make_result(stream, *msg, trace_state, version, cql_metadata_id_wrapper{})));
+            return cql_server::process_fn_return_type(make_foreign(make_result(stream, msg, trace_state, version, cql_metadata_id_wrapper{})));
         }
     });
 }
@@ -2002,8 +2113,13 @@ cql_server::process(uint16_t stream, request_reader in, service::client_state& c
                 auto local_client_state = gcs.get(&server._abort_source);
                 auto local_trace_state = gt.get();
                 auto& local_sg_stats = server.get_cql_sg_stats();
-                co_return co_await process_fn(local_client_state, server._query_processor, in, stream, version,
+                auto ret = co_await process_fn(local_client_state, server._query_processor, in, stream, version,
                         /* FIXME */empty_service_permit(), std::move(local_trace_state), false, cached_vals, dialect, local_sg_stats, request_start_timestamp);
+                // Streamed rows can only be written on the shard they were produced on.
+                if (auto* res = std::get_if<result_with_foreign_response_ptr>(&ret); res && *res) {
+                    res->value()->materialize_streamed_rows();
+                }
+                co_return ret;
             });
         } else {
             // Node bounce
@@ -2131,18 +2247,107 @@ std::unique_ptr<cql_server::response> cql_server::connection::make_supported(int
     return response;
 }
 
+// Serializes the rows of a result set into the body of a response.
+class rows_body_writer {
+    cql_server::response& _response;
+    int64_t _row_count = 0;
+public:
+    rows_body_writer(cql_server::response& r) : _response(r) { }
+
+    void start_row() {
+        _row_count++;
+    }
+    void accept_value(std::optional<managed_bytes_view> cell) {
+        _response.write_value(cell);
+    }
+    void end_row() { }
+
+    int64_t row_count() const { return _row_count; }
+};
+
+// Computes the serialized size of the rows of a result set.
+class rows_size_calculator {
+    size_t _size = 0;
+    int64_t _row_count = 0;
+public:
+    void start_row() {
+        _row_count++;
+    }
+    void accept_value(std::optional<managed_bytes_view> cell) {
+        _size += sizeof(int32_t) + (cell ? cell->size_bytes() : 0);
+    }
+    void end_row() { }
+
+    size_t size() const { return _size; }
+    int64_t row_count() const { return _row_count; }
+};
+
+// Serializes the rows of a result set directly into an output stream.
+// Must be run in a seastar thread.
+class rows_stream_writer {
+    output_stream<char>& _out;
+    temporary_buffer<char> _buf;
+    size_t _pos = 0;
+private:
+    void write(const char* data, size_t size) {
+        while (size) {
+            if (_pos == _buf.size()) {
+                flush();
+                _buf = temporary_buffer<char>(cql_server::response::rows_streaming_buffer_size);
+            }
+            const auto n = std::min(size, _buf.size() - _pos);
+            std::copy_n(data, n, _buf.get_write() + _pos);
+            _pos += n;
+            data += n;
+            size -= n;
+        }
+    }
+public:
+    explicit rows_stream_writer(output_stream<char>& out)
+        : _out(out)
+        , _buf(cql_server::response::rows_streaming_buffer_size)
+    { }
+
+    void start_row() { }
+    void accept_value(std::optional<managed_bytes_view> cell) {
+        const auto len = htonl(cell ? int32_t(cell->size_bytes()) : int32_t(-1));
+        write(reinterpret_cast<const char*>(&len), sizeof(len));
+        if (!cell) {
+            return;
+        }
+        while (!cell->empty()) {
+            auto fragment = cell->current_fragment();
+            write(reinterpret_cast<const char*>(fragment.data()), fragment.size());
+            cell->remove_current();
+        }
+    }
+    void end_row() {
+        seastar::thread::maybe_yield();
+    }
+
+    void flush() {
+        if (_pos) {
+            _buf.trim(std::exchange(_pos, 0));
+            _out.write(std::move(_buf)).get();
+        }
+    }
+};
+
 class cql_server::fmt_visitor : public messages::result_message::visitor_base {
 private:
     uint8_t _version;
     cql_server::response& _response;
     bool _skip_metadata;
     cql_metadata_id_wrapper _metadata_id;
+    shared_ptr<messages::result_message> _msg;
 public:
-    fmt_visitor(uint8_t version, cql_server::response& response, bool skip_metadata, cql_metadata_id_wrapper&& metadata_id)
+    fmt_visitor(uint8_t version, cql_server::response& response, bool skip_metadata, cql_metadata_id_wrapper&& metadata_id,
+            shared_ptr<messages::result_message> msg)
         : _version{version}
         , _response{response}
         , _skip_metadata{skip_metadata}
         , _metadata_id(std::move(metadata_id))
+        , _msg(std::move(msg))
     { }
 
     virtual void visit(const messages::result_message::void_message&) override {
@@ -2184,43 +2389,36 @@ class cql_server::fmt_visitor : public messages::result_message::visitor_base {
         _response.write(rs.get_metadata(), _metadata_id, _skip_metadata);
         auto row_count_plhldr = _response.write_int_placeholder();
 
-        class visitor {
-            cql_server::response& _response;
-            int64_t _row_count = 0;
-        public:
-            visitor(cql_server::response& r) : _response(r) { }
-
-            void start_row() {
-                _row_count++;
-            }
-            void accept_value(std::optional<managed_bytes_view> cell) {
-                _response.write_value(cell);
-            }
-            void end_row() { }
-
-            int64_t row_count() const { return _row_count; }
-        };
+        // Rows generated from a large query result are streamed, so they are
+        // not buffered in the response in addition to the query result.
+        if (rs.generated_result_size().value_or(0) >= cql_server::response::rows_streaming_threshold) {
+            rows_size_calculator sc;
+            rs.visit(sc, false);
+            row_count_plhldr.write(sc.row_count());
+            _response.stream_rows(static_pointer_cast<const messages::result_message::rows>(_msg), sc.size());
+            return;
+        }
 
-        auto v = visitor(_response);
+        auto v = rows_body_writer(_response);
         rs.visit(v);
         row_count_plhldr.write(v.row_count()); // even though the placeholder is for int32_t we won't overflow because of memory limits
     }
 };
 
 std::unique_ptr<cql_server::response>
-make_result(int16_t stream, messages::result_message& msg, const tracing::trace_state_ptr& tr_state,
+make_result(int16_t stream, shared_ptr<messages::result_message> msg, const tracing::trace_state_ptr& tr_state,
         cql_protocol_version_type version, cql_metadata_id_wrapper&& metadata_id, bool skip_metadata) {
     auto response = std::make_unique<cql_server::response>(stream, cql_binary_opcode::RESULT, tr_state);
-    if (!msg.warnings().empty() && version > 3) [[unlikely]] {
+    if (!msg->warnings().empty() && version > 3) [[unlikely]] {
         response->set_frame_flag(cql_frame_flags::warning);
-        response->write_string_list(msg.warnings());
+        response->write_string_list(msg->warnings());
     }
-    if (msg.custom_payload()) {
+    if (msg->custom_payload()) {
         response->set_frame_flag(cql_frame_flags::custom_payload);
-        response->write_string_bytes_map(msg.custom_payload().value());
+        response->write_string_bytes_map(msg->custom_payload().value());
     }
-    cql_server::fmt_visitor fmt{version, *response, skip_metadata, std::move(metadata_id)};
-    msg.accept(fmt);
+    cql_server::fmt_visitor fmt{version, *response, skip_metadata, std::move(metadata_id), msg};
+    msg->accept(fmt);
     return response;
 }
 
@@ -2262,6 +2460,15 @@ cql_server::connection::make_client_routes_change_event(const event::client_rout
     return response;
 }
 
+std::unique_ptr<cql_server::response>
+cql_server::connection::make_tablets_change_event(const event::tablets_change& event) const
+{
+    auto response = std::make_unique<cql_server::response>(-1, cql_binary_opcode::EVENT, tracing::trace_state_ptr());
+    response->write_string("TABLETS_CHANGE");
+    response->serialize(event, _version);
+    return response;
+}
+
 void cql_server::connection::write_response(foreign_ptr<std::unique_ptr<cql_server::response>>&& response, cql_compression compression)
 {
     _ready_to_respond = _ready_to_respond.then([this, compression, response = std::move(response)] () mutable {
@@ -2280,17 +2487,46 @@ future<> cql_server::response::write_message(output_stream<char>& out, uint8_t v
         return make_exception_future<>(std::move(frame).assume_error());
     }
     return out.write(std::move(frame).assume_value()).then([this, &out, del = std::move(del)] mutable {
-        return do_for_each(_body.begin(), _body.end(), [&out, del = std::move(del)] (bytes_view fragment) mutable {
+        return do_for_each(_body.begin(), _body.end(), [&out, del = del.share()] (bytes_view fragment) mutable {
             temporary_buffer<char> buf(reinterpret_cast<char*>(const_cast<signed char*>(fragment.data())), fragment.size(), del.share());
             return out.write(std::move(buf));
+        }).then([this, &out, del = std::move(del)] mutable {
+            if (!_streamed_rows) {
+                return make_ready_future<>();
+            }
+            return write_streamed_rows(out).finally([del = std::move(del)] {});
         }).then([&out] {
             return out.flush();
         });
     });
 }
 
+void cql_server::response::stream_rows(shared_ptr<const messages::result_message::rows> rows, size_t size) {
+    _streamed_rows = std::move(rows);
+    _streamed_rows_size = size;
+}
+
+void cql_server::response::materialize_streamed_rows() {
+    if (!_streamed_rows) {
+        return;
+    }
+    auto rows = std::exchange(_streamed_rows, nullptr);
+    _streamed_rows_size = 0;
+    auto v = rows_body_writer(*this);
+    rows->rs().visit(v);
+}
+
+future<> cql_server::response::write_streamed_rows(output_stream<char>& out) {
+    return seastar::async([this, &out] {
+        rows_stream_writer w(out);
+        _streamed_rows->rs().visit(w);
+        w.flush();
+    });
+}
+
 void cql_server::response::compress(cql_compression compression)
 {
+    materialize_streamed_rows();
     switch (compression) {
     case cql_compression::lz4:
         compress_lz4();
@@ -2377,6 +2613,22 @@ void cql_server::response::serialize(const event::client_routes_change& event, u
     write_string_list(event.get_host_ids());
 }
 
+void cql_server::response::serialize(const event::tablets_change& event, uint8_t version)
+{
+    write_string(to_string(event.change));
+    write_string(event.keyspace);
+    write_string(event.table);
+    // The tablets are encoded like the tablets-routing-v1 custom payload,
+    // so that drivers can reuse its decoder.
+    write_int(event.tablets.size());
+    for (const auto& info : event.tablets) {
+        auto replicas = make_list_value(replica::get_replica_set_type(), replica::replicas_to_data_value(info.tablet_replicas));
+        auto first = data_value(dht::token::to_int64(info.token_range.first));
+        auto last = data_value(dht::token::to_int64(info.token_range.second));
+        write_bytes(make_tuple_value(replica::get_tablet_info_type(), {first, last, replicas}).serialize_nonnull());
+    }
+}
+
 void cql_server::response::write_byte(uint8_t b)
 {
     auto s = reinterpret_cast<const int8_t*>(&b);
@@ -130,6 +130,7 @@ struct cql_server_config {
     utils::updateable_value<bool> cql_duplicate_bind_variable_names_refer_to_same_variable;
     utils::updateable_value<uint32_t> max_relations_in_where_clause;
     utils::updateable_value<uint32_t> uninitialized_connections_semaphore_cpu_concurrency;
+    utils::updateable_value<uint32_t> fast_lane_max_request_size;
     utils::updateable_value<uint32_t> request_timeout_on_shutdown_in_seconds;
 };
 
@@ -211,7 +212,23 @@ class cql_metadata_id_wrapper {
 };
 
 class cql_server : public seastar::peering_sharded_service<cql_server>, public generic_server::server {
+public:
+    // Requests are admitted through one of two lanes, each with its own memory
+    // budget, so that cheap point reads don't queue behind heavy requests
+    // waiting for memory. See cql_server_config::fast_lane_max_request_size.
+    enum class request_lane : uint8_t {
+        regular,
+        fast,
+    };
+    static constexpr size_t request_lanes_count = 2;
 private:
+    struct lane_stats {
+        uint64_t requests_served = 0;
+        uint64_t requests_blocked_memory = 0;
+        // From the admission of the request until its response is written.
+        utils::time_estimated_histogram request_latency;
+    };
+
     struct transport_stats {
         // server stats
         uint64_t connects = 0;
@@ -237,7 +254,14 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
     netw::messaging_service& _ms;
     cql_server_config _config;
     semaphore& _memory_available;
+    // Memory budget of the fast lane, reserved out of the service memory
+    // limiter's semaphore while the server runs. Zero if the fast lane is
+    // disabled when the server starts, or for the maintenance socket.
+    const uint32_t _fast_lane_total_memory;
+    semaphore_units<> _fast_lane_reservation;
+    semaphore _fast_lane_memory_available;
     const uint32_t _total_memory;
+    std::array<lane_stats, request_lanes_count> _lane_stats;
     seastar::metrics::metric_groups _metrics;
     std::unique_ptr<event_notifier> _notifier;
 private:
@@ -283,7 +307,7 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
 private:
     class fmt_visitor;
     friend class connection;
-    friend std::unique_ptr<cql_server::response> make_result(int16_t stream, messages::result_message& msg,
+    friend std::unique_ptr<cql_server::response> make_result(int16_t stream, shared_ptr<messages::result_message> msg,
             const tracing::trace_state_ptr& tr_state, cql_protocol_version_type version, cql_metadata_id_wrapper&& metadata_id, bool skip_metadata);
 
     static std::unique_ptr<cql_server::response> make_unavailable_error(int16_t stream, exceptions::exception_code err, sstring msg, db::consistency_level cl, int32_t required, int32_t alive, const tracing::trace_state_ptr& tr_state);
@@ -314,6 +338,8 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
         bool _ready = false;
         bool _authenticating = false;
         bool _tenant_switch = false;
+        // TABLETS_CHANGE events queued, but not yet written to the client.
+        size_t _pending_tablets_change_events = 0;
 
         enum class tracing_request_type : uint8_t {
             not_requested,
@@ -349,6 +375,10 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
         friend class process_request_executor;
 
         future<foreign_ptr<std::unique_ptr<cql_server::response>>> process_request_one(fragmented_temporary_buffer::istream buf, uint8_t op, uint16_t stream, uint8_t flags, service::client_state& client_state, tracing_request_type tracing_request, service_permit permit, api::timestamp_type request_start_timestamp);
+        future<semaphore_units<>> admit_request(request_lane lane, size_t mem_estimate, uint32_t length, bool frame_read);
+        future<> process_admitted_request(fragmented_temporary_buffer buf, service_permit mem_permit, request_lane lane, uint8_t op, uint16_t stream, uint8_t flags,
+                tracing_request_type tracing_requested, db::timeout_clock::time_point request_start_time, api::timestamp_type request_start_timestamp);
+        bool is_point_read(const fragmented_temporary_buffer& buf, uint8_t flags);
         unsigned frame_size() const;
         unsigned pick_request_cpu();
         utils::result_with_exception<cql_binary_frame_v3, exceptions::protocol_exception, class cql_frame_error> parse_frame(temporary_buffer<char> buf) const;
@@ -366,6 +396,7 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
         std::unique_ptr<cql_server::response> make_status_change_event(const cql_transport::event::status_change& event) const;
         std::unique_ptr<cql_server::response> make_schema_change_event(const cql_transport::event::schema_change& event) const;
         std::unique_ptr<cql_server::response> make_client_routes_change_event(const cql_transport::event::client_routes_change& event) const;
+        std::unique_ptr<cql_server::response> make_tablets_change_event(const cql_transport::event::tablets_change& event) const;
         std::unique_ptr<cql_server::response> make_autheticate(int16_t, std::string_view, const tracing::trace_state_ptr& tr_state) const;
         std::unique_ptr<cql_server::response> make_auth_success(int16_t, bytes, const tracing::trace_state_ptr& tr_state) const;
         std::unique_ptr<cql_server::response> make_auth_challenge(int16_t, bytes, const tracing::trace_state_ptr& tr_state) const;
@@ -407,6 +438,16 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
     }
 
     ::timeout_config timeout_config() const { return _config.timeout_config.current_values(); }
+
+    semaphore& lane_memory(request_lane lane) {
+        return lane == request_lane::fast ? _fast_lane_memory_available : _memory_available;
+    }
+    uint32_t lane_total_memory(request_lane lane) const {
+        return lane == request_lane::fast ? _fast_lane_total_memory : _total_memory;
+    }
+    lane_stats& get_lane_stats(request_lane lane) {
+        return _lane_stats[static_cast<uint8_t>(lane)];
+    }
 };
 
 class cql_server::event_notifier : public service::migration_listener,
@@ -418,6 +459,7 @@ class cql_server::event_notifier : public service::migration_listener,
     std::set<cql_server::connection*> _status_change_listeners;
     std::set<cql_server::connection*> _schema_change_listeners;
     std::set<cql_server::connection*> _client_routes_change_listeners;
+    std::set<cql_server::connection*> _tablets_change_listeners;
     std::unordered_map<gms::inet_address, event::status_change::status_type> _last_status_change;
 
     // We want to delay sending NEW_NODE CQL event to clients until the new node
@@ -462,6 +504,7 @@ class cql_server::event_notifier : public service::migration_listener,
     virtual void on_down(const gms::inet_address& endpoint, locator::host_id hid) override;
 
     virtual void on_client_routes_change(const service::client_routes_service::client_route_keys& client_route_keys) override;
+    virtual void on_tablets_change(const sstring& ks_name, const sstring& cf_name, const std::vector<locator::tablet_routing_info>& tablets) override;
 };
 
 inline service::endpoint_lifecycle_subscriber* cql_server::get_lifecycle_listener() const noexcept { return _notifier.get(); }
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.1
+ */
+
+#pragma once
+
+// cow_chunked_vector is a vector-like container which keeps its items in
+// fixed-size chunks, shared between copies of the vector.
+//
+// Copying the vector copies only the pointers to the chunks, so it is
+// O(size() / max_chunk_capacity()). Before an item is modified through
+// mutable_at(), the chunk which holds it is copied if it is shared with
+// another vector (copy-on-write). So a modification of a single item of
+// a copy costs one chunk, no matter how large the vector is.
+//
+// The chunks are reference counted atomically. Copies of a vector can be
+// made and destroyed on any shard, as long as the vector they are made of
+// is not modified concurrently. This is what happens to immutable data
+// owned by shard 0 and read by other shards, like tablet_map.
+//
+// Only const access to the items is provided, apart from mutable_at(),
+// so that reading the items never copies a chunk.
+
+#include "utils/chunked_vector.hh"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace utils {
+
+template <typename T, size_t max_chunk_bytes = 16*1024>
+class cow_chunked_vector {
+    using chunk = std::vector<T>;
+    using chunk_ptr = std::shared_ptr<chunk>;
+    utils::chunked_vector<chunk_ptr> _chunks;
+    size_t _size = 0;
+public:
+    // Maximum number of T elements in a single chunk.
+    // Each chunk holds max_chunk_capacity() items, except possibly the last.
+    static constexpr size_t max_chunk_capacity() {
+        return std::max(max_chunk_bytes / sizeof(T), size_t(1));
+    }
+
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using const_reference = const T&;
+
+    class const_iterator {
+        const cow_chunked_vector* _v = nullptr;
+        size_t _i = 0;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+        const_iterator(const cow_chunked_vector* v, size_t i) noexcept : _v(v), _i(i) {}
+
+        reference operator*() const { return (*_v)[_i]; }
+        pointer operator->() const { return &(*_v)[_i]; }
+        reference operator[](difference_type n) const { return (*_v)[_i + n]; }
+
+        const_iterator& operator++() noexcept { ++_i; return *this; }
+        const_iterator operator++(int) noexcept { auto it = *this; ++_i; return it; }
+        const_iterator& operator--() noexcept { --_i; return *this; }
+        const_iterator operator--(int) noexcept { auto it = *this; --_i; return it; }
+        const_iterator& operator+=(difference_type n) noexcept { _i += n; return *this; }
+        const_iterator& operator-=(difference_type n) noexcept { _i -= n; return *this; }
+        const_iterator operator+(difference_type n) const noexcept { return const_iterator(_v, _i + n); }
+        friend const_iterator operator+(difference_type n, const const_iterator& it) noexcept { return it + n; }
+        const_iterator operator-(difference_type n) const noexcept { return const_iterator(_v, _i - n); }
+        difference_type operator-(const const_iterator& o) const noexcept { return difference_type(_i) - difference_type(o._i); }
+
+        bool operator==(const const_iterator& o) const noexcept { return _i == o._i; }
+        std::strong_ordering operator<=>(const const_iterator& o) const noexcept { return _i <=> o._i; }
+    };
+    using iterator = const_iterator;
+
+    cow_chunked_vector() = default;
+    cow_chunked_vector(const cow_chunked_vector&) = default;
+    cow_chunked_vector(cow_chunked_vector&& o) noexcept
+        : _chunks(std::move(o._chunks))
+        , _size(std::exchange(o._size, 0))
+    {}
+    cow_chunked_vector& operator=(const cow_chunked_vector&) = default;
+    cow_chunked_vector& operator=(cow_chunked_vector&& o) noexcept {
+        if (this != &o) {
+            _chunks = std::move(o._chunks);
+            _size = std::exchange(o._size, 0);
+        }
+        return *this;
+    }
+
+    size_t size() const noexcept { return _size; }
+    bool empty() const noexcept { return !_size; }
+
+    const T& operator[](size_t i) const noexcept {
+        return (*_chunks[i / max_chunk_capacity()])[i % max_chunk_capacity()];
+    }
+
+    // Returns a reference to the item, which can be modified.
+    // Copies the chunk which holds the item, if it is shared with another vector.
+    T& mutable_at(size_t i) {
+        return unshare(_chunks[i / max_chunk_capacity()])[i % max_chunk_capacity()];
+    }
+
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, _size); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    const T& front() const noexcept { return (*this)[0]; }
+    const T& back() const noexcept { return (*this)[_size - 1]; }
+
+    void reserve(size_t n) {
+        _chunks.reserve((n + max_chunk_capacity() - 1) / max_chunk_capacity());
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (_size % max_chunk_capacity() == 0) {
+            auto c = std::make_shared<chunk>();
+            c->reserve(max_chunk_capacity());
+            _chunks.push_back(std::move(c));
+        }
+        auto& item = unshare(_chunks.back()).emplace_back(std::forward<Args>(args)...);
+        ++_size;
+        return item;
+    }
+
+    void push_back(const T& x) {
+        emplace_back(x);
+    }
+
+    void push_back(T&& x) {
+        emplace_back(std::move(x));
+    }
+
+    // Only growing is supported, new items are value-initialized.
+    void resize(size_t n) {
+        if (n < _size) {
+            throw std::logic_error("cow_chunked_vector cannot shrink");
+        }
+        reserve(n);
+        while (_size < n) {
+            emplace_back();
+        }
+    }
+
+    void clear() noexcept {
+        _chunks.clear();
+        _size = 0;
+    }
+
+    // Chunks shared with other vectors are accounted for in each of them.
+    size_t external_memory_usage() const {
+        size_t result = _chunks.external_memory_usage();
+        for (auto& c : _chunks) {
+            result += sizeof(chunk) + c->capacity() * sizeof(T);
+        }
+        return result;
+    }
+
+    // Returns the number of chunks shared with the other vector.
+    size_t shared_chunks(const cow_chunked_vector& o) const noexcept {
+        size_t result = 0;
+        for (size_t i = 0; i < std::min(_chunks.size(), o._chunks.size()); ++i) {
+            result += _chunks[i] == o._chunks[i];
+        }
+        return result;
+    }
+
+    seastar::future<> clear_gently() noexcept {
+        _size = 0;
+        while (!_chunks.empty()) {
+            _chunks.pop_back();
+            co_await seastar::coroutine::maybe_yield();
+        }
+    }
+
+    bool operator==(const cow_chunked_vector& o) const {
+        if (_size != o._size) {
+            return false;
+        }
+        for (size_t i = 0; i < _chunks.size(); ++i) {
+            if (_chunks[i] != o._chunks[i] && *_chunks[i] != *o._chunks[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+private:
+    static chunk& unshare(chunk_ptr& c) {
+        if (c.use_count() > 1) {
+            auto copy = std::make_shared<chunk>();
+            copy->reserve(max_chunk_capacity());
+            std::ranges::copy(*c, std::back_inserter(*copy));
+            c = std::move(copy);
+        }
+        return *c;
+    }
+};
+
+}